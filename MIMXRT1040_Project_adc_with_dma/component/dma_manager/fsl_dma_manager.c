@@ -0,0 +1,255 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_dma_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Interrupt sharing cost of a channel, lower is better. */
+#define DMAMGR_COST_MAX 4U
+
+/* DMA manager state, one bit per channel. */
+typedef struct _dmamgr_context
+{
+    DMA_Type *base;
+    DMAMUX_Type *dmamux;
+    uint32_t allocated;
+    uint32_t busy;
+} dmamgr_context_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static dmamgr_context_t s_dmamgr;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Cost of placing a channel of the given load on channel, from the channel sharing its interrupt vector. */
+static uint32_t DMAMGR_GetSharingCost(uint32_t channel, bool busy)
+{
+#if defined(FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET)
+    uint32_t partner = (channel + (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET) %
+                       (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL;
+    uint32_t cost;
+
+    if (0U == (s_dmamgr.allocated & (1UL << partner)))
+    {
+        cost = 0U;
+    }
+    else if (0U == (s_dmamgr.busy & (1UL << partner)))
+    {
+        /* A light partner costs a busy channel more, its handler runs on every busy interrupt. */
+        cost = busy ? 2U : 1U;
+    }
+    else
+    {
+        cost = busy ? 3U : 2U;
+    }
+
+    return cost;
+#else
+    return 0U;
+#endif /* FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET */
+}
+
+/* Picks the free channel with the lowest sharing cost in the priority search order. */
+static uint32_t DMAMGR_FindChannel(const dmamgr_channel_config_t *config)
+{
+    uint32_t best     = DMAMGR_DYNAMIC_ALLOCATE;
+    uint32_t bestCost = DMAMGR_COST_MAX;
+    uint32_t cost;
+    uint32_t channel;
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL; i++)
+    {
+        channel = (config->priority == kDMAMGR_PriorityHigh) ? ((uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL - 1U - i) : i;
+        if (0U != (s_dmamgr.allocated & (1UL << channel)))
+        {
+            continue;
+        }
+        cost = DMAMGR_GetSharingCost(channel, config->busy);
+        if (cost < bestCost)
+        {
+            best     = channel;
+            bestCost = cost;
+            if (cost == 0U)
+            {
+                break;
+            }
+        }
+    }
+
+    return best;
+}
+
+/*!
+ * brief Initializes the DMA manager.
+ *
+ * param base eDMA peripheral base address.
+ * param dmamux DMAMUX peripheral base address.
+ */
+void DMAMGR_Init(DMA_Type *base, DMAMUX_Type *dmamux)
+{
+    assert(base != NULL);
+    assert(dmamux != NULL);
+
+    s_dmamgr.base      = base;
+    s_dmamgr.dmamux    = dmamux;
+    s_dmamgr.allocated = 0U;
+    s_dmamgr.busy      = 0U;
+}
+
+/*!
+ * brief Deinitializes the DMA manager, every allocated channel is released.
+ */
+void DMAMGR_Deinit(void)
+{
+    uint32_t channel;
+
+    for (channel = 0U; channel < (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL; channel++)
+    {
+        if (0U != (s_dmamgr.allocated & (1UL << channel)))
+        {
+            (void)DMAMGR_ReleaseChannel(channel);
+        }
+    }
+}
+
+/*!
+ * brief Gets the default channel request.
+ *
+ * param config Pointer to the channel request.
+ */
+void DMAMGR_GetDefaultChannelConfig(dmamgr_channel_config_t *config)
+{
+    assert(config != NULL);
+
+    config->source   = DMAMGR_NO_SOURCE;
+    config->alwaysOn = false;
+    config->channel  = DMAMGR_DYNAMIC_ALLOCATE;
+    config->priority = kDMAMGR_PriorityLow;
+    config->busy     = false;
+}
+
+/*!
+ * brief Allocates an eDMA channel and routes its DMAMUX source.
+ *
+ * param config Pointer to the channel request.
+ * param channel Allocated channel.
+ * retval kStatus_Success The channel is allocated and its DMAMUX channel enabled unless there is no source.
+ * retval kStatus_DMAMGR_ChannelOccupied The fixed channel is already allocated.
+ * retval kStatus_DMAMGR_NoFreeChannel No channel is free.
+ */
+status_t DMAMGR_RequestChannel(const dmamgr_channel_config_t *config, uint32_t *channel)
+{
+    assert(config != NULL);
+    assert(channel != NULL);
+    assert(s_dmamgr.dmamux != NULL);
+    assert((config->channel == DMAMGR_DYNAMIC_ALLOCATE) ||
+           (config->channel < (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL));
+
+    uint32_t primask;
+    uint32_t allocated;
+
+    primask = DisableGlobalIRQ();
+    if (config->channel != DMAMGR_DYNAMIC_ALLOCATE)
+    {
+        if (0U != (s_dmamgr.allocated & (1UL << config->channel)))
+        {
+            EnableGlobalIRQ(primask);
+            return kStatus_DMAMGR_ChannelOccupied;
+        }
+        allocated = config->channel;
+    }
+    else
+    {
+        allocated = DMAMGR_FindChannel(config);
+        if (allocated == DMAMGR_DYNAMIC_ALLOCATE)
+        {
+            EnableGlobalIRQ(primask);
+            return kStatus_DMAMGR_NoFreeChannel;
+        }
+    }
+    s_dmamgr.allocated |= (1UL << allocated);
+    if (config->busy)
+    {
+        s_dmamgr.busy |= (1UL << allocated);
+    }
+    EnableGlobalIRQ(primask);
+
+    /* The source can only be changed while the DMAMUX channel is disabled. */
+    DMAMUX_DisableChannel(s_dmamgr.dmamux, allocated);
+    if (config->alwaysOn || (config->source != DMAMGR_NO_SOURCE))
+    {
+#if defined(FSL_FEATURE_DMAMUX_HAS_A_ON) && FSL_FEATURE_DMAMUX_HAS_A_ON
+        DMAMUX_EnableAlwaysOn(s_dmamgr.dmamux, allocated, config->alwaysOn);
+        DMAMUX_SetSource(s_dmamgr.dmamux, allocated, config->alwaysOn ? 0 : config->source);
+#else
+        /* Source 63 is always enabled on the DMAMUX without A_ON. */
+        DMAMUX_SetSource(s_dmamgr.dmamux, allocated, config->alwaysOn ? 63 : config->source);
+#endif /* FSL_FEATURE_DMAMUX_HAS_A_ON */
+        DMAMUX_EnableChannel(s_dmamgr.dmamux, allocated);
+    }
+
+    *channel = allocated;
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Releases an eDMA channel.
+ *
+ * param channel Channel to release.
+ * retval kStatus_Success The channel is released.
+ * retval kStatus_DMAMGR_ChannelNotUsed The channel was not allocated.
+ */
+status_t DMAMGR_ReleaseChannel(uint32_t channel)
+{
+    assert(channel < (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL);
+
+    uint32_t primask;
+
+    if (0U == (s_dmamgr.allocated & (1UL << channel)))
+    {
+        return kStatus_DMAMGR_ChannelNotUsed;
+    }
+
+    DMAMUX_DisableChannel(s_dmamgr.dmamux, channel);
+#if defined(FSL_FEATURE_DMAMUX_HAS_A_ON) && FSL_FEATURE_DMAMUX_HAS_A_ON
+    DMAMUX_EnableAlwaysOn(s_dmamgr.dmamux, channel, false);
+#endif /* FSL_FEATURE_DMAMUX_HAS_A_ON */
+    if (s_dmamgr.base != NULL)
+    {
+        EDMA_ResetChannel(s_dmamgr.base, channel);
+    }
+
+    primask = DisableGlobalIRQ();
+    s_dmamgr.busy &= ~(1UL << channel);
+    s_dmamgr.allocated &= ~(1UL << channel);
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Checks whether a channel is allocated.
+ *
+ * param channel Channel number.
+ * retval true The channel is allocated.
+ * retval false The channel is free.
+ */
+bool DMAMGR_IsChannelOccupied(uint32_t channel)
+{
+    assert(channel < (uint32_t)FSL_FEATURE_EDMA_MODULE_CHANNEL);
+
+    return (0U != (s_dmamgr.allocated & (1UL << channel)));
+}
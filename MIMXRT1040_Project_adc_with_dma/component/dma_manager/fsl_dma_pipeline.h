@@ -0,0 +1,161 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_DMA_PIPELINE_H_
+#define FSL_DMA_PIPELINE_H_
+
+#include "fsl_dma_manager.h"
+
+/*!
+ * @addtogroup dma_pipeline
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of stages of a pipeline. */
+#define DMAPIPE_MAX_STAGES 4U
+
+/*! @brief How a stage starts the next one. */
+typedef enum _dmapipe_link
+{
+    kDMAPIPE_LinkMinor = 0U, /*!< Every minor loop of the stage runs one minor loop of the next stage. */
+    kDMAPIPE_LinkMajor,      /*!< The completed major loop of the stage runs the next stage. */
+} dmapipe_link_t;
+
+/*! @brief Pipeline stage configuration. */
+typedef struct _dmapipe_stage_config
+{
+    edma_transfer_config_t transfer; /*!< Transfer of the stage, see EDMA_PrepareTransfer. */
+    int32_t srcLastOffset;           /*!< Added to the source address when the major loop completes. */
+    int32_t destLastOffset;          /*!< Added to the destination address when the major loop completes. */
+    dmapipe_link_t link;             /*!< How the stage starts the next one, ignored for the last stage. */
+} dmapipe_stage_config_t;
+
+/*! @brief Pipeline handle. */
+typedef struct _dmapipe_handle dmapipe_handle_t;
+
+/*! @brief Pipeline completion callback, called from the eDMA interrupt of the last stage. */
+typedef void (*dmapipe_callback_t)(dmapipe_handle_t *handle, void *userData);
+
+/*! @brief Pipeline configuration. */
+typedef struct _dmapipe_config
+{
+    const dmapipe_stage_config_t *stages; /*!< Stages in data flow order. */
+    uint32_t stageCount;                  /*!< Number of stages, up to DMAPIPE_MAX_STAGES. */
+    int32_t source;                       /*!< DMAMUX request source pacing the first stage. */
+    bool alwaysOn;                        /*!< Pace the first stage with an always-on source instead. */
+    dmamgr_priority_t priority;           /*!< Placement of the stage channels. */
+    bool continuous;                      /*!< Run again after every completion without the CPU. */
+    dmapipe_callback_t callback;          /*!< Completion callback, can be NULL. */
+    void *userData;                       /*!< Parameter passed to the callback. */
+} dmapipe_config_t;
+
+/*! @brief Pipeline status. */
+typedef struct _dmapipe_status
+{
+    bool running;         /*!< The first stage accepts requests or a stage is executing. */
+    uint32_t completions; /*!< Number of times the last stage completed its major loop. */
+    uint32_t errorStages; /*!< Bit n is set when the channel of stage n reported an eDMA error. */
+} dmapipe_status_t;
+
+/*! @brief Pipeline handle, users shall not touch the values inside. */
+struct _dmapipe_handle
+{
+    DMA_Type *base;                        /*!< eDMA peripheral. */
+    uint32_t channels[DMAPIPE_MAX_STAGES]; /*!< Channel of every stage. */
+    uint32_t stageCount;                   /*!< Number of stages. */
+    edma_handle_t lastStage;               /*!< eDMA handle of the last stage, the only interrupting channel. */
+    dmapipe_callback_t callback;           /*!< Completion callback. */
+    void *userData;                        /*!< Parameter passed to the callback. */
+    volatile uint32_t completions;         /*!< Completed runs of the last stage. */
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Gets the default pipeline configuration.
+ *
+ * The default configuration has no stages, is paced by no source, runs once and has no callback.
+ *
+ * @param config Pointer to the pipeline configuration.
+ */
+void DMAPIPE_GetDefaultConfig(dmapipe_config_t *config);
+
+/*!
+ * @brief Builds a pipeline of linked eDMA channels.
+ *
+ * One channel is requested from the DMA manager for every stage. The first stage is routed to the
+ * configured DMAMUX source, and each later stage is started by the channel link of the stage before it,
+ * so the data moves through the pipeline without the CPU. Only the last stage raises an interrupt, when
+ * its major loop completes.
+ *
+ * The later stages run at the pace of the first one: a stage writing to a peripheral register must be
+ * able to take its data as fast as the first stage produces it. A minor link limits the major loop count
+ * of the linking stage to 511.
+ *
+ * In continuous mode the first stage keeps accepting requests after its major loop, use the last offsets
+ * of the stages to rewind their buffers. Otherwise the pipeline stops after one run and DMAPIPE_Start
+ * runs it again from the addresses the last offsets left.
+ *
+ * @param handle Pointer to the pipeline handle.
+ * @param base eDMA peripheral base address, initialized by EDMA_Init.
+ * @param config Pointer to the pipeline configuration.
+ * @retval kStatus_Success The pipeline is built, call DMAPIPE_Start to run it.
+ * @retval kStatus_DMAMGR_NoFreeChannel Not enough free channels, none is kept.
+ */
+status_t DMAPIPE_Create(dmapipe_handle_t *handle, DMA_Type *base, const dmapipe_config_t *config);
+
+/*!
+ * @brief Stops the pipeline and releases its channels to the DMA manager.
+ *
+ * @param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Destroy(dmapipe_handle_t *handle);
+
+/*!
+ * @brief Starts the pipeline, the first stage accepts requests from its source.
+ *
+ * The error flags of the stages are cleared. When a stage error halted the eDMA, see
+ * edma_config_t::enableHaltOnError, the engine is resumed.
+ *
+ * @param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Start(dmapipe_handle_t *handle);
+
+/*!
+ * @brief Stops the pipeline.
+ *
+ * The first stage stops accepting requests. The stages already started by a link finish their loop.
+ *
+ * @param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Stop(dmapipe_handle_t *handle);
+
+/*!
+ * @brief Gets the pipeline status.
+ *
+ * @param handle Pointer to the pipeline handle.
+ * @param status Pointer to the pipeline status.
+ */
+void DMAPIPE_GetStatus(dmapipe_handle_t *handle, dmapipe_status_t *status);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_DMA_PIPELINE_H_ */
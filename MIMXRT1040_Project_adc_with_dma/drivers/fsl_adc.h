@@ -20,7 +20,7 @@
  * Definitions
  ******************************************************************************/
 /*! @brief ADC driver version */
-#define FSL_ADC_DRIVER_VERSION (MAKE_VERSION(2, 0, 4)) /*!< Version 2.0.4. */
+#define FSL_ADC_DRIVER_VERSION (MAKE_VERSION(2, 0, 5)) /*!< Version 2.0.5. */
 
 /*!
  * @brief Converter's status flags.
@@ -319,6 +319,31 @@ static inline uint32_t ADC_GetChannelStatusFlags(ADC_Type *base, uint32_t channe
  */
 status_t ADC_DoAutoCalibration(ADC_Type *base);
 
+/*!
+ * @brief Gets the result of the last calibration.
+ *
+ * The value can be saved after ADC_DoAutoCalibration succeeded and written back by ADC_SetCalibrationValue after a
+ * reset, which takes much less time than calibrating again.
+ *
+ * @param base ADC peripheral base address.
+ * @return The calibration code.
+ */
+static inline uint32_t ADC_GetCalibrationValue(ADC_Type *base)
+{
+    return (base->CAL & ADC_CAL_CAL_CODE_MASK) >> ADC_CAL_CAL_CODE_SHIFT;
+}
+
+/*!
+ * @brief Sets the calibration result.
+ *
+ * @param base  ADC peripheral base address.
+ * @param value Calibration code read by ADC_GetCalibrationValue on the same device.
+ */
+static inline void ADC_SetCalibrationValue(ADC_Type *base, uint32_t value)
+{
+    base->CAL = ADC_CAL_CAL_CODE(value);
+}
+
 /*!
  * @brief Set user defined offset.
  *
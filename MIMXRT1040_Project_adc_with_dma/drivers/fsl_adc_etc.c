@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_adc_etc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Component ID definition, used by tools. */
+#ifndef FSL_COMPONENT_ID
+#define FSL_COMPONENT_ID "platform.drivers.adc_etc"
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/*!
+ * brief Initialize the ADC_ETC module.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param config Pointer to "adc_etc_config_t" structure.
+ */
+void ADC_ETC_Init(ADC_ETC_Type *base, const adc_etc_config_t *config)
+{
+    assert(NULL != config);
+
+    uint32_t tmp32 = 0U;
+
+    /* Disable software reset. */
+    ADC_ETC_DoSoftwareReset(base, false);
+
+    /* Set ADC_ETC_CTRL register. */
+    tmp32 = ADC_ETC_CTRL_EXT0_TRIG_PRIORITY(config->TSC0triggerPriority) |
+            ADC_ETC_CTRL_EXT1_TRIG_PRIORITY(config->TSC1triggerPriority) |
+            ADC_ETC_CTRL_PRE_DIVIDER(config->clockPreDivider) | ADC_ETC_CTRL_TRIG_ENABLE(config->XBARtriggerMask)
+#if defined(FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL) && FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL
+            | ADC_ETC_CTRL_DMA_MODE_SEL(config->dmaMode)
+#endif /* FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL */
+        ;
+
+    if (config->enableTSCBypass)
+    {
+        tmp32 |= ADC_ETC_CTRL_TSC_BYPASS_MASK;
+    }
+    if (config->enableTSC0Trigger)
+    {
+        tmp32 |= ADC_ETC_CTRL_EXT0_TRIG_ENABLE_MASK;
+    }
+    if (config->enableTSC1Trigger)
+    {
+        tmp32 |= ADC_ETC_CTRL_EXT1_TRIG_ENABLE_MASK;
+    }
+
+    base->CTRL = tmp32;
+}
+
+/*!
+ * brief De-Initialize the ADC_ETC module.
+ *
+ * param base ADC_ETC peripheral base address.
+ */
+void ADC_ETC_Deinit(ADC_ETC_Type *base)
+{
+    /* Do software reset to clear all logical. */
+    ADC_ETC_DoSoftwareReset(base, true);
+}
+
+/*!
+ * brief Gets an available pre-defined settings for the ADC_ETC's configuration.
+ * This function initializes the ADC_ETC's configuration structure with available settings. The default values are:
+ * code
+ *   config->enableTSCBypass = true;
+ *   config->enableTSC0Trigger = false;
+ *   config->enableTSC1Trigger = false;
+ *   config->TSC0triggerPriority = 0U;
+ *   config->TSC1triggerPriority = 0U;
+ *   config->clockPreDivider = 0U;
+ *   config->XBARtriggerMask = 0U;
+ * endcode
+ * param config Pointer to "adc_etc_config_t" structure.
+ */
+void ADC_ETC_GetDefaultConfig(adc_etc_config_t *config)
+{
+    /* Initializes the configure structure to zero. */
+    (void)memset(config, 0, sizeof(*config));
+
+    config->enableTSCBypass   = true;
+    config->enableTSC0Trigger = false;
+    config->enableTSC1Trigger = false;
+#if defined(FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL) && FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL
+    config->dmaMode = kADC_ETC_TrgDMAWithLatchedSignal;
+#endif /* FSL_FEATURE_ADC_ETC_HAS_CTRL_DMA_MODE_SEL */
+    config->TSC0triggerPriority = 0U;
+    config->TSC1triggerPriority = 0U;
+    config->clockPreDivider     = 0U;
+    config->XBARtriggerMask     = 0U;
+}
+
+/*!
+ * brief Set the external XBAR trigger configuration.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param triggerGroup Trigger group index.
+ * param config Pointer to "adc_etc_trigger_config_t" structure.
+ */
+void ADC_ETC_SetTriggerConfig(ADC_ETC_Type *base, uint32_t triggerGroup, const adc_etc_trigger_config_t *config)
+{
+    assert(triggerGroup < ADC_ETC_TRIGn_CTRL_COUNT);
+    assert(ADC_ETC_TRIGn_COUNTER_COUNT > triggerGroup);
+
+    uint32_t tmp32 = 0U;
+
+    /* Set ADC_ETC_TRGn_CTRL register. */
+    tmp32 = ADC_ETC_TRIGn_CTRL_TRIG_CHAIN(config->triggerChainLength) |
+            ADC_ETC_TRIGn_CTRL_TRIG_PRIORITY(config->triggerPriority);
+    if (config->enableSyncMode)
+    {
+        tmp32 |= ADC_ETC_TRIGn_CTRL_SYNC_MODE_MASK;
+    }
+    if (config->enableSWTriggerMode)
+    {
+        tmp32 |= ADC_ETC_TRIGn_CTRL_TRIG_MODE_MASK;
+    }
+    base->TRIG[triggerGroup].TRIGn_CTRL = tmp32;
+
+    /* Set ADC_ETC_TRGn_COUNTER register. */
+    tmp32 = ADC_ETC_TRIGn_COUNTER_INIT_DELAY(config->initialDelay) |
+            ADC_ETC_TRIGn_COUNTER_SAMPLE_INTERVAL(config->sampleIntervalDelay);
+    base->TRIG[triggerGroup].TRIGn_COUNTER = tmp32;
+}
+
+/*!
+ * brief Set the external XBAR trigger chain configuration.
+ * For example, if triggerGroup is set to 0U and chainGroup is set to 1U, which means Trigger0 source's chain1 would be
+ * configurated.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param triggerGroup Trigger group index. Available number is 0~7.
+ * param chainGroup Trigger chain group index. Available number is 0~7.
+ * param config Pointer to "adc_etc_trigger_chain_config_t" structure.
+ */
+void ADC_ETC_SetTriggerChainConfig(ADC_ETC_Type *base,
+                                   uint32_t triggerGroup,
+                                   uint32_t chainGroup,
+                                   const adc_etc_trigger_chain_config_t *config)
+{
+    assert(triggerGroup < ADC_ETC_TRIGn_CTRL_COUNT);
+    assert(chainGroup < FSL_FEATURE_ADC_CONVERSION_CONTROL_COUNT);
+
+    uint32_t tmp32 = 0U;
+    uint32_t tmpReg;
+    volatile uint32_t *chainRegister;
+
+    /* Two chain segments share one 32-bit register, the odd one in the upper half. */
+    chainRegister = &base->TRIG[triggerGroup].TRIGn_CHAIN_1_0 + (chainGroup / 2U);
+    tmp32         = ADC_ETC_TRIGn_CHAIN_1_0_CSEL0(config->ADCChannelSelect) |
+            ADC_ETC_TRIGn_CHAIN_1_0_HWTS0(config->ADCHCRegisterSelect) |
+            ADC_ETC_TRIGn_CHAIN_1_0_IE0(config->InterruptEnable);
+    if (config->enableB2BMode)
+    {
+        tmp32 |= ADC_ETC_TRIGn_CHAIN_1_0_B2B0_MASK;
+    }
+
+    tmpReg = *chainRegister;
+    if (0U == (chainGroup & 1U))
+    {
+        tmpReg = (tmpReg & ~0xFFFFU) | tmp32;
+    }
+    else
+    {
+        tmpReg = (tmpReg & 0xFFFFU) | (tmp32 << ADC_ETC_TRIGn_CHAIN_1_0_CSEL1_SHIFT);
+    }
+    *chainRegister = tmpReg;
+}
+
+/*!
+ * brief Gets the interrupt status flags of external XBAR and TSC triggers.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param sourceIndex trigger source index.
+ *
+ * return Status flags mask of trigger. Refer to "_adc_etc_status_flag_mask".
+ */
+uint32_t ADC_ETC_GetInterruptStatusFlags(ADC_ETC_Type *base, adc_etc_external_trigger_source_t sourceIndex)
+{
+    uint32_t tmp32 = 0U;
+
+    if (((base->DONE0_1_IRQ) & ((uint32_t)ADC_ETC_DONE0_1_IRQ_TRIG0_DONE0_MASK << (uint32_t)sourceIndex)) != 0U)
+    {
+        tmp32 |= (uint32_t)kADC_ETC_Done0StatusFlagMask; /* Customized DONE0 status flags mask, which is defined in
+                                                  fsl_adc_etc.h file. */
+    }
+    if (((base->DONE0_1_IRQ) & ((uint32_t)ADC_ETC_DONE0_1_IRQ_TRIG0_DONE1_MASK << (uint32_t)sourceIndex)) != 0U)
+    {
+        tmp32 |= (uint32_t)kADC_ETC_Done1StatusFlagMask; /* Customized DONE1 status flags mask, which is defined in
+                                                  fsl_adc_etc.h file. */
+    }
+    if (((base->DONE2_3_ERR_IRQ) & ((uint32_t)ADC_ETC_DONE2_3_ERR_IRQ_TRIG0_DONE2_MASK << (uint32_t)sourceIndex)) !=
+        0U)
+    {
+        tmp32 |= (uint32_t)kADC_ETC_Done2StatusFlagMask; /* Customized DONE2 status flags mask, which is defined in
+                                                  fsl_adc_etc.h file. */
+    }
+    if (((base->DONE2_3_ERR_IRQ) & ((uint32_t)ADC_ETC_DONE2_3_ERR_IRQ_TRIG0_ERR_MASK << (uint32_t)sourceIndex)) !=
+        0U)
+    {
+        tmp32 |= (uint32_t)kADC_ETC_ErrorStatusFlagMask; /* Customized ERROR status flags mask, which is defined in
+                                                  fsl_adc_etc.h file. */
+    }
+    return tmp32;
+}
+
+/*!
+ * brief Clears the ADC_ETC's interrupt status falgs.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param sourceIndex trigger source index.
+ * param mask Status flags mask of trigger. Refer to "_adc_etc_status_flag_mask".
+ */
+void ADC_ETC_ClearInterruptStatusFlags(ADC_ETC_Type *base, adc_etc_external_trigger_source_t sourceIndex, uint32_t mask)
+{
+    if (0U != (mask & (uint32_t)kADC_ETC_Done0StatusFlagMask)) /* Write 1 to clear DONE0 status flags. */
+    {
+        base->DONE0_1_IRQ = ((uint32_t)ADC_ETC_DONE0_1_IRQ_TRIG0_DONE0_MASK << (uint32_t)sourceIndex);
+    }
+    if (0U != (mask & (uint32_t)kADC_ETC_Done1StatusFlagMask)) /* Write 1 to clear DONE1 status flags. */
+    {
+        base->DONE0_1_IRQ = ((uint32_t)ADC_ETC_DONE0_1_IRQ_TRIG0_DONE1_MASK << (uint32_t)sourceIndex);
+    }
+    if (0U != (mask & (uint32_t)kADC_ETC_Done2StatusFlagMask)) /* Write 1 to clear DONE2 status flags. */
+    {
+        base->DONE2_3_ERR_IRQ = ((uint32_t)ADC_ETC_DONE2_3_ERR_IRQ_TRIG0_DONE2_MASK << (uint32_t)sourceIndex);
+    }
+    if (0U != (mask & (uint32_t)kADC_ETC_ErrorStatusFlagMask)) /* Write 1 to clear ERROR status flags. */
+    {
+        base->DONE2_3_ERR_IRQ = ((uint32_t)ADC_ETC_DONE2_3_ERR_IRQ_TRIG0_ERR_MASK << (uint32_t)sourceIndex);
+    }
+}
+
+/*!
+ * brief Get ADC conversion result from external XBAR sources.
+ * For example, if triggerGroup is set to 0U and chainGroup is set to 1U, which means the API would
+ * return Trigger0 source's chain1 conversion result.
+ *
+ * param base ADC_ETC peripheral base address.
+ * param triggerGroup Trigger group index. Available number is 0~7.
+ * param chainGroup Trigger chain group index. Available number is 0~7.
+ * return ADC conversion result value.
+ */
+uint32_t ADC_ETC_GetADCConversionValue(ADC_ETC_Type *base, uint32_t triggerGroup, uint32_t chainGroup)
+{
+    assert(triggerGroup < ADC_ETC_TRIGn_RESULT_1_0_COUNT);
+
+    uint32_t mADCResult;
+    uint32_t tmpChainGroup = chainGroup >> 1U;
+    uint32_t tmpResult;
+
+    /* Two results share one 32-bit register, the odd one in the upper half. */
+    tmpResult = (&base->TRIG[triggerGroup].TRIGn_RESULT_1_0)[tmpChainGroup];
+    if (0U == (chainGroup & 1U))
+    {
+        mADCResult = ADC_ETC_TRIGn_RESULT_1_0_DATA0_MASK & tmpResult;
+    }
+    else
+    {
+        mADCResult = ADC_ETC_TRIGn_RESULT_1_0_DATA0_MASK & (tmpResult >> ADC_ETC_TRIGn_RESULT_1_0_DATA1_SHIFT);
+    }
+
+    return mADCResult;
+}
@@ -20,6 +20,7 @@
 #endif
 
 #define EDMA_TRANSFER_ENABLED_MASK 0x80U
+#define EDMA_LOCK_FREE_QUEUE_MASK  0x40U
 
 /*******************************************************************************
  * Prototypes
@@ -38,6 +39,90 @@ static uint32_t EDMA_GetInstanceOffset(uint32_t instance);
  * @param width transfer width.
  */
 static edma_transfer_size_t EDMA_TransferWidthMapping(uint32_t width);
+
+/*!
+ * @brief Claims count consecutive TCDs at the tail of the TCD pool.
+ *
+ * @param handle eDMA handle pointer.
+ * @param count Number of TCDs to claim.
+ * @param firstTcd Index of the first claimed TCD.
+ * @retval kStatus_Success The TCDs are claimed.
+ * @retval kStatus_EDMA_QueueFull There are fewer than count free TCDs.
+ */
+static status_t EDMA_ReserveTcds(edma_handle_t *handle, int8_t count, int8_t *firstTcd);
+
+#if !defined(NDEBUG)
+/*!
+ * @brief Checks that the caller does not preempt the channel interrupt.
+ *
+ * @param handle eDMA handle pointer.
+ * @retval true The caller runs in thread mode or at a priority not higher than the channel interrupt.
+ * @retval false The caller could run while a completion interrupt of the channel is pending.
+ */
+static bool EDMA_IsSubmitterPriorityValid(edma_handle_t *handle);
+#endif /* NDEBUG */
+
+/*!
+ * @brief Splices a chain of newly built TCDs after the last queued TCD.
+ *
+ * @param handle eDMA handle pointer.
+ * @param firstTcd Index of the first TCD of the chain.
+ * @param count Number of TCDs in the chain.
+ */
+static void EDMA_SpliceTcds(edma_handle_t *handle, int8_t firstTcd, int8_t count);
+
+/*!
+ * @brief Gets the next run of contiguous I/O vector bytes.
+ *
+ * @param iov Array of memory segments.
+ * @param iovCount Number of entries in iov.
+ * @param index Current segment, advanced past the bytes of the run.
+ * @param offset Offset in the current segment, advanced past the bytes of the run.
+ * @param maxBytes Maximum run length.
+ * @param addr Start address of the run.
+ * @return Run length in bytes, 0 when the vector is exhausted.
+ */
+static uint32_t EDMA_GetIovRun(
+    const edma_iovec_t *iov, uint32_t iovCount, uint32_t *index, uint32_t *offset, uint32_t maxBytes, uint32_t *addr);
+
+/*!
+ * @brief Computes the minor loop offset of a 2-D transfer.
+ *
+ * @param config Pointer to the 2-D transfer configuration.
+ * @param minorOffset Minor loop offset configuration.
+ * @retval kStatus_Success The minor loop offset is computed.
+ * @retval kStatus_InvalidArgument The strides can not be expressed with one minor loop offset.
+ */
+static status_t EDMA_Get2DMinorOffset(const edma_2d_transfer_config_t *config,
+                                      edma_minor_offset_config_t *minorOffset);
+
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+/*!
+ * @brief Records a submit in the handle statistics.
+ *
+ * @param handle eDMA handle pointer.
+ */
+static void EDMA_StatisticsRecordSubmit(edma_handle_t *handle);
+
+/*!
+ * @brief Gets the number of bytes moved by the major loop of a TCD.
+ *
+ * @param tcd Pointer to the TCD structure or the TCD registers.
+ */
+static uint32_t EDMA_StatisticsGetTcdBytes(const edma_tcd_t *tcd);
+
+/*!
+ * @brief Records an EDMA_HandleIRQ call in the handle statistics.
+ *
+ * @param handle eDMA handle pointer.
+ * @param entry Cycle count at the EDMA_HandleIRQ entry.
+ * @param callback Cycle count when the callback was called.
+ * @param tcds Number of completed TCDs.
+ * @param bytes Number of bytes of the completed TCDs.
+ */
+static void EDMA_StatisticsRecordIsr(
+    edma_handle_t *handle, uint32_t entry, uint32_t callback, uint32_t tcds, uint32_t bytes);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -586,6 +671,102 @@ void EDMA_TcdSetMajorOffsetConfig(edma_tcd_t *tcd, int32_t sourceOffset, int32_t
     tcd->DLAST_SGA = (uint32_t)destOffset;
 }
 
+static status_t EDMA_Get2DMinorOffset(const edma_2d_transfer_config_t *config,
+                                      edma_minor_offset_config_t *minorOffset)
+{
+    /* Address step still missing at the end of a row to reach the start of the next one. */
+    int32_t srcJump  = config->srcRowStride - ((int32_t)config->columns * (int32_t)config->srcElementStride);
+    int32_t destJump = config->destRowStride - ((int32_t)config->columns * (int32_t)config->destElementStride);
+
+    (void)memset(minorOffset, 0, sizeof(*minorOffset));
+
+    /*
+     * The minor loop offset is applied after every minor loop, the last one included. A single row has no next
+     * row to reach, it goes without offset so that any pair of row strides is accepted.
+     */
+    if (config->rows == 1U)
+    {
+        srcJump  = 0;
+        destJump = 0;
+    }
+    if ((srcJump != 0) && (destJump != 0) && (srcJump != destJump))
+    {
+        return kStatus_InvalidArgument;
+    }
+    minorOffset->enableSrcMinorOffset  = (srcJump != 0);
+    minorOffset->enableDestMinorOffset = (destJump != 0);
+    minorOffset->minorOffset           = (uint32_t)((srcJump != 0) ? srcJump : destJump);
+
+    if (minorOffset->enableSrcMinorOffset || minorOffset->enableDestMinorOffset)
+    {
+        /* With an offset, NBYTES keeps 10 bits and MLOFF is a 20-bit signed value. */
+        if (((config->columns * config->elementSize) > DMA_NBYTES_MLOFFYES_NBYTES_MASK) ||
+            ((int32_t)minorOffset->minorOffset < -(1L << 19U)) || ((int32_t)minorOffset->minorOffset >= (1L << 19U)))
+        {
+            return kStatus_InvalidArgument;
+        }
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Configures the eDMA TCD for a 2-D strided transfer.
+ *
+ * A row is one minor loop, the jump to the next row is the minor loop offset, and SLAST (and DLAST when
+ * nextTcd is NULL) brings the addresses back to the first element when the major loop completes.
+ *
+ * param tcd Pointer to the TCD structure, reset with EDMA_TcdReset.
+ * param config Pointer to the 2-D transfer configuration.
+ * param nextTcd Pointer to the next TCD structure. It can be NULL if users
+ *                do not want to enable scatter/gather feature.
+ * retval kStatus_Success The TCD is configured.
+ * retval kStatus_InvalidArgument The strides can not be expressed with one minor loop offset.
+ */
+status_t EDMA_TcdSet2DTransferConfig(edma_tcd_t *tcd, const edma_2d_transfer_config_t *config, edma_tcd_t *nextTcd)
+{
+    assert(tcd != NULL);
+    assert(config != NULL);
+    assert((config->columns != 0U) && (config->rows != 0U) && (config->rows <= DMA_CITER_ELINKNO_CITER_MASK));
+
+    edma_transfer_config_t transfer;
+    edma_minor_offset_config_t minorOffset;
+    int32_t srcRowStep;
+    int32_t destRowStep;
+
+    if (kStatus_Success != EDMA_Get2DMinorOffset(config, &minorOffset))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    transfer.srcAddr          = config->srcAddr;
+    transfer.destAddr         = config->destAddr;
+    transfer.srcTransferSize  = EDMA_TransferWidthMapping(config->elementSize);
+    transfer.destTransferSize = transfer.srcTransferSize;
+    transfer.srcOffset        = config->srcElementStride;
+    transfer.destOffset       = config->destElementStride;
+    transfer.minorLoopBytes   = config->columns * config->elementSize;
+    transfer.majorLoopCounts  = config->rows;
+    EDMA_TcdSetTransferConfig(tcd, &transfer, nextTcd);
+    EDMA_TcdSetMinorOffsetConfig(tcd, &minorOffset);
+
+    /*
+     * Every row moves the addresses by the elements of the row plus the applied minor loop offset, which is the
+     * row stride except for a single row.
+     */
+    srcRowStep  = ((int32_t)config->columns * config->srcElementStride) +
+                  (minorOffset.enableSrcMinorOffset ? (int32_t)minorOffset.minorOffset : 0);
+    destRowStep = ((int32_t)config->columns * config->destElementStride) +
+                  (minorOffset.enableDestMinorOffset ? (int32_t)minorOffset.minorOffset : 0);
+    tcd->SLAST = (uint32_t)(-((int32_t)config->rows * srcRowStep));
+    if (nextTcd == NULL)
+    {
+        tcd->DLAST_SGA = (uint32_t)(-((int32_t)config->rows * destRowStep));
+    }
+
+    return kStatus_Success;
+}
+
 /*!
  * brief Sets the channel link for the eDMA TCD.
  *
@@ -865,6 +1046,11 @@ void EDMA_CreateHandle(edma_handle_t *handle, DMA_Type *base, uint32_t channel)
     /* Enable NVIC interrupt */
     (void)EnableIRQ(s_edmaIRQNumber[edmaInstance][channel]);
 
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    /* The statistics are zeroed with the handle, their timestamps need the cycle counter. */
+    MSDK_EnableCpuCycleCounter();
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
     /*
        Reset TCD registers to zero. Unlike the EDMA_TcdReset(DREQ will be set),
        CSR will be 0. Because in order to suit EDMA busy check mechanism in
@@ -918,6 +1104,27 @@ void EDMA_InstallTCDMemory(edma_handle_t *handle, edma_tcd_t *tcdPool, uint32_t
     handle->tcdPool = tcdPool;
 }
 
+/*!
+ * brief Enables or disables the lock-free TCD queue mode.
+ *
+ * param handle eDMA handle pointer.
+ * param enable true to enable the lock-free queue mode, false to use the interrupt masking queue.
+ */
+void EDMA_EnableLockFreeQueue(edma_handle_t *handle, bool enable)
+{
+    assert(handle != NULL);
+    assert(handle->tcdPool != NULL);
+
+    if (enable)
+    {
+        handle->flags |= EDMA_LOCK_FREE_QUEUE_MASK;
+    }
+    else
+    {
+        handle->flags &= ~(uint8_t)EDMA_LOCK_FREE_QUEUE_MASK;
+    }
+}
+
 /*!
  * brief Installs a callback function for the eDMA transfer.
  *
@@ -1093,6 +1300,202 @@ void EDMA_PrepareTransfer(edma_transfer_config_t *config,
                                transferBytes);
 }
 
+static status_t EDMA_ReserveTcds(edma_handle_t *handle, int8_t count, int8_t *firstTcd)
+{
+    uint32_t primask;
+    int8_t tmpTcdUsed;
+    int8_t tmpTcdSize;
+    int8_t tail;
+
+    if (0U != (handle->flags & EDMA_LOCK_FREE_QUEUE_MASK))
+    {
+        /*
+            Single producer/single consumer: the submitter owns tail and the IRQ handler only decreases
+            tcdUsed, so a stale tcdUsed can only report the queue fuller than it is. The slots are claimed
+            with an exclusive access instead of masking interrupts.
+        */
+        tmpTcdUsed = handle->tcdUsed;
+        tmpTcdSize = handle->tcdSize;
+        if (tmpTcdUsed > (tmpTcdSize - count))
+        {
+            return kStatus_EDMA_QueueFull;
+        }
+        tail      = handle->tail;
+        *firstTcd = tail;
+        tail += count;
+        if (tail >= tmpTcdSize)
+        {
+            tail -= tmpTcdSize;
+        }
+        handle->tail = tail;
+        SDK_ATOMIC_LOCAL_ADD(&handle->tcdUsed, count);
+    }
+    else
+    {
+        /* Check if tcd pool is full. */
+        primask    = DisableGlobalIRQ();
+        tmpTcdUsed = handle->tcdUsed;
+        tmpTcdSize = handle->tcdSize;
+        if (tmpTcdUsed > (tmpTcdSize - count))
+        {
+            EnableGlobalIRQ(primask);
+
+            return kStatus_EDMA_QueueFull;
+        }
+        tail      = handle->tail;
+        *firstTcd = tail;
+        handle->tcdUsed += count;
+        /* Calculate index of next free TCD */
+        tail += count;
+        if (tail >= tmpTcdSize)
+        {
+            tail -= tmpTcdSize;
+        }
+        /* Advance queue tail index */
+        handle->tail = tail;
+        EnableGlobalIRQ(primask);
+    }
+
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    EDMA_StatisticsRecordSubmit(handle);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
+    return kStatus_Success;
+}
+
+#if !defined(NDEBUG)
+static bool EDMA_IsSubmitterPriorityValid(edma_handle_t *handle)
+{
+    uint32_t exception = __get_IPSR() & IPSR_ISR_Msk;
+    IRQn_Type irq      = s_edmaIRQNumber[EDMA_GetInstance(handle->base)][handle->channel];
+
+    /* Thread mode is below every interrupt, NMI and HardFault are above every configurable priority. */
+    if (0U == exception)
+    {
+        return true;
+    }
+    if (exception < 4U)
+    {
+        return false;
+    }
+
+    /* A larger priority value is a lower priority. */
+    return NVIC_GetPriority((IRQn_Type)((int32_t)exception - 16)) >= NVIC_GetPriority(irq);
+}
+#endif /* NDEBUG */
+
+static void EDMA_SpliceTcds(edma_handle_t *handle, int8_t firstTcd, int8_t count)
+{
+    edma_tcd_t *tcdRegs = (edma_tcd_t *)(uint32_t)&handle->base->TCD[handle->channel];
+    uint16_t csr;
+    int8_t previousTcd;
+
+    /*
+        Installing a TCD on a dead chain sets the header index below. A submitter that preempts the channel
+        interrupt could do so while the completion of the previous TCDs is pending, the IRQ handler would then
+        count them from the new header and never release them.
+    */
+    assert(EDMA_IsSubmitterPriorityValid(handle));
+
+    /* Calculate index of previous TCD */
+    previousTcd = firstTcd != 0 ? firstTcd - 1 : (handle->tcdSize - 1);
+    /* Chain from previous descriptor unless the chain fills the pool (its last TCD is the predecessor). */
+    if (count < handle->tcdSize)
+    {
+        if (0U != (handle->flags & EDMA_LOCK_FREE_QUEUE_MASK))
+        {
+            /* Make the new descriptors visible to the eDMA engine before they are published through ESG. */
+            __DMB();
+        }
+        /* Enable scatter/gather feature in the previous TCD block. */
+        csr = handle->tcdPool[previousTcd].CSR | ((uint16_t)DMA_CSR_ESG_MASK);
+        csr &= ~((uint16_t)DMA_CSR_DREQ_MASK);
+        handle->tcdPool[previousTcd].CSR = csr;
+        /*
+            Check if the TCD block in the registers is the previous one (points to first TCD block). It
+            is used to check if the previous TCD linked has been loaded in TCD register. If so, it need to
+            link the TCD register in case link the first TCD with the dead chain when TCD loading occurs
+            before link the previous TCD block.
+        */
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        if (tcdRegs->DLAST_SGA ==
+            MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[firstTcd], kMEMORY_Local2DMA))
+#else
+        if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[firstTcd])
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+        {
+            /*
+                Enable scatter/gather and clear the DREQ bit in the TCD registers. Must write the CSR register
+                one-time, because the transfer maybe finished anytime: a completion between two writes would load
+                the first TCD with the request already disabled by DREQ.
+            */
+            csr          = (uint16_t)((tcdRegs->CSR | DMA_CSR_ESG_MASK) & ~(uint16_t)DMA_CSR_DREQ_MASK);
+            tcdRegs->CSR = csr;
+            /*
+                It is very important to check the ESG bit!
+                Because this hardware design: if DONE bit is set, the ESG bit can not be set. So it can
+                be used to check if the dynamic TCD link operation is successful. If ESG bit is not set
+                and the DLAST_SGA is not the first TCD address(it means the dynamic TCD link succeed and
+                the first TCD block has been loaded into TCD registers), it means transfer finished
+                and TCD link operation fail, so must install TCD content into TCD registers and enable
+                transfer again. And if ESG is set, it means transfer has not finished, so TCD dynamic
+                link succeed.
+                Unless the transfer finished between the read and the write of CSR: the write cleared DONE with
+                the old value, then ESG is set but DREQ already disabled the request, it is a dead chain too.
+            */
+            if ((0U != (tcdRegs->CSR & DMA_CSR_ESG_MASK)) &&
+                ((0U != (handle->base->ERQ & ((uint32_t)1U << handle->channel))) ||
+                 (0U == (handle->flags & EDMA_TRANSFER_ENABLED_MASK))))
+            {
+                return;
+            }
+            /*
+                Check whether the first TCD block is already loaded in the TCD registers. It is another
+                condition when ESG bit is not set: it means the dynamic TCD link succeed and the first
+                TCD block (or a later one of the chain) has been loaded into TCD registers.
+            */
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+            if (tcdRegs->DLAST_SGA !=
+                MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[firstTcd], kMEMORY_Local2DMA))
+#else
+            if (tcdRegs->DLAST_SGA != (uint32_t)&handle->tcdPool[firstTcd])
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+            {
+                return;
+            }
+            /*
+                If go to this, means the previous transfer finished, and the DONE bit is set.
+                So shall configure TCD registers.
+            */
+        }
+        else if (tcdRegs->DLAST_SGA != 0UL)
+        {
+            /* The first TCD block has been linked successfully. */
+            return;
+        }
+        else
+        {
+            /*
+                DLAST_SGA is 0 and it means the first submit transfer, so shall configure
+                TCD registers.
+            */
+        }
+    }
+    /* There is no live chain, TCD block need to be installed in TCD registers. */
+    /*
+        The IRQ handler counts from the next TCD to be loaded, as EDMA_InstallTCDMemory sets it for the first
+        submission. The TCD after the installed one is the next to be loaded, otherwise the completion of a TCD
+        linked to the installed one would also count the installed one.
+    */
+    handle->header = (firstTcd + 1 < handle->tcdSize) ? (int8_t)(firstTcd + 1) : 0;
+    EDMA_InstallTCD(handle->base, handle->channel, &handle->tcdPool[firstTcd]);
+    /* Enable channel request again. */
+    if (0U != (handle->flags & EDMA_TRANSFER_ENABLED_MASK))
+    {
+        handle->base->SERQ = DMA_SERQ_SERQ(handle->channel);
+    }
+}
+
 /*!
  * brief Submits the eDMA transfer request.
  *
@@ -1111,8 +1514,6 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
     assert(handle != NULL);
     assert(config != NULL);
 
-    edma_tcd_t *tcdRegs = (edma_tcd_t *)(uint32_t)&handle->base->TCD[handle->channel];
-
     if (handle->tcdPool == NULL)
     {
         /*
@@ -1140,43 +1541,28 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
             handle->base->TCD[handle->channel].CSR |= DMA_CSR_DREQ_MASK;
             /* Enable major interrupt */
             handle->base->TCD[handle->channel].CSR |= DMA_CSR_INTMAJOR_MASK;
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+            EDMA_StatisticsRecordSubmit(handle);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
 
             return kStatus_Success;
         }
     }
     else /* Use the TCD queue. */
     {
-        uint32_t primask;
-        uint16_t csr;
         int8_t currentTcd;
-        int8_t previousTcd;
         int8_t nextTcd;
-        int8_t tmpTcdUsed;
-        int8_t tmpTcdSize;
 
-        /* Check if tcd pool is full. */
-        primask    = DisableGlobalIRQ();
-        tmpTcdUsed = handle->tcdUsed;
-        tmpTcdSize = handle->tcdSize;
-        if (tmpTcdUsed >= tmpTcdSize)
+        if (kStatus_Success != EDMA_ReserveTcds(handle, 1, &currentTcd))
         {
-            EnableGlobalIRQ(primask);
-
             return kStatus_EDMA_QueueFull;
         }
-        currentTcd = handle->tail;
-        handle->tcdUsed++;
         /* Calculate index of next TCD */
         nextTcd = currentTcd + 1;
         if (nextTcd == handle->tcdSize)
         {
             nextTcd = 0;
         }
-        /* Advance queue tail index */
-        handle->tail = nextTcd;
-        EnableGlobalIRQ(primask);
-        /* Calculate index of previous TCD */
-        previousTcd = currentTcd != 0 ? currentTcd - 1 : (handle->tcdSize - 1);
         /* Configure current TCD block. */
         EDMA_TcdReset(&handle->tcdPool[currentTcd]);
         EDMA_TcdSetTransferConfig(&handle->tcdPool[currentTcd], config, NULL);
@@ -1190,88 +1576,410 @@ status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t
         handle->tcdPool[currentTcd].DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
 #endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
         /* Chain from previous descriptor unless tcd pool size is 1(this descriptor is its own predecessor). */
-        if (currentTcd != previousTcd)
+        EDMA_SpliceTcds(handle, currentTcd, 1);
+
+        return kStatus_Success;
+    }
+}
+
+/*!
+ * brief Submits a batch of eDMA transfer requests.
+ *
+ * This function builds the TCDs for all the configurations in the TCD pool in one pass, links them
+ * with each other and then splices the whole chain after the last submitted TCD. Compared with
+ * calling EDMA_SubmitTransfer count times, the queue is locked once and the previous TCD is
+ * checked against the TCD registers only once.
+ *
+ * param handle eDMA handle pointer.
+ * param configs Array of count eDMA transfer configuration structures.
+ * param count Number of configurations in configs.
+ * retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * retval kStatus_EDMA_QueueFull It means there are fewer than count free TCDs in the queue, nothing is submitted.
+ */
+status_t EDMA_SubmitTransferBatch(edma_handle_t *handle, const edma_transfer_config_t *configs, uint32_t count)
+{
+    assert(handle != NULL);
+    assert(handle->tcdPool != NULL);
+    assert(configs != NULL);
+    assert((count != 0U) && (count <= (uint32_t)handle->tcdSize));
+
+    edma_tcd_t *tcd;
+    int8_t firstTcd;
+    int8_t currentTcd;
+    int8_t nextTcd;
+    uint32_t i;
+
+    if (kStatus_Success != EDMA_ReserveTcds(handle, (int8_t)count, &firstTcd))
+    {
+        return kStatus_EDMA_QueueFull;
+    }
+
+    /* Build the chain, every TCD but the last one is linked to its successor. */
+    currentTcd = firstTcd;
+    for (i = 0U; i < count; i++)
+    {
+        nextTcd = currentTcd + 1;
+        if (nextTcd == handle->tcdSize)
+        {
+            nextTcd = 0;
+        }
+        tcd = &handle->tcdPool[currentTcd];
+        EDMA_TcdReset(tcd);
+        EDMA_TcdSetTransferConfig(tcd, &configs[i], (i + 1U < count) ? &handle->tcdPool[nextTcd] : NULL);
+        /* Enable major interrupt */
+        tcd->CSR |= DMA_CSR_INTMAJOR_MASK;
+        /* The last TCD is linked with next TCD for identification only, it is chained by a later submit. */
+        if (i + 1U == count)
         {
-            /* Enable scatter/gather feature in the previous TCD block. */
-            csr = handle->tcdPool[previousTcd].CSR | ((uint16_t)DMA_CSR_ESG_MASK);
-            csr &= ~((uint16_t)DMA_CSR_DREQ_MASK);
-            handle->tcdPool[previousTcd].CSR = csr;
-            /*
-                Check if the TCD block in the registers is the previous one (points to current TCD block). It
-                is used to check if the previous TCD linked has been loaded in TCD register. If so, it need to
-                link the TCD register in case link the current TCD with the dead chain when TCD loading occurs
-                before link the previous TCD block.
-            */
 #if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
-            if (tcdRegs->DLAST_SGA ==
-                MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[currentTcd], kMEMORY_Local2DMA))
+            tcd->DLAST_SGA = MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[nextTcd], kMEMORY_Local2DMA);
 #else
-            if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[currentTcd])
+            tcd->DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
 #endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
-            {
-                /* Clear the DREQ bits for the dynamic scatter gather */
-                tcdRegs->CSR |= DMA_CSR_DREQ_MASK;
-                /* Enable scatter/gather also in the TCD registers. */
-                csr = tcdRegs->CSR | DMA_CSR_ESG_MASK;
-                /* Must write the CSR register one-time, because the transfer maybe finished anytime. */
-                tcdRegs->CSR = csr;
-                /*
-                    It is very important to check the ESG bit!
-                    Because this hardware design: if DONE bit is set, the ESG bit can not be set. So it can
-                    be used to check if the dynamic TCD link operation is successful. If ESG bit is not set
-                    and the DLAST_SGA is not the next TCD address(it means the dynamic TCD link succeed and
-                    the current TCD block has been loaded into TCD registers), it means transfer finished
-                    and TCD link operation fail, so must install TCD content into TCD registers and enable
-                    transfer again. And if ESG is set, it means transfer has not finished, so TCD dynamic
-                    link succeed.
-                */
-                if (0U != (tcdRegs->CSR & DMA_CSR_ESG_MASK))
-                {
-                    tcdRegs->CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
-                    return kStatus_Success;
-                }
-                /*
-                    Check whether the current TCD block is already loaded in the TCD registers. It is another
-                    condition when ESG bit is not set: it means the dynamic TCD link succeed and the current
-                    TCD block has been loaded into TCD registers.
-                */
+        }
+        currentTcd = nextTcd;
+    }
+
+    EDMA_SpliceTcds(handle, firstTcd, (int8_t)count);
+
+    return kStatus_Success;
+}
+
+static uint32_t EDMA_GetIovRun(
+    const edma_iovec_t *iov, uint32_t iovCount, uint32_t *index, uint32_t *offset, uint32_t maxBytes, uint32_t *addr)
+{
+    uint32_t length = 0U;
+    uint32_t start;
+    uint32_t chunk;
+
+    while ((*index < iovCount) && (length < maxBytes))
+    {
+        start = (uint32_t)(uint8_t *)iov[*index].base + *offset;
+        if (length == 0U)
+        {
+            *addr = start;
+        }
+        else if (start != (*addr + length))
+        {
+            /* The next segment does not follow this one in memory. */
+            break;
+        }
+        else
+        {
+            /* Merge the adjacent segment into the run. */
+        }
+        chunk = iov[*index].length - *offset;
+        if (chunk > (maxBytes - length))
+        {
+            chunk = maxBytes - length;
+        }
+        length += chunk;
+        *offset += chunk;
+        if (*offset == iov[*index].length)
+        {
+            (*index)++;
+            *offset = 0U;
+        }
+    }
+
+    return length;
+}
+
+/*!
+ * brief Submits a transfer between a peripheral register and discontiguous memory segments.
+ *
+ * This function builds one TCD per memory segment in the TCD pool, merging adjacent segments, and splices
+ * the chain after the last submitted TCD. Every TCD raises the major loop interrupt.
+ *
+ * param handle eDMA handle pointer.
+ * param peripheralAddr Peripheral data register address.
+ * param width Peripheral transfer width in bytes, also the bytes moved per request.
+ * param iov Array of iovCount memory segments, in transfer order.
+ * param iovCount Number of entries in iov.
+ * param direction kEDMA_MemoryToPeripheral or kEDMA_PeripheralToMemory.
+ * retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * retval kStatus_EDMA_QueueFull It means there are not enough free TCDs in the queue, nothing is submitted.
+ */
+status_t EDMA_SubmitIov(edma_handle_t *handle,
+                        uint32_t peripheralAddr,
+                        uint32_t width,
+                        const edma_iovec_t *iov,
+                        uint32_t iovCount,
+                        edma_transfer_type_t direction)
+{
+    assert(handle != NULL);
+    assert(handle->tcdPool != NULL);
+    assert(iov != NULL);
+    assert(iovCount != 0U);
+    assert((direction == kEDMA_MemoryToPeripheral) || (direction == kEDMA_PeripheralToMemory));
+
+    edma_transfer_config_t config;
+    edma_tcd_t *tcd;
+    uint32_t maxBytes = (uint32_t)DMA_CITER_ELINKNO_CITER_MASK * width;
+    uint32_t tcdCount = 0U;
+    uint32_t index    = 0U;
+    uint32_t offset   = 0U;
+    uint32_t addr     = 0U;
+    uint32_t length;
+    uint32_t i;
+    int8_t firstTcd;
+    int8_t currentTcd;
+    int8_t nextTcd;
+
+    /* Count the TCDs first so that the whole vector is claimed at once. */
+    while (0U != EDMA_GetIovRun(iov, iovCount, &index, &offset, maxBytes, &addr))
+    {
+        tcdCount++;
+    }
+    assert(tcdCount != 0U);
+    if (tcdCount > (uint32_t)handle->tcdSize)
+    {
+        return kStatus_EDMA_QueueFull;
+    }
+    if (kStatus_Success != EDMA_ReserveTcds(handle, (int8_t)tcdCount, &firstTcd))
+    {
+        return kStatus_EDMA_QueueFull;
+    }
+
+    /* Build the chain, every TCD but the last one is linked to its successor. */
+    index      = 0U;
+    offset     = 0U;
+    currentTcd = firstTcd;
+    for (i = 0U; i < tcdCount; i++)
+    {
+        length  = EDMA_GetIovRun(iov, iovCount, &index, &offset, maxBytes, &addr);
+        nextTcd = currentTcd + 1;
+        if (nextTcd == handle->tcdSize)
+        {
+            nextTcd = 0;
+        }
+        if (direction == kEDMA_MemoryToPeripheral)
+        {
+            EDMA_PrepareTransferConfig(&config, (void *)addr, width, (int16_t)width, (void *)peripheralAddr, width, 0,
+                                       width, length);
+        }
+        else
+        {
+            EDMA_PrepareTransferConfig(&config, (void *)peripheralAddr, width, 0, (void *)addr, width, (int16_t)width,
+                                       width, length);
+        }
+        tcd = &handle->tcdPool[currentTcd];
+        EDMA_TcdReset(tcd);
+        EDMA_TcdSetTransferConfig(tcd, &config, (i + 1U < tcdCount) ? &handle->tcdPool[nextTcd] : NULL);
+        /*
+         * Enable major interrupt on every TCD, EDMA_HandleIRQ counts the completed TCDs from the TCD in the
+         * registers and counts the first TCD of a chain short when it does not interrupt.
+         */
+        tcd->CSR |= DMA_CSR_INTMAJOR_MASK;
+        /* The last TCD is linked with next TCD for identification only, it is chained by a later submit. */
+        if (i + 1U == tcdCount)
+        {
 #if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
-                if (tcdRegs->DLAST_SGA ==
-                    MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[nextTcd], kMEMORY_Local2DMA))
+            tcd->DLAST_SGA = MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[nextTcd], kMEMORY_Local2DMA);
 #else
-                if (tcdRegs->DLAST_SGA == (uint32_t)&handle->tcdPool[nextTcd])
+            tcd->DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
 #endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
-                {
-                    return kStatus_Success;
-                }
-                /*
-                    If go to this, means the previous transfer finished, and the DONE bit is set.
-                    So shall configure TCD registers.
-                */
-            }
-            else if (tcdRegs->DLAST_SGA != 0UL)
-            {
-                /* The current TCD block has been linked successfully. */
-                return kStatus_Success;
-            }
-            else
-            {
-                /*
-                    DLAST_SGA is 0 and it means the first submit transfer, so shall configure
-                    TCD registers.
-                */
-            }
         }
-        /* There is no live chain, TCD block need to be installed in TCD registers. */
-        EDMA_InstallTCD(handle->base, handle->channel, &handle->tcdPool[currentTcd]);
-        /* Enable channel request again. */
-        if (0U != (handle->flags & EDMA_TRANSFER_ENABLED_MASK))
+        currentTcd = nextTcd;
+    }
+
+    EDMA_SpliceTcds(handle, firstTcd, (int8_t)tcdCount);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Submits a 2-D strided eDMA transfer request.
+ *
+ * param handle eDMA handle pointer.
+ * param config Pointer to the 2-D transfer configuration.
+ * retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * retval kStatus_InvalidArgument The strides can not be expressed with one minor loop offset.
+ * retval kStatus_EDMA_QueueFull It means TCD queue is full. Submit transfer request is not allowed.
+ * retval kStatus_EDMA_Busy It means the given channel is busy, need to submit request later.
+ */
+status_t EDMA_Submit2DTransfer(edma_handle_t *handle, const edma_2d_transfer_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+
+    edma_minor_offset_config_t minorOffset;
+
+    /* Reject the strides before a TCD is claimed. */
+    if (kStatus_Success != EDMA_Get2DMinorOffset(config, &minorOffset))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (handle->tcdPool == NULL)
+    {
+        SDK_ALIGN(edma_tcd_t tcd, 32U);
+
+        /* Same busy check as EDMA_SubmitTransfer. */
+        if (((handle->base->TCD[handle->channel].CSR & DMA_CSR_ACTIVE_MASK) != 0U) ||
+            (((handle->base->TCD[handle->channel].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK) !=
+              (handle->base->TCD[handle->channel].BITER_ELINKNO & DMA_BITER_ELINKNO_BITER_MASK))))
         {
-            handle->base->SERQ = DMA_SERQ_SERQ(handle->channel);
+            return kStatus_EDMA_Busy;
         }
+        EDMA_TcdReset(&tcd);
+        (void)EDMA_TcdSet2DTransferConfig(&tcd, config, NULL);
+        /* Enable major interrupt, the auto disable request feature is set by EDMA_TcdReset. */
+        tcd.CSR |= DMA_CSR_INTMAJOR_MASK;
+        EDMA_InstallTCD(handle->base, handle->channel, &tcd);
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+        EDMA_StatisticsRecordSubmit(handle);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+    }
+    else
+    {
+        int8_t currentTcd;
+        int8_t nextTcd;
 
-        return kStatus_Success;
+        if (kStatus_Success != EDMA_ReserveTcds(handle, 1, &currentTcd))
+        {
+            return kStatus_EDMA_QueueFull;
+        }
+        nextTcd = currentTcd + 1;
+        if (nextTcd == handle->tcdSize)
+        {
+            nextTcd = 0;
+        }
+        EDMA_TcdReset(&handle->tcdPool[currentTcd]);
+        (void)EDMA_TcdSet2DTransferConfig(&handle->tcdPool[currentTcd], config, NULL);
+        /* Enable major interrupt */
+        handle->tcdPool[currentTcd].CSR |= DMA_CSR_INTMAJOR_MASK;
+        /* DLAST is not available in the queue, link current TCD with next TCD for identification instead. */
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        handle->tcdPool[currentTcd].DLAST_SGA =
+            MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[nextTcd], kMEMORY_Local2DMA);
+#else
+        handle->tcdPool[currentTcd].DLAST_SGA = (uint32_t)&handle->tcdPool[nextTcd];
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+        EDMA_SpliceTcds(handle, currentTcd, 1);
+    }
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Prepares a TCD template from an eDMA transfer configuration.
+ *
+ * param tcdTemplate Pointer to the TCD template, it does not need to be 32 bytes aligned.
+ * param config Pointer to eDMA transfer configuration structure.
+ */
+void EDMA_PrepareTcdTemplate(edma_tcd_t *tcdTemplate, const edma_transfer_config_t *config)
+{
+    assert(tcdTemplate != NULL);
+    assert(config != NULL);
+
+    tcdTemplate->SADDR     = 0U;
+    tcdTemplate->SOFF      = (uint16_t)config->srcOffset;
+    tcdTemplate->ATTR      = DMA_ATTR_SSIZE(config->srcTransferSize) | DMA_ATTR_DSIZE(config->destTransferSize);
+    tcdTemplate->NBYTES    = config->minorLoopBytes;
+    tcdTemplate->SLAST     = 0U;
+    tcdTemplate->DADDR     = 0U;
+    tcdTemplate->DOFF      = (uint16_t)config->destOffset;
+    tcdTemplate->CITER     = 0U;
+    tcdTemplate->DLAST_SGA = 0U;
+    /* Enable auto disable request feature and major interrupt */
+    tcdTemplate->CSR   = DMA_CSR_DREQ_MASK | DMA_CSR_INTMAJOR_MASK;
+    tcdTemplate->BITER = 0U;
+}
+
+/*!
+ * brief Submits an eDMA transfer request built from a TCD template.
+ *
+ * param handle eDMA handle pointer.
+ * param tcdTemplate Pointer to the TCD template.
+ * param srcAddr Source address.
+ * param destAddr Destination address.
+ * param majorLoopCounts Major loop iteration count, transfer bytes divided by the minor loop byte count.
+ * retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * retval kStatus_EDMA_QueueFull It means TCD queue is full. Submit transfer request is not allowed.
+ * retval kStatus_EDMA_Busy It means the given channel is busy, need to submit request later.
+ */
+status_t EDMA_SubmitTcdTemplate(edma_handle_t *handle,
+                                const edma_tcd_t *tcdTemplate,
+                                uint32_t srcAddr,
+                                uint32_t destAddr,
+                                uint32_t majorLoopCounts)
+{
+    assert(handle != NULL);
+    assert(tcdTemplate != NULL);
+    assert((majorLoopCounts != 0U) && (majorLoopCounts <= DMA_CITER_ELINKNO_CITER_MASK));
+
+    const volatile uint32_t *image = (const volatile uint32_t *)(uint32_t)tcdTemplate;
+    volatile uint32_t *tcd;
+    int8_t currentTcd = 0;
+    int8_t nextTcd;
+    uint32_t dlastSga;
+
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+    srcAddr  = MEMORY_ConvertMemoryMapAddress(srcAddr, kMEMORY_Local2DMA);
+    destAddr = MEMORY_ConvertMemoryMapAddress(destAddr, kMEMORY_Local2DMA);
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+
+    if (handle->tcdPool == NULL)
+    {
+        /* Same busy check as EDMA_SubmitTransfer. */
+        if (((handle->base->TCD[handle->channel].CSR & DMA_CSR_ACTIVE_MASK) != 0U) ||
+            (((handle->base->TCD[handle->channel].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK) !=
+              (handle->base->TCD[handle->channel].BITER_ELINKNO & DMA_BITER_ELINKNO_BITER_MASK))))
+        {
+            return kStatus_EDMA_Busy;
+        }
+        tcd      = (volatile uint32_t *)(uint32_t)&handle->base->TCD[handle->channel];
+        dlastSga = image[6];
+        /* Clear DONE bit first, otherwise the new TCD can not be started. */
+        handle->base->TCD[handle->channel].CSR = 0;
+    }
+    else
+    {
+        if (kStatus_Success != EDMA_ReserveTcds(handle, 1, &currentTcd))
+        {
+            return kStatus_EDMA_QueueFull;
+        }
+        nextTcd = currentTcd + 1;
+        if (nextTcd == handle->tcdSize)
+        {
+            nextTcd = 0;
+        }
+        tcd = (volatile uint32_t *)(uint32_t)&handle->tcdPool[currentTcd];
+        /* Link current TCD with next TCD for identification of current TCD */
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+        dlastSga = MEMORY_ConvertMemoryMapAddress((uint32_t)&handle->tcdPool[nextTcd], kMEMORY_Local2DMA);
+#else
+        dlastSga = (uint32_t)&handle->tcdPool[nextTcd];
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
     }
+
+    /*
+        Copy the template word by word, patching SADDR, DADDR, CITER and BITER on the way.
+        Word layout: SADDR, SOFF|ATTR, NBYTES, SLAST, DADDR, DOFF|CITER, DLAST_SGA, CSR|BITER.
+    */
+    tcd[0] = srcAddr;
+    tcd[1] = image[1];
+    tcd[2] = image[2];
+    tcd[3] = image[3];
+    tcd[4] = destAddr;
+    tcd[5] = (image[5] & 0xFFFFU) | (majorLoopCounts << 16U);
+    tcd[6] = dlastSga;
+    tcd[7] = (image[7] & 0xFFFFU) | (majorLoopCounts << 16U);
+
+    if (handle->tcdPool != NULL)
+    {
+        /* Chain from previous descriptor unless tcd pool size is 1(this descriptor is its own predecessor). */
+        EDMA_SpliceTcds(handle, currentTcd, 1);
+    }
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    else
+    {
+        EDMA_StatisticsRecordSubmit(handle);
+    }
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
+    return kStatus_Success;
 }
 
 /*!
@@ -1299,7 +2007,19 @@ void EDMA_StartTransfer(edma_handle_t *handle)
         handle->flags |= EDMA_TRANSFER_ENABLED_MASK;
 
         /* Check if there was at least one descriptor submitted since reset (TCD in registers is valid) */
-        if (tcdRegs->DLAST_SGA != 0U)
+        if ((tcdRegs->DLAST_SGA != 0U) && (0U != (handle->flags & EDMA_LOCK_FREE_QUEUE_MASK)))
+        {
+            /* Lock-free queue mode never masks interrupts, the channel request is re-enabled directly. */
+            if ((handle->base->ERQ & ((uint32_t)1U << handle->channel)) == 0U)
+            {
+                tmpCSR = tcdRegs->CSR;
+                if ((0U == (tmpCSR & DMA_CSR_DONE_MASK)) || (0U != (tmpCSR & DMA_CSR_ESG_MASK)))
+                {
+                    handle->base->SERQ = DMA_SERQ_SERQ(handle->channel);
+                }
+            }
+        }
+        else if (tcdRegs->DLAST_SGA != 0U)
         {
             primask = DisableGlobalIRQ();
             /* Check if channel request is actually disable. */
@@ -1370,6 +2090,115 @@ void EDMA_AbortTransfer(edma_handle_t *handle)
     }
 }
 
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+static void EDMA_StatisticsRecordSubmit(edma_handle_t *handle)
+{
+    uint32_t depth = (handle->tcdPool == NULL) ? 1U : (uint32_t)(uint8_t)handle->tcdUsed;
+
+    handle->statistics.submitTimestamp = MSDK_GetCpuCycleCount();
+    if (depth > handle->statistics.maxQueueDepth)
+    {
+        handle->statistics.maxQueueDepth = depth;
+    }
+}
+
+static uint32_t EDMA_StatisticsGetTcdBytes(const edma_tcd_t *tcd)
+{
+    uint32_t nbytes = tcd->NBYTES;
+    uint32_t biter  = tcd->BITER;
+
+    /* EDMA_Init enables the minor loop mapping, the minor loop offset takes the upper NBYTES bits when used. */
+    if (0U != (nbytes & (DMA_NBYTES_MLOFFYES_SMLOE_MASK | DMA_NBYTES_MLOFFYES_DMLOE_MASK)))
+    {
+        nbytes &= DMA_NBYTES_MLOFFYES_NBYTES_MASK;
+    }
+    else
+    {
+        nbytes &= DMA_NBYTES_MLOFFNO_NBYTES_MASK;
+    }
+    /* The minor loop link takes the upper BITER bits when enabled. */
+    if (0U != (biter & DMA_BITER_ELINKYES_ELINK_MASK))
+    {
+        biter &= DMA_BITER_ELINKYES_BITER_MASK;
+    }
+    else
+    {
+        biter &= DMA_BITER_ELINKNO_BITER_MASK;
+    }
+
+    return nbytes * biter;
+}
+
+static void EDMA_StatisticsRecordIsr(
+    edma_handle_t *handle, uint32_t entry, uint32_t callback, uint32_t tcds, uint32_t bytes)
+{
+    edma_statistics_t *statistics = &handle->statistics;
+    uint32_t exit                 = MSDK_GetCpuCycleCount();
+    uint32_t cycles               = exit - entry;
+    uint32_t bucket;
+
+    statistics->isrEntryTimestamp = entry;
+    statistics->isrExitTimestamp  = exit;
+    statistics->isrCount++;
+    statistics->isrTotalCycles += cycles;
+    if (cycles > statistics->isrMaxCycles)
+    {
+        statistics->isrMaxCycles = cycles;
+    }
+    /* Entry n holds 2^n to 2^(n+1)-1 cycles, 0 and 1 cycle both land in entry 0. */
+    bucket = (cycles > 1U) ? (31U - (uint32_t)__CLZ(cycles)) : 0U;
+    if (bucket >= EDMA_STATISTICS_HISTOGRAM_SIZE)
+    {
+        bucket = EDMA_STATISTICS_HISTOGRAM_SIZE - 1U;
+    }
+    statistics->isrHistogram[bucket]++;
+    if ((callback - entry) > statistics->callbackMaxLatency)
+    {
+        statistics->callbackMaxLatency = callback - entry;
+    }
+    statistics->tcdsDone += tcds;
+    if (tcds > statistics->maxTcdsPerIsr)
+    {
+        statistics->maxTcdsPerIsr = tcds;
+    }
+    statistics->bytesMoved += bytes;
+}
+
+/*!
+ * brief Gets a snapshot of the eDMA handle statistics.
+ *
+ * param handle eDMA handle pointer.
+ * param statistics Pointer to the statistics copy.
+ */
+void EDMA_GetStatistics(edma_handle_t *handle, edma_statistics_t *statistics)
+{
+    assert(handle != NULL);
+    assert(statistics != NULL);
+
+    uint32_t primask;
+
+    primask     = DisableGlobalIRQ();
+    *statistics = handle->statistics;
+    EnableGlobalIRQ(primask);
+}
+
+/*!
+ * brief Clears the eDMA handle statistics.
+ *
+ * param handle eDMA handle pointer.
+ */
+void EDMA_ResetStatistics(edma_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    uint32_t primask;
+
+    primask = DisableGlobalIRQ();
+    (void)memset(&handle->statistics, 0, sizeof(handle->statistics));
+    EnableGlobalIRQ(primask);
+}
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
 /*!
  * brief eDMA IRQ handler for the current major loop transfer completion.
  *
@@ -1403,6 +2232,12 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
     assert(handle != NULL);
 
     bool transfer_done;
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    uint32_t isrEntry    = MSDK_GetCpuCycleCount();
+    uint32_t isrCallback = 0U;
+    uint32_t isrTcds     = 0U;
+    uint32_t isrBytes    = 0U;
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
 
     /* Clear EDMA interrupt flag */
     handle->base->CINT = handle->channel;
@@ -1411,6 +2246,14 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
 
     if (handle->tcdPool == NULL)
     {
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+        if (transfer_done)
+        {
+            isrTcds  = 1U;
+            isrBytes = EDMA_StatisticsGetTcdBytes((edma_tcd_t *)(uint32_t)&handle->base->TCD[handle->channel]);
+        }
+        isrCallback = MSDK_GetCpuCycleCount();
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
         if (handle->callback != NULL)
         {
             (handle->callback)(handle, handle->userData, transfer_done, 0);
@@ -1453,8 +2296,16 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
              * new_header(1) = handle->header(1)
              * tcdUsed(1) != tcdSize(>1)
              * As the application submit only once, so scatter gather must not enabled, then tcds_done should be 1
+             *
+             * Without esg the TCD in the registers ends the chain and is the only one that can be finished. The
+             * other TCDs counted in tcdUsed were reserved by a submitter this interrupt preempted before it linked
+             * them, they are counted when they complete.
              */
-            if ((tmpTcdUsed == tmpTcdSize) || (!esg))
+            if (!esg)
+            {
+                tcds_done = (tmpTcdUsed > 0) ? 1 : 0;
+            }
+            else if (tmpTcdUsed == tmpTcdSize)
             {
                 tcds_done = handle->tcdUsed;
             }
@@ -1481,10 +2332,30 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
                 handle->base->CDNE = handle->channel;
             }
         }
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+        /* The completed TCDs are still intact, they are only reused once tcdUsed is released below. */
+        isrTcds = (uint32_t)tcds_done;
+        for (sga_index = 0U; sga_index < isrTcds; sga_index++)
+        {
+            /* header is the TCD after the first completed one. */
+            sga = ((uint32_t)(uint8_t)handle->header + (uint32_t)(uint8_t)handle->tcdSize - 1U + sga_index) %
+                  (uint32_t)(uint8_t)handle->tcdSize;
+            isrBytes += EDMA_StatisticsGetTcdBytes(&handle->tcdPool[sga]);
+        }
+        isrCallback = MSDK_GetCpuCycleCount();
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
         /* Advance header which points to the TCD to be loaded into the eDMA engine from memory. */
         handle->header = (int8_t)new_header;
         /* Release TCD blocks. tcdUsed is the TCD number which can be used/loaded in the memory pool. */
-        handle->tcdUsed -= (int8_t)tcds_done;
+        if (0U != (handle->flags & EDMA_LOCK_FREE_QUEUE_MASK))
+        {
+            /* The submitter may increase tcdUsed from a higher priority context without masking interrupts. */
+            SDK_ATOMIC_LOCAL_SUB(&handle->tcdUsed, (int8_t)tcds_done);
+        }
+        else
+        {
+            handle->tcdUsed -= (int8_t)tcds_done;
+        }
         /* Invoke callback function. */
         if (NULL != handle->callback)
         {
@@ -1509,6 +2380,10 @@ void EDMA_HandleIRQ(edma_handle_t *handle)
             }
         }
     }
+
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    EDMA_StatisticsRecordIsr(handle, isrEntry, isrCallback, isrTcds, isrBytes);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
 }
 
 #if defined(FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET) && \
@@ -21,7 +21,7 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief LPUART driver version. */
-#define FSL_LPUART_DRIVER_VERSION (MAKE_VERSION(2, 9, 1))
+#define FSL_LPUART_DRIVER_VERSION (MAKE_VERSION(2, 9, 2))
 /*! @} */
 
 /*! @brief Retry times for waiting flag. */
@@ -50,6 +50,7 @@ enum
         MAKE_STATUS(kStatusGroup_LPUART, 13), /*!< Baudrate is not support in current clock source */
     kStatus_LPUART_IdleLineDetected = MAKE_STATUS(kStatusGroup_LPUART, 14), /*!< IDLE flag. */
     kStatus_LPUART_Timeout          = MAKE_STATUS(kStatusGroup_LPUART, 15), /*!< LPUART times out. */
+    kStatus_LPUART_TxBufferSent     = MAKE_STATUS(kStatusGroup_LPUART, 16), /*!< A queued TX buffer is sent. */
 };
 
 /*! @brief LPUART parity mode. */
@@ -285,6 +286,9 @@ typedef struct _lpuart_transfer
 /* Forward declaration of the handle typedef. */
 typedef struct _lpuart_handle lpuart_handle_t;
 
+/*! @brief Reads length received data from the RX FIFO to data[index] onwards, in the data width of the handle. */
+typedef void (*lpuart_rx_read_t)(LPUART_Type *base, void *data, size_t index, size_t length);
+
 /*! @brief LPUART transfer callback function. */
 typedef void (*lpuart_transfer_callback_t)(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData);
 
@@ -322,9 +326,11 @@ struct _lpuart_handle
     volatile uint8_t rxState;            /*!< RX transfer state. */
 
 #if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
-    bool isSevenDataBits; /*!< Seven data bits flag. */
+    bool isSevenDataBits;    /*!< Seven data bits flag. */
 #endif
-    bool is16bitData;     /*!< 16bit data bits flag, only used for 9bit or 10bit data */
+    bool is16bitData;        /*!< 16bit data bits flag, only used for 9bit or 10bit data */
+    lpuart_rx_read_t rxRead; /*!< RX FIFO read of the data width above, set when the handle is created and when
+                                  a receive or the ring buffer starts. */
 };
 
 /* Typedef for interrupt handler. */
@@ -3,6 +3,15 @@
 #include "fsl_adc.h"                // ADC driver
 #include "fsl_edma.h"               // eDMA driver
 #include "fsl_dmamux.h"             // DMAMUX driver
+#include "fsl_dma_manager.h"        // eDMA channel allocator
+#include "adc_scan.h"               // ADC_ETC scan with planar DMA output
+#include "adc_pacer.h"              // PWM + XBARA sample rate
+#include "adc_decimator.h"          // Decimating FIR filter
+#include "adc_stats.h"              // Block statistics
+#include "adc_telemetry.h"          // Binary frames over LPUART eDMA
+#include "adc_calibration.h"        // Saved ADC calibration
+#include "adc_event.h"              // Hardware compare events with history
+#include "adc_interleave.h"         // ADC1 + ADC2 interleaved capture
 #include "clock_config.h"           // Clock configuration
 #include "board.h"                  // Board-specific init
 #include "pin_mux.h"                // Pin multiplexing
@@ -10,59 +19,211 @@
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
-#define ADC_DMA_CHANNEL      3       // eDMA channel used for ADC transfers
-#define ADC_BUFFER_SIZE      20      // Number of ADC samples per DMA major loop
+#define ADC_BUFFER_SIZE      20      // Number of ADC samples per capture half
+#define ADC_SAMPLE_RATE_HZ   1000U   // Sample rate given by the PWM trigger
+#define ADC_DECIMATION       4U      // One filtered sample every 4 ADC samples
+#define ADC_STATS_WINDOW     1000U   // Samples per statistics window (1 s)
+
+/*
+ * 1: stream every half as a binary frame over the debug UART,
+ *    decode it with tools/adc_telemetry_decode.py
+ * 0: print summary lines
+ */
+#ifndef ADC_TELEMETRY_ENABLE
+#define ADC_TELEMETRY_ENABLE 0
+#endif
+
+/*
+ * 1: event mode, the CPU only wakes up for samples outside
+ *    the window and prints the history around them
+ * 0: stream every sample through the pipeline above
+ */
+#ifndef ADC_EVENT_ENABLE
+#define ADC_EVENT_ENABLE 0
+#endif
+
+#define ADC_EVENT_CHANNEL    9U      // A2 pin, wired to ADC1 and ADC2
+#define ADC_EVENT_HISTORY    1024U   // History ring, power of two
+#define ADC_EVENT_PRE        64U     // Samples printed before the event
+#define ADC_EVENT_POST       64U     // Samples printed from the event on
+
+/*
+ * 1: interleaved mode, ADC1 and ADC2 convert the same pin
+ *    half a period apart, one stream at twice the rate
+ * 0: ADC1 only
+ */
+#ifndef ADC_INTERLEAVE_ENABLE
+#define ADC_INTERLEAVE_ENABLE 0
+#endif
+
+#define ADC_INTERLEAVE_CHANNEL 9U      // A2 pin, wired to ADC1 and ADC2
+#define ADC_INTERLEAVE_RATE_HZ 20000U  // Merged rate, 10 kHz per ADC
+#define ADC_INTERLEAVE_FRAMES  100U    // Samples of each ADC per half
 
 /*******************************************************************************
  * Globals
  ******************************************************************************/
 /*
- * ADC DMA buffer
+ * ADC DMA buffer, two halves of ADC_BUFFER_SIZE samples
  * - Non-cacheable: avoids cache coherency issues between CPU and DMA
  * - 32-byte aligned: matches Cortex-M7 cache line size
  *   (prevents cache line corruption)
  */
-AT_NONCACHEABLE_SECTION_ALIGN(static uint16_t adcBuffer[ADC_BUFFER_SIZE], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint16_t adcBuffer[ADC_SCAN_BUFFER_SAMPLES(1, ADC_BUFFER_SIZE)], 32);
+
+/* Results as read from ADC_ETC, copied into adcBuffer by the DMA */
+AT_NONCACHEABLE_SECTION_ALIGN(static uint16_t adcStaging[ADC_SCAN_BUFFER_SAMPLES(1, ADC_BUFFER_SIZE)], 32);
+
+/*
+ * ADC1 calibration saved by the last boot
+ * - .noinit: kept over a warm reset, garbage after power-up
+ *   (the checksum rejects it then)
+ * - Could live in flash as well, the blob is self-checking
+ */
+static adc_calibration_blob_t g_AdcCalibration __NO_INIT;
+
+/* ADC1 channel 3, the only channel of the scan */
+static const uint32_t adcChannels[] = {3U};
+
+/* ADC_ETC -> adcBuffer scan, channels allocated by the DMA manager */
+static adc_scan_handle_t g_AdcScan;
+
+/* PWM1 submodule 0 -> XBARA -> ADC_ETC trigger 0 */
+static adc_pacer_handle_t g_AdcPacer;
+
+/*
+ * 16-tap low-pass FIR, Q15, cut-off at 1/8 of the sample rate
+ * (Hamming windowed sinc), unity gain at DC
+ */
+static const int16_t adcFilterTaps[] = {-42,  -177, -406, -352, 669,  2961, 5846, 7885,
+                                        7885, 5846, 2961, 669,  -352, -406, -177, -42};
+
+/* Filter history followed by the current half */
+static int16_t adcFilterState[ADC_DECIMATOR_STATE_SAMPLES(ARRAY_SIZE(adcFilterTaps), ADC_BUFFER_SIZE)];
+
+/* Filtered samples of the last half */
+static int16_t adcFiltered[ADC_DECIMATOR_OUTPUT_SAMPLES(ADC_BUFFER_SIZE, ADC_DECIMATION)];
+
+/* ADC samples -> adcFiltered, run by the scan callback */
+static adc_decimator_t g_AdcDecimator;
+
+/* Last filtered sample, Q15 */
+static volatile int16_t g_AdcFilteredLast;
+
+/* ADC samples -> min/max/mean/RMS/crossings per window, run by the scan callback */
+static adc_stats_handle_t g_AdcStats;
+
+/* CPU cycles spent on the statistics of the last half */
+static volatile uint32_t g_AdcStatsCycles;
+
+#if ADC_TELEMETRY_ENABLE
+/*
+ * Telemetry frames (header + CRC) and the TCDs sending them,
+ * read by the DMA so non-cacheable. One frame: a half must be
+ * sent before the scan wraps around to it.
+ */
+AT_NONCACHEABLE_SECTION(static adc_telemetry_frame_t adcTelemetryFrames[1]);
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t adcTelemetryTcd[ADC_TELEMETRY_TCD_COUNT], 32);
+
+/* adcBuffer halves -> LPUART1, channel allocated by the DMA manager */
+static adc_telemetry_handle_t g_AdcTelemetry;
+
+/* Index of the first sample of the next half, the frame timestamp */
+static uint32_t g_AdcSampleIndex;
+#endif
+
+#if ADC_EVENT_ENABLE
+/*
+ * History ring written by ADC1 through the DMA
+ * - Non-cacheable: read by the CPU around the events
+ * - Aligned to its size: wrapped by the destination modulo
+ */
+AT_NONCACHEABLE_SECTION_ALIGN(static uint16_t adcHistory[ADC_EVENT_HISTORY], ADC_EVENT_HISTORY * sizeof(uint16_t));
+
+/* ADC1 -> adcHistory, channel allocated by the DMA manager */
+static adc_capture_handle_t g_AdcHistory;
+
+/* ADC2 compare -> event, position in adcHistory */
+static adc_event_handle_t g_AdcEvent;
+
+/* Window around the last event */
+static uint16_t adcEventWindow[ADC_EVENT_PRE + ADC_EVENT_POST];
+#endif
+
+#if ADC_INTERLEAVE_ENABLE
+/* Results of each ADC, written by its own DMA channel */
+AT_NONCACHEABLE_SECTION_ALIGN(
+    static uint16_t adcInterleaveCapture1[ADC_INTERLEAVE_CAPTURE_SAMPLES(ADC_INTERLEAVE_FRAMES)], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(
+    static uint16_t adcInterleaveCapture2[ADC_INTERLEAVE_CAPTURE_SAMPLES(ADC_INTERLEAVE_FRAMES)], 32);
+
+/* Merged stream, written by the CPU so it may be cached */
+static uint16_t adcInterleaveOutput[ADC_INTERLEAVE_OUTPUT_SAMPLES(ADC_INTERLEAVE_FRAMES)];
 
-/* eDMA channel handle */
-static edma_handle_t g_AdcDmaHandle;
+/* ADC1 + ADC2 -> adcInterleaveOutput */
+static adc_interleave_handle_t g_AdcInterleave;
+
+/* Last merged half, set by the callback */
+static const uint16_t *volatile g_AdcInterleaveSamples;
+static volatile uint32_t g_AdcInterleaveHalves;
+#endif
 
 /*
- * Flag set by DMA interrupt when one full buffer
- * (ADC_BUFFER_SIZE samples) has been transferred
+ * Completed half reported by the scan callback,
+ * read in place by the main loop
  */
 volatile bool g_AdcBufferFull = false;
+static volatile adc_capture_half_t g_AdcReadyHalf;
 
 /*******************************************************************************
  * DMA Callback
  ******************************************************************************/
 /*
- * This callback is executed when the DMA major loop completes
- * (i.e. ADC_BUFFER_SIZE samples have been transferred).
+ * This callback is executed by the half and major interrupts
+ * of the scan (i.e. ADC_BUFFER_SIZE samples have been written
+ * to one half of adcBuffer).
+ *
+ * Nothing has to be re-armed here: the destination rewinds in
+ * hardware and the DMA keeps filling the other half.
  */
-void AdcDmaCallback(edma_handle_t *handle,
-                    void *userData,
-                    bool transferDone,
-                    uint32_t tcds)
+void AdcScanCallback(adc_scan_handle_t *handle,
+                     adc_capture_half_t half,
+                     void *userData)
 {
-    if (transferDone)
+    const uint16_t *samples = ADC_ScanGetPlane(handle, half, 0U);
+    uint32_t count;
+    uint32_t start;
+
+    /*
+     * Filter every half here, so no block is missed.
+     * A few cycles per sample, do NOT PRINTF here.
+     */
+    count = ADC_DecimatorProcess(&g_AdcDecimator, samples, ADC_BUFFER_SIZE, adcFiltered);
+    if (count != 0U)
     {
-        /*
-         * Signal main loop that a full ADC buffer is ready.
-         * Do NOT do heavy processing or PRINTF here.
-         */
-        g_AdcBufferFull = true;
-
-        /*
-         * Restart the DMA major loop.
-         * Without this, the DMA channel would stop accepting
-         * new ADC conversion requests after one buffer.
-         *
-         * ADC continues converting continuously.
-         * DMA is now re-armed to capture the next buffer.
-         */
-        EDMA_StartTransfer(handle);
+        g_AdcFilteredLast = adcFiltered[count - 1U];
     }
+
+    /* One pass over the half, timed with the CPU cycle counter */
+    start = MSDK_GetCpuCycleCount();
+    ADC_StatsUpdate(&g_AdcStats, samples, ADC_BUFFER_SIZE);
+    g_AdcStatsCycles = MSDK_GetCpuCycleCount() - start;
+
+#if ADC_TELEMETRY_ENABLE
+    /*
+     * Queue the half as it is, the DMA sends it in place.
+     * Dropped when the previous frame is still on the wire,
+     * the decoder sees the gap in the sequence numbers.
+     */
+    (void)ADC_TelemetrySubmit(&g_AdcTelemetry, samples, ADC_BUFFER_SIZE, g_AdcSampleIndex);
+    g_AdcSampleIndex += ADC_BUFFER_SIZE;
+#endif
+
+    /*
+     * Signal main loop which half is ready.
+     */
+    g_AdcReadyHalf  = half;
+    g_AdcBufferFull = true;
 }
 
 /*******************************************************************************
@@ -71,9 +232,19 @@ void AdcDmaCallback(edma_handle_t *handle,
 static void ADC_DMA_Init(void)
 {
     adc_config_t adcConfig;                  // ADC global configuration
-    adc_channel_config_t adcChannelConfig;   // ADC channel configuration
+    adc_etc_config_t etcConfig;              // ADC_ETC global configuration
     edma_config_t dmaConfig;                 // eDMA global configuration
-    edma_transfer_config_t transferConfig;   // eDMA transfer configuration
+    adc_scan_config_t scanConfig;            // Scan configuration
+    adc_pacer_config_t pacerConfig;          // Sample rate configuration
+    const adc_pacer_timing_t *timing;        // Achieved sample rate
+    adc_decimator_config_t decimatorConfig;  // Filter configuration
+    adc_stats_config_t statsConfig;          // Statistics configuration
+    adc_calibration_config_t calConfig;      // Saved calibration checks
+    uint32_t calCycles;                      // Cycles spent calibrating
+    bool calRestored;                        // Saved calibration used
+#if ADC_TELEMETRY_ENABLE
+    adc_telemetry_config_t telemetryConfig;  // Telemetry configuration
+#endif
 
     /* Enable peripheral clocks */
     CLOCK_EnableClock(kCLOCK_Adc1);          // Enable ADC1 clock
@@ -83,11 +254,12 @@ static void ADC_DMA_Init(void)
     ADC_GetDefaultConfig(&adcConfig);        // Load default ADC configuration
 
     /*
-     * Continuous conversion:
-     * - ADC keeps converting back-to-back
-     * - Each conversion generates a DMA request
+     * Single conversions:
+     * - Every conversion is started by the PWM trigger
+     * - The sample spacing is set by the PWM clock, not by
+     *   the ADC conversion time
      */
-    adcConfig.enableContinuousConversion = true;
+    adcConfig.enableContinuousConversion = false;
 
     /*
      * Allow ADC result register overwrite if DMA is late.
@@ -102,76 +274,352 @@ static void ADC_DMA_Init(void)
     //adcConfig.enableHighSpeed = true;
 
     ADC_Init(ADC1, &adcConfig);              // Initialize ADC hardware
-    ADC_DoAutoCalibration(ADC1);             // Perform ADC calibration
-    ADC_EnableDMA(ADC1, true);               // Enable DMA requests from ADC
 
-    /* Configure ADC channel */
-    adcChannelConfig.channelNumber = 3;      /* ADC1 channel 3 */
-    adcChannelConfig.enableInterruptOnConversionCompleted = false;
-    /* No ADC interrupt: DMA handles data movement */
+    /*
+     * Restore the calibration of the last boot, calibrate
+     * only when it is missing or stale.
+     * The conditions are fixed here, a product would read
+     * the die temperature (TEMPMON) and the supply.
+     */
+    ADC_CalibrationGetDefaultConfig(&calConfig);
+    calConfig.tags.temperature = 25;
+    calConfig.tags.supplyMv    = 1800U;
 
-    /**************** DMAMUX CONFIG ****************/
-    DMAMUX_Init(DMAMUX);                     // Initialize DMAMUX
+    MSDK_EnableCpuCycleCounter();
+    calCycles = MSDK_GetCpuCycleCount();
+    if (ADC_CalibrationLoadOrCalibrate(ADC1, &g_AdcCalibration, &calConfig, &calRestored) != kStatus_Success)
+    {
+        PRINTF("ADC calibration failed\r\n");
+        return;
+    }
+    calCycles = MSDK_GetCpuCycleCount() - calCycles;
+
+    PRINTF("ADC calibration %s in %u us\r\n",
+           calRestored ? "restored" : "done",
+           calCycles / (SystemCoreClock / 1000000U));
+
+    /**************** ADC_ETC CONFIG ****************/
     /*
-     * Route ADC1 conversion complete signal
-     * to eDMA channel ADC_DMA_CHANNEL
+     * The ADC_ETC trigger starts the conversion and requests
+     * the DMA once the result is ready.
      */
-    DMAMUX_SetSource(DMAMUX, ADC_DMA_CHANNEL, kDmaRequestMuxADC1);
-    DMAMUX_EnableChannel(DMAMUX, ADC_DMA_CHANNEL);
+    ADC_ETC_GetDefaultConfig(&etcConfig);
+    etcConfig.enableTSCBypass = false;
+    etcConfig.dmaMode         = kADC_ETC_TrgDMAWithPulsedSignal;
+    ADC_ETC_Init(ADC_ETC, &etcConfig);
+
+    /**************** DMAMUX CONFIG ****************/
+    DMAMUX_Init(DMAMUX);                     // Initialize DMAMUX
 
     /**************** EDMA CONFIG ****************/
     EDMA_GetDefaultConfig(&dmaConfig);       // Load default DMA config
     EDMA_Init(DMA0, &dmaConfig);             // Initialize DMA controller
+    DMAMGR_Init(DMA0, DMAMUX);               // Channel allocator over DMA0
+
+    /**************** DMA SCAN SETUP ****************/
+    /*
+     * ADC_ETC trigger 0 result -> adcBuffer
+     * - One sample (16 bits) per trigger
+     * - Both halves, the destination rewinds to adcBuffer[0]
+     *   in hardware
+     * - Half and major interrupts report the completed half
+     * - Hardware trigger: the conversions wait for the PWM
+     */
+    ADC_ScanGetDefaultConfig(&scanConfig);
+    scanConfig.base            = ADC1;
+    scanConfig.triggerGroup    = 0U;
+    scanConfig.channels        = adcChannels;
+    scanConfig.channelCount    = ARRAY_SIZE(adcChannels);
+    scanConfig.frames          = ADC_BUFFER_SIZE;
+    scanConfig.staging         = adcStaging;
+    scanConfig.planes          = adcBuffer;
+    scanConfig.softwareTrigger = false;
+    scanConfig.callback        = AdcScanCallback;
+    if (ADC_ScanCreate(&g_AdcScan, DMA0, &scanConfig) != kStatus_Success)
+    {
+        PRINTF("No free eDMA channel for the ADC scan\r\n");
+        return;
+    }
+
+    /**************** FILTER SETUP ****************/
+    /*
+     * Low-pass and keep every ADC_DECIMATION-th sample,
+     * the phase carries over from one half to the next.
+     */
+    ADC_DecimatorGetDefaultConfig(&decimatorConfig);
+    decimatorConfig.coefficients = adcFilterTaps;
+    decimatorConfig.taps         = ARRAY_SIZE(adcFilterTaps);
+    decimatorConfig.factor       = ADC_DECIMATION;
+    decimatorConfig.state        = adcFilterState;
+    decimatorConfig.maxBlock     = ADC_BUFFER_SIZE;
+    ADC_DecimatorInit(&g_AdcDecimator, &decimatorConfig);
 
-    /* Create DMA handle for the selected channel */
-    EDMA_CreateHandle(&g_AdcDmaHandle, DMA0, ADC_DMA_CHANNEL);
+    /**************** STATISTICS SETUP ****************/
+    /*
+     * Min, max, sum, sum of squares and mid-scale crossings
+     * over windows of ADC_STATS_WINDOW samples.
+     */
+    ADC_StatsGetDefaultConfig(&statsConfig);
+    statsConfig.windowSamples = ADC_STATS_WINDOW;
+    statsConfig.threshold     = 2048U;
+    ADC_StatsInit(&g_AdcStats, &statsConfig);
 
-    /* Register DMA callback for major loop completion */
-    EDMA_SetCallback(&g_AdcDmaHandle, AdcDmaCallback, NULL);
+#if ADC_TELEMETRY_ENABLE
+    /**************** TELEMETRY SETUP ****************/
+    /*
+     * Frames go out through the debug UART (LPUART1),
+     * the main loop stops printing.
+     */
+    ADC_TelemetryGetDefaultConfig(&telemetryConfig);
+    telemetryConfig.base       = LPUART1;
+    telemetryConfig.source     = (int32_t)kDmaRequestMuxLPUART1Tx;
+    telemetryConfig.frames     = adcTelemetryFrames;
+    telemetryConfig.frameCount = ARRAY_SIZE(adcTelemetryFrames);
+    telemetryConfig.tcdPool    = adcTelemetryTcd;
+    if (ADC_TelemetryCreate(&g_AdcTelemetry, DMA0, &telemetryConfig) != kStatus_Success)
+    {
+        PRINTF("No free eDMA channel for the telemetry\r\n");
+        return;
+    }
+#endif
 
-    /**************** DMA TRANSFER SETUP ****************/
+    /**************** SAMPLE RATE SETUP ****************/
     /*
-     * Configure DMA transfer:
-     * - Source: ADC result register
-     * - Destination: adcBuffer[]
-     * - Minor loop: 1 ADC sample (16 bits)
-     * - Major loop: ADC_BUFFER_SIZE samples
+     * PWM1 submodule 0 counts one sample period and its
+     * output trigger is routed by XBARA to ADC_ETC trigger 0.
      */
-    EDMA_PrepareTransfer(
-        &transferConfig,
-        (void *)&ADC1->R[0],                 /* Source: ADC result register */
-        sizeof(uint16_t),
-        adcBuffer,                           /* Destination buffer */
-        sizeof(uint16_t),
-        sizeof(uint16_t),                    /* Minor loop = 1 sample */
-        ADC_BUFFER_SIZE * sizeof(uint16_t),  /* Major loop size */
-        kEDMA_PeripheralToMemory
-    );
+    ADC_PacerGetDefaultConfig(&pacerConfig);
+    pacerConfig.rateHz       = ADC_SAMPLE_RATE_HZ;
+    pacerConfig.triggerGroup = 0U;
+    if (ADC_PacerInit(&g_AdcPacer, &pacerConfig) != kStatus_Success)
+    {
+        PRINTF("%u Hz can not be reached by the PWM\r\n", ADC_SAMPLE_RATE_HZ);
+        return;
+    }
+
+    timing = ADC_PacerGetTiming(&g_AdcPacer);
+    PRINTF("Sampling at %u Hz (%d ppm), PWM clock / %u / %u\r\n",
+           timing->rateHz,
+           timing->errorPpm,
+           1U << (uint32_t)timing->prescale,
+           timing->period);
 
-    /* Submit transfer configuration to DMA channel */
-    EDMA_SubmitTransfer(&g_AdcDmaHandle, &transferConfig);
+    /* Start the scan first, so no trigger is missed */
+    ADC_ScanStart(&g_AdcScan);
+    ADC_PacerStart(&g_AdcPacer);
+}
+
+#if ADC_EVENT_ENABLE
+/*******************************************************************************
+ * Event mode
+ ******************************************************************************/
+/*
+ * ADC2 conversion in the window: nothing happens.
+ * ADC2 conversion outside the window: this interrupt, once,
+ * until the main loop read the window.
+ */
+void ADC2_IRQHandler(void)
+{
+    ADC_EventHandleIRQ(&g_AdcEvent);
+    SDK_ISR_EXIT_BARRIER;
+}
+
+/*
+ * Both ADCs convert the same pin continuously:
+ * - ADC1 -> DMA -> adcHistory, no CPU
+ * - ADC2 with hardware compare, only out-of-window
+ *   results complete and interrupt
+ * The compare discards the other results, hence two ADCs.
+ */
+static void ADC_EventModeRun(void)
+{
+    adc_config_t adcConfig;                  // ADC global configuration
+    edma_config_t dmaConfig;                 // eDMA global configuration
+    adc_capture_config_t captureConfig;      // History configuration
+    adc_event_config_t eventConfig;          // Detector configuration
+    adc_channel_config_t channelConfig;      // History channel
+    uint32_t value;
+    uint32_t i;
+    status_t status;
+
+    CLOCK_EnableClock(kCLOCK_Adc1);          // Enable ADC1 clock
+    CLOCK_EnableClock(kCLOCK_Adc2);          // Enable ADC2 clock
+    CLOCK_EnableClock(kCLOCK_Dma);           // Enable DMA clock
 
     /*
-     * Enable interrupt at the end of each major loop
-     * (i.e. after ADC_BUFFER_SIZE samples)
+     * Same settings on both ADCs, so they convert at the
+     * same rate and the history matches the detector.
      */
-    EDMA_EnableChannelInterrupts(
-            DMA0,
-            ADC_DMA_CHANNEL,
-            kEDMA_MajorInterruptEnable
-        );
+    ADC_GetDefaultConfig(&adcConfig);
+    adcConfig.enableContinuousConversion = true;
+    adcConfig.enableOverWrite            = true;
+    ADC_Init(ADC1, &adcConfig);
+    ADC_Init(ADC2, &adcConfig);
+    ADC_SetHardwareAverageConfig(ADC1, kADC_HardwareAverageCount32);
+    ADC_SetHardwareAverageConfig(ADC2, kADC_HardwareAverageCount32);
+    if ((ADC_DoAutoCalibration(ADC1) != kStatus_Success) || (ADC_DoAutoCalibration(ADC2) != kStatus_Success))
+    {
+        PRINTF("ADC calibration failed\r\n");
+        return;
+    }
+
+    DMAMUX_Init(DMAMUX);
+    EDMA_GetDefaultConfig(&dmaConfig);
+    EDMA_Init(DMA0, &dmaConfig);
+    DMAMGR_Init(DMA0, DMAMUX);
+
+    /* History: one interrupt per ring, the rest is DMA only */
+    ADC_CaptureGetDefaultConfig(&captureConfig);
+    captureConfig.base    = ADC1;
+    captureConfig.mode    = kADC_CaptureRing;
+    captureConfig.buffer  = adcHistory;
+    captureConfig.samples = ADC_EVENT_HISTORY;
+    if (ADC_CaptureCreate(&g_AdcHistory, DMA0, &captureConfig) != kStatus_Success)
+    {
+        PRINTF("No free eDMA channel for the ADC history\r\n");
+        return;
+    }
+
+    /* Detector: outside 1024..3072 (default window) */
+    ADC_EventGetDefaultConfig(&eventConfig);
+    eventConfig.base        = ADC2;
+    eventConfig.channel     = ADC_EVENT_CHANNEL;
+    eventConfig.history     = &g_AdcHistory;
+    eventConfig.preSamples  = ADC_EVENT_PRE;
+    eventConfig.postSamples = ADC_EVENT_POST;
+    ADC_EventCreate(&g_AdcEvent, &eventConfig);
+    EnableIRQ(ADC2_IRQn);
+
+    /* Start the history first, so the first event has its context */
+    ADC_CaptureStart(&g_AdcHistory);
+    channelConfig.channelNumber                        = ADC_EVENT_CHANNEL;
+    channelConfig.enableInterruptOnConversionCompleted = false;
+    ADC_SetChannelConfig(ADC1, 0U, &channelConfig);
+    ADC_EventArm(&g_AdcEvent);
+
+    PRINTF("Waiting for samples outside %u..%u\r\n", eventConfig.compare.value1, eventConfig.compare.value2);
+
+    while (1)
+    {
+        /* Woken up by the events and once per history ring */
+        __WFI();
+
+        status = ADC_EventRead(&g_AdcEvent, adcEventWindow, &value);
+        if (status == kStatus_ADC_EventNotReady)
+        {
+            continue;
+        }
+
+        PRINTF("Event %u: value = %u%s\r\n",
+               ADC_EventGetCount(&g_AdcEvent),
+               value,
+               (status == kStatus_Success) ? "" : ", history overwritten");
+        for (i = 0U; i < ARRAY_SIZE(adcEventWindow); i++)
+        {
+            PRINTF("%s%u", (i == ADC_EVENT_PRE) ? " | " : " ", adcEventWindow[i]);
+        }
+        PRINTF("\r\n");
+    }
+}
+#endif
+
+#if ADC_INTERLEAVE_ENABLE
+/*******************************************************************************
+ * Interleaved mode
+ ******************************************************************************/
+/* Merged half ready, ADC1 samples at even indexes */
+void AdcInterleaveCallback(adc_interleave_handle_t *handle,
+                           const uint16_t *samples,
+                           uint32_t count,
+                           void *userData)
+{
+    g_AdcInterleaveSamples = samples;
+    g_AdcInterleaveHalves++;
+}
+
+/*
+ * PWM1 submodule 0 -> ADC_ETC trigger 0 -> ADC1
+ * PWM1 submodule 1 -> ADC_ETC trigger 4 -> ADC2, half a period later
+ * Each ADC result -> its own DMA channel, the callback
+ * gets both merged.
+ */
+static void ADC_InterleaveModeRun(void)
+{
+    adc_config_t adcConfig;                  // ADC global configuration
+    adc_etc_config_t etcConfig;              // ADC_ETC global configuration
+    edma_config_t dmaConfig;                 // eDMA global configuration
+    adc_interleave_config_t interleaveConfig; // Interleave configuration
+    const uint16_t *samples;
+    uint32_t reported = 0U;
+
+    CLOCK_EnableClock(kCLOCK_Adc1);          // Enable ADC1 clock
+    CLOCK_EnableClock(kCLOCK_Adc2);          // Enable ADC2 clock
+    CLOCK_EnableClock(kCLOCK_Dma);           // Enable DMA clock
+
+    /* Same settings on both ADCs, only the triggers differ */
+    ADC_GetDefaultConfig(&adcConfig);
+    adcConfig.enableOverWrite = true;
+    ADC_Init(ADC1, &adcConfig);
+    ADC_Init(ADC2, &adcConfig);
+    if ((ADC_DoAutoCalibration(ADC1) != kStatus_Success) || (ADC_DoAutoCalibration(ADC2) != kStatus_Success))
+    {
+        PRINTF("ADC calibration failed\r\n");
+        return;
+    }
+
+    ADC_ETC_GetDefaultConfig(&etcConfig);
+    etcConfig.enableTSCBypass = false;
+    ADC_ETC_Init(ADC_ETC, &etcConfig);
 
-    /* Start the DMA channel */
-    EDMA_StartTransfer(&g_AdcDmaHandle);
+    DMAMUX_Init(DMAMUX);
+    EDMA_GetDefaultConfig(&dmaConfig);
+    EDMA_Init(DMA0, &dmaConfig);
+    DMAMGR_Init(DMA0, DMAMUX);
 
-    /**************** START FIRST ADC CONVERSION ****************/
     /*
-     * Writing channel configuration triggers
-     * the first ADC conversion.
-     * After that, ADC runs continuously.
+     * No correction here. With two known levels on the pin,
+     * ADC_InterleaveComputeCorrection gives the one of ADC2,
+     * to be kept with the calibration.
      */
-    ADC_SetChannelConfig(ADC1, 0, &adcChannelConfig);
+    ADC_InterleaveGetDefaultConfig(&interleaveConfig);
+    interleaveConfig.channel     = ADC_INTERLEAVE_CHANNEL;
+    interleaveConfig.rateHz      = ADC_INTERLEAVE_RATE_HZ;
+    interleaveConfig.frames      = ADC_INTERLEAVE_FRAMES;
+    interleaveConfig.captures[0] = adcInterleaveCapture1;
+    interleaveConfig.captures[1] = adcInterleaveCapture2;
+    interleaveConfig.output      = adcInterleaveOutput;
+    interleaveConfig.callback    = AdcInterleaveCallback;
+    if (ADC_InterleaveCreate(&g_AdcInterleave, DMA0, &interleaveConfig) != kStatus_Success)
+    {
+        PRINTF("Interleaved capture can not be set up\r\n");
+        return;
+    }
+
+    PRINTF("Interleaved sampling at %u Hz\r\n", ADC_InterleaveGetRate(&g_AdcInterleave));
+    ADC_InterleaveStart(&g_AdcInterleave);
+
+    while (1)
+    {
+        __WFI();
+
+        /* About one line per second */
+        if ((g_AdcInterleaveHalves - reported) < (ADC_INTERLEAVE_RATE_HZ / (2U * ADC_INTERLEAVE_FRAMES)))
+        {
+            continue;
+        }
+        reported = g_AdcInterleaveHalves;
+        samples  = g_AdcInterleaveSamples;
+
+        PRINTF("Half %u: ADC1 = %u, ADC2 = %u, ADC1 = %u, ADC2 = %u, overruns = %u\r\n",
+               reported,
+               samples[0],
+               samples[1],
+               samples[2],
+               samples[3],
+               ADC_InterleaveGetOverruns(&g_AdcInterleave));
+    }
 }
+#endif
 
 /*******************************************************************************
  * Main
@@ -182,36 +630,83 @@ int main(void)
     BOARD_InitBootClocks();                  // Initialize clocks
     BOARD_InitDebugConsole();                // Initialize UART / PRINTF
 
-    PRINTF("Software-triggered ADC + DMA example (manual re-trigger)\r\n");
+    PRINTF("PWM paced ADC + DMA ping-pong capture example\r\n");
+
+#if ADC_EVENT_ENABLE
+    ADC_EventModeRun();                      // Event mode, returns on errors only
+    while (1)
+    {
+    }
+#endif
+
+#if ADC_INTERLEAVE_ENABLE
+    ADC_InterleaveModeRun();                 // Interleaved mode, returns on errors only
+    while (1)
+    {
+    }
+#endif
 
-    ADC_DMA_Init();                          // Initialize ADC + DMA pipeline
+    ADC_DMA_Init();                          // Initialize ADC + DMA capture
 
+#if ADC_TELEMETRY_ENABLE
     /*
-     * Local buffer used to copy DMA data before printing.
-     * Prevents reading data while DMA is overwriting it.
+     * The UART carries the frames now, PRINTF would
+     * corrupt them. Everything runs from interrupts.
      */
-    uint16_t localCopy[ADC_BUFFER_SIZE];
+    while (1)
+    {
+        __WFI();
+    }
+#else
+    const uint16_t *samples;
+    uint16_t first;
+    uint16_t last;
+    adc_capture_half_t half;
+    adc_stats_result_t stats;
+    uint32_t primask;
 
     while (1)
     {
         if (g_AdcBufferFull)
         {
-            /* Clear flag first to avoid missing next buffer */
+            /* Take the half and clear the flag together, the callback may report the next one */
+            primask         = DisableGlobalIRQ();
+            half            = g_AdcReadyHalf;
             g_AdcBufferFull = false;
+            stats           = *ADC_StatsGetLast(&g_AdcStats);
+            EnableGlobalIRQ(primask);
 
             /*
-             * Copy ADC samples locally.
-             * DMA may overwrite adcBuffer while we print.
+             * Read the completed half in place.
+             * DMA fills the other half meanwhile, read this
+             * one before it wraps around to it.
              */
-            memcpy(localCopy, adcBuffer, sizeof(localCopy));
+            samples = ADC_ScanGetPlane(&g_AdcScan, half, 0U);
+            first   = samples[0];
+            last    = samples[ADC_BUFFER_SIZE - 1];
 
             /*
              * Print only summary values.
              * Printing too much data would stall the system.
+             * Halves whose interrupt came too late to be reported
+             * are counted as overruns.
              */
-            PRINTF("First sample = %d, Last sample = %d\r\n",
-                   localCopy[0],
-                   localCopy[ADC_BUFFER_SIZE - 1]);
+            PRINTF("Half %c: first sample = %d, last sample = %d, filtered = %d, overruns = %u\r\n",
+                   (half == kADC_CaptureHalfA) ? 'A' : 'B',
+                   first,
+                   last,
+                   g_AdcFilteredLast,
+                   ADC_ScanGetOverruns(&g_AdcScan));
+
+            /* Statistics of the last complete window */
+            PRINTF("Window: min = %u, max = %u, mean = %u, rms = %u, crossings = %u, %u cycles / %u samples\r\n",
+                   stats.min,
+                   stats.max,
+                   ADC_StatsGetMean(&stats),
+                   ADC_StatsGetRms(&stats),
+                   stats.crossings,
+                   g_AdcStatsCycles,
+                   ADC_BUFFER_SIZE);
 
             /*
              * Artificial delay to slow down printing.
@@ -220,4 +715,5 @@ int main(void)
             for (volatile uint32_t i = 0; i < 10000000; i++) __NOP();
         }
     }
+#endif
 }
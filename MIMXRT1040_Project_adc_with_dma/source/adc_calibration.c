@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_calibration.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* FNV-1a 32-bit parameters. */
+#define ADC_CALIBRATION_FNV_OFFSET 0x811C9DC5U
+#define ADC_CALIBRATION_FNV_PRIME  0x01000193U
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t ADC_CalibrationChecksum(const adc_calibration_blob_t *blob)
+{
+    const uint8_t *data = (const uint8_t *)blob;
+    uint32_t hash       = ADC_CALIBRATION_FNV_OFFSET;
+    uint32_t i;
+
+    for (i = 0U; i < offsetof(adc_calibration_blob_t, checksum); i++)
+    {
+        hash = (hash ^ data[i]) * ADC_CALIBRATION_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static bool ADC_CalibrationWithin(int32_t saved, int32_t current, uint32_t maxDelta)
+{
+    int32_t delta = current - saved;
+
+    return ((uint32_t)((delta < 0) ? -delta : delta) <= maxDelta);
+}
+
+void ADC_CalibrationGetDefaultConfig(adc_calibration_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->maxTemperatureDelta = 10U;
+    config->maxSupplyDeltaMv    = 100U;
+}
+
+void ADC_CalibrationExport(ADC_Type *base, const adc_calibration_tags_t *tags, adc_calibration_blob_t *blob)
+{
+    assert(tags != NULL);
+    assert(blob != NULL);
+
+    /* Cleared first, so the padding is part of the checksum too. */
+    (void)memset(blob, 0, sizeof(*blob));
+    blob->magic       = ADC_CALIBRATION_MAGIC;
+    blob->version     = ADC_CALIBRATION_VERSION;
+    blob->size        = (uint16_t)sizeof(*blob);
+    blob->instance    = (uint32_t)base;
+    blob->calibration = ADC_GetCalibrationValue(base);
+    blob->offset      = base->OFS;
+    blob->tags        = *tags;
+    blob->checksum    = ADC_CalibrationChecksum(blob);
+}
+
+status_t ADC_CalibrationRestore(ADC_Type *base, const adc_calibration_blob_t *blob,
+                                const adc_calibration_config_t *config)
+{
+    assert(blob != NULL);
+    assert(config != NULL);
+
+    if ((blob->magic != ADC_CALIBRATION_MAGIC) || (blob->version != ADC_CALIBRATION_VERSION) ||
+        (blob->size != sizeof(*blob)) || (blob->instance != (uint32_t)base) ||
+        (blob->checksum != ADC_CalibrationChecksum(blob)))
+    {
+        return kStatus_ADC_CalibrationStale;
+    }
+
+    /* The calibration drifts with the temperature and the supply. */
+    if ((!ADC_CalibrationWithin(blob->tags.temperature, config->tags.temperature, config->maxTemperatureDelta)) ||
+        (!ADC_CalibrationWithin((int32_t)blob->tags.supplyMv, (int32_t)config->tags.supplyMv,
+                                config->maxSupplyDeltaMv)))
+    {
+        return kStatus_ADC_CalibrationStale;
+    }
+
+    ADC_SetCalibrationValue(base, blob->calibration);
+    base->OFS = blob->offset;
+
+    return kStatus_Success;
+}
+
+status_t ADC_CalibrationLoadOrCalibrate(ADC_Type *base,
+                                        adc_calibration_blob_t *blob,
+                                        const adc_calibration_config_t *config,
+                                        bool *restored)
+{
+    assert(blob != NULL);
+    assert(config != NULL);
+
+    status_t status;
+
+    if (restored != NULL)
+    {
+        *restored = false;
+    }
+
+    if (ADC_CalibrationRestore(base, blob, config) == kStatus_Success)
+    {
+        if (restored != NULL)
+        {
+            *restored = true;
+        }
+        return kStatus_Success;
+    }
+
+    status = ADC_DoAutoCalibration(base);
+    if (status == kStatus_Success)
+    {
+        ADC_CalibrationExport(base, &config->tags, blob);
+    }
+
+    return status;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_CALIBRATION_H_
+#define _ADC_CALIBRATION_H_
+
+#include "fsl_adc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief ADC calibration status codes. */
+enum
+{
+    kStatus_ADC_CalibrationStale = MAKE_STATUS(kStatusGroup_ApplicationRangeStart, 2), /*!< The saved calibration is
+                                                                                            invalid or was taken in
+                                                                                            other conditions. */
+};
+
+/*! @brief First word of a valid calibration blob, "ACAL". */
+#define ADC_CALIBRATION_MAGIC 0x4C414341U
+/*! @brief Version of the blob layout. */
+#define ADC_CALIBRATION_VERSION 1U
+
+/*! @brief Operating conditions a calibration is valid for, measured by the application. */
+typedef struct _adc_calibration_tags
+{
+    int16_t temperature; /*!< Die temperature, in degrees Celsius. */
+    uint16_t supplyMv;   /*!< Analog supply, in mV. */
+} adc_calibration_tags_t;
+
+/*!
+ * @brief Saved calibration, kept in flash or in a RAM section not cleared at reset.
+ *
+ * The blob only suits the ADC instance and the device it was exported from.
+ */
+typedef struct _adc_calibration_blob
+{
+    uint32_t magic;              /*!< ADC_CALIBRATION_MAGIC. */
+    uint16_t version;            /*!< ADC_CALIBRATION_VERSION. */
+    uint16_t size;               /*!< Size of the blob in bytes. */
+    uint32_t instance;           /*!< Base address of the ADC. */
+    uint32_t calibration;        /*!< Calibration code, see ADC_GetCalibrationValue. */
+    uint32_t offset;             /*!< Offset correction register. */
+    adc_calibration_tags_t tags; /*!< Conditions during the calibration. */
+    uint32_t checksum;           /*!< FNV-1a of the bytes before this field. */
+} adc_calibration_blob_t;
+
+/*! @brief Conditions accepted for a saved calibration. */
+typedef struct _adc_calibration_config
+{
+    adc_calibration_tags_t tags;  /*!< Current conditions. */
+    uint16_t maxTemperatureDelta; /*!< Largest temperature change since the calibration, in degrees Celsius. */
+    uint16_t maxSupplyDeltaMv;    /*!< Largest supply change since the calibration, in mV. */
+} adc_calibration_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default calibration configuration.
+ *
+ * The default configuration accepts a calibration taken within 10 degrees Celsius and 100 mV, the current
+ * conditions have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_CalibrationGetDefaultConfig(adc_calibration_config_t *config);
+
+/*!
+ * @brief Saves the calibration of an ADC into a blob.
+ *
+ * Called after ADC_DoAutoCalibration succeeded. The blob holds the calibration code, the offset correction and the
+ * conditions of the calibration, and is protected by a checksum.
+ *
+ * @param base ADC peripheral base address.
+ * @param tags Conditions during the calibration.
+ * @param blob Pointer to the blob to fill.
+ */
+void ADC_CalibrationExport(ADC_Type *base, const adc_calibration_tags_t *tags, adc_calibration_blob_t *blob);
+
+/*!
+ * @brief Loads a saved calibration into an ADC.
+ *
+ * The blob is checked first: magic, version, size, ADC instance and checksum, then the tags against the current
+ * conditions. The ADC registers are only written when all checks pass.
+ *
+ * @param base ADC peripheral base address, initialized by ADC_Init.
+ * @param blob Pointer to the saved blob.
+ * @param config Pointer to the current conditions and the accepted changes.
+ * @retval kStatus_Success The calibration is restored.
+ * @retval kStatus_ADC_CalibrationStale The blob is invalid or out of the accepted conditions, the ADC is unchanged.
+ */
+status_t ADC_CalibrationRestore(ADC_Type *base, const adc_calibration_blob_t *blob,
+                                const adc_calibration_config_t *config);
+
+/*!
+ * @brief Restores a saved calibration, or calibrates and saves the result when it is stale.
+ *
+ * Replaces ADC_DoAutoCalibration at start-up. A restore only writes two registers, while a calibration blocks until
+ * the hardware is done.
+ *
+ * @param base ADC peripheral base address, initialized by ADC_Init.
+ * @param blob Pointer to the saved blob, rewritten after a new calibration.
+ * @param config Pointer to the current conditions and the accepted changes.
+ * @param restored Set to true when the saved calibration is used, can be NULL.
+ * @retval kStatus_Success The ADC is calibrated.
+ * @retval kStatus_Fail The calibration failed, the blob is unchanged.
+ */
+status_t ADC_CalibrationLoadOrCalibrate(ADC_Type *base,
+                                        adc_calibration_blob_t *blob,
+                                        const adc_calibration_config_t *config,
+                                        bool *restored);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_CALIBRATION_H_ */
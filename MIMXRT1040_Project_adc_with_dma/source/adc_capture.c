@@ -0,0 +1,250 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_capture.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void ADC_CaptureCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void ADC_CaptureCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    adc_capture_handle_t *capture = (adc_capture_handle_t *)param;
+    uint32_t citer;
+    uint32_t writing;
+    uint32_t ready;
+
+    if (capture->mode == kADC_CaptureRing)
+    {
+        capture->wraps++;
+        return;
+    }
+
+    /*
+     * The next request clears DONE again and the interrupts may merge, so the half is taken from the DMA position.
+     * CITER counts the samples left in the major loop, the half the DMA writes is the one not ready.
+     */
+    citer   = capture->dma->TCD[capture->channel].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK;
+    writing = (citer > capture->halfSamples) ? (uint32_t)kADC_CaptureHalfA : (uint32_t)kADC_CaptureHalfB;
+    ready   = writing ^ 1U;
+
+    /* The interrupts of both halves merged, the expected half is overwritten already. */
+    if (ready != capture->nextHalf)
+    {
+        capture->overruns++;
+    }
+    /* The consumer still reads the half the DMA just started to write. */
+    if ((capture->heldHalves & (1UL << writing)) != 0U)
+    {
+        capture->overruns++;
+    }
+    capture->nextHalf = (uint8_t)writing;
+    capture->heldHalves |= (1UL << ready);
+    capture->halves++;
+
+    if (capture->callback != NULL)
+    {
+        capture->callback(capture, (adc_capture_half_t)ready, &capture->buffer[ready * capture->halfSamples],
+                          capture->halfSamples, capture->userData);
+    }
+}
+
+void ADC_CaptureGetDefaultConfig(adc_capture_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base     = ADC1;
+    config->source   = (int32_t)kDmaRequestMuxADC1;
+    config->priority = kDMAMGR_PriorityHigh;
+}
+
+status_t ADC_CaptureCreate(adc_capture_handle_t *handle, DMA_Type *dma, const adc_capture_config_t *config)
+{
+    assert(handle != NULL);
+    assert(dma != NULL);
+    assert(config != NULL);
+    assert(config->buffer != NULL);
+    assert((config->samples >= 2U) && ((config->samples & 1U) == 0U));
+    assert(config->samples <= DMA_CITER_ELINKNO_CITER_MASK);
+    /* The modulo keeps the upper address bits, so the ring is a power of two aligned to its size. */
+    assert((config->mode != kADC_CaptureRing) || ((config->samples & (config->samples - 1U)) == 0U));
+    assert((config->mode != kADC_CaptureRing) ||
+           (((uint32_t)config->buffer & (config->samples * sizeof(uint16_t) - 1U)) == 0U));
+
+    dmamgr_channel_config_t channelConfig;
+    edma_transfer_config_t transferConfig;
+    uint32_t bytes = config->samples * sizeof(uint16_t);
+    status_t status;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base        = config->base;
+    handle->dma         = dma;
+    handle->mode        = config->mode;
+    handle->buffer      = config->buffer;
+    handle->samples     = config->samples;
+    handle->halfSamples = config->samples / 2U;
+    handle->callback    = config->callback;
+    handle->userData    = config->userData;
+
+    /* The channel interrupts twice per buffer in ping-pong mode. */
+    DMAMGR_GetDefaultChannelConfig(&channelConfig);
+    channelConfig.source   = config->source;
+    channelConfig.priority = config->priority;
+    channelConfig.busy     = (config->mode == kADC_CapturePingPong);
+    status                 = DMAMGR_RequestChannel(&channelConfig, &handle->channel);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    /* EDMA_CreateHandle clears the TCD, so the handle comes before the TCD is loaded. */
+    EDMA_CreateHandle(&handle->edmaHandle, dma, handle->channel);
+    EDMA_SetCallback(&handle->edmaHandle, ADC_CaptureCallback, handle);
+
+    /* One result per request, the major loop covers the whole buffer. */
+    EDMA_PrepareTransfer(&transferConfig, (void *)(uint32_t)&config->base->R[config->channelGroup], sizeof(uint16_t),
+                         config->buffer, sizeof(uint16_t), sizeof(uint16_t), bytes, kEDMA_PeripheralToMemory);
+    EDMA_ResetChannel(dma, handle->channel);
+    EDMA_SetTransferConfig(dma, handle->channel, &transferConfig, NULL);
+    if (config->mode == kADC_CaptureRing)
+    {
+        /* The modulo wraps the destination, it already points to the start of the ring after the major loop. */
+        EDMA_SetModulo(dma, handle->channel, kEDMA_ModuloDisable, (edma_modulo_t)(31U - (uint32_t)__CLZ(bytes)));
+        EDMA_EnableChannelInterrupts(dma, handle->channel, (uint32_t)kEDMA_MajorInterruptEnable);
+    }
+    else
+    {
+        EDMA_SetMajorOffsetConfig(dma, handle->channel, 0, -(int32_t)bytes);
+        EDMA_EnableChannelInterrupts(dma, handle->channel,
+                                     (uint32_t)kEDMA_HalfInterruptEnable | (uint32_t)kEDMA_MajorInterruptEnable);
+    }
+    /* EDMA_ResetChannel sets the auto disable request feature, the capture keeps its request. */
+    dma->TCD[handle->channel].CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
+
+    ADC_EnableDMA(config->base, true);
+
+    return kStatus_Success;
+}
+
+void ADC_CaptureDestroy(adc_capture_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_CaptureStop(handle);
+    EDMA_AbortTransfer(&handle->edmaHandle);
+    (void)DMAMGR_ReleaseChannel(handle->channel);
+}
+
+void ADC_CaptureStart(adc_capture_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    EDMA_ClearChannelStatusFlags(handle->dma, handle->channel, (uint32_t)kEDMA_ErrorFlag);
+    EDMA_EnableChannelRequest(handle->dma, handle->channel);
+}
+
+void ADC_CaptureStop(adc_capture_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    EDMA_DisableChannelRequest(handle->dma, handle->channel);
+}
+
+void ADC_CaptureReleaseHalf(adc_capture_handle_t *handle, adc_capture_half_t half)
+{
+    assert(handle != NULL);
+
+    uint32_t primask;
+
+    primask = DisableGlobalIRQ();
+    handle->heldHalves &= ~(1UL << (uint32_t)half);
+    EnableGlobalIRQ(primask);
+}
+
+uint32_t ADC_CaptureRingGetPosition(adc_capture_handle_t *handle)
+{
+    assert(handle != NULL);
+    assert(handle->mode == kADC_CaptureRing);
+
+    uint32_t mask = 1UL << handle->channel;
+    uint32_t wraps;
+    uint32_t remaining;
+    bool pending;
+
+    /*
+     * The wrap count and CITER can not be read together. A completed major loop is either counted by the
+     * interrupt, or still pending and then CITER is already reloaded. Read again when either changed meanwhile.
+     */
+    do
+    {
+        wraps     = handle->wraps;
+        pending   = ((handle->dma->INT & mask) != 0U);
+        remaining = EDMA_GetRemainingMajorLoopCount(handle->dma, handle->channel);
+    } while ((wraps != handle->wraps) || (pending != ((handle->dma->INT & mask) != 0U)));
+
+    /* DONE reads as no sample left until the next request reloads CITER. */
+    if (remaining == 0U)
+    {
+        remaining = handle->samples;
+    }
+    if (pending)
+    {
+        wraps++;
+    }
+
+    return (wraps * handle->samples) + (handle->samples - remaining);
+}
+
+status_t ADC_CaptureRingPeek(adc_capture_handle_t *handle, const uint16_t **samples, uint32_t *count)
+{
+    assert(handle != NULL);
+    assert(samples != NULL);
+    assert(count != NULL);
+
+    uint32_t producer = ADC_CaptureRingGetPosition(handle);
+    uint32_t unread   = producer - handle->readPosition;
+    uint32_t index    = handle->readPosition & (handle->samples - 1U);
+
+    /* The oldest unread sample is being overwritten when the producer is a whole ring ahead. */
+    if (unread >= handle->samples)
+    {
+        handle->overruns++;
+        handle->readPosition = producer;
+        *count               = 0U;
+        return kStatus_ADC_CaptureOverrun;
+    }
+
+    *samples = &handle->buffer[index];
+    *count   = ((index + unread) > handle->samples) ? (handle->samples - index) : unread;
+
+    return kStatus_Success;
+}
+
+status_t ADC_CaptureRingConsume(adc_capture_handle_t *handle, uint32_t count)
+{
+    assert(handle != NULL);
+
+    uint32_t start = handle->readPosition;
+
+    handle->readPosition += count;
+
+    /* The consumed samples were read in place, the producer may have wrapped onto them meanwhile. */
+    if ((ADC_CaptureRingGetPosition(handle) - start) > handle->samples)
+    {
+        handle->overruns++;
+        return kStatus_ADC_CaptureOverrun;
+    }
+
+    return kStatus_Success;
+}
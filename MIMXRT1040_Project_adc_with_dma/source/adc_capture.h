@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_CAPTURE_H_
+#define _ADC_CAPTURE_H_
+
+#include "fsl_adc.h"
+#include "fsl_edma.h"
+#include "fsl_dma_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief ADC capture status codes. */
+enum
+{
+    kStatus_ADC_CaptureOverrun = MAKE_STATUS(kStatusGroup_ApplicationRangeStart, 0), /*!< The DMA overwrote unread
+                                                                                          samples. */
+};
+
+/*! @brief Capture buffer usage. */
+typedef enum _adc_capture_mode
+{
+    kADC_CapturePingPong = 0U, /*!< Two halves, the completed half is reported by the callback. */
+    kADC_CaptureRing,          /*!< Power-of-two ring wrapped by the destination modulo, read with
+                                    ADC_CaptureRingPeek and ADC_CaptureRingConsume. */
+} adc_capture_mode_t;
+
+/*! @brief Half of the capture buffer. */
+typedef enum _adc_capture_half
+{
+    kADC_CaptureHalfA = 0U, /*!< First half of the buffer. */
+    kADC_CaptureHalfB = 1U, /*!< Second half of the buffer. */
+} adc_capture_half_t;
+
+/*! @brief ADC capture handle. */
+typedef struct _adc_capture_handle adc_capture_handle_t;
+
+/*!
+ * @brief Half ready callback, called from the eDMA interrupt in ping-pong mode.
+ *
+ * The samples stay valid until the DMA wraps around to them, which is one half buffer time after the call.
+ * Call ADC_CaptureReleaseHalf when they are consumed.
+ */
+typedef void (*adc_capture_callback_t)(
+    adc_capture_handle_t *handle, adc_capture_half_t half, const uint16_t *samples, uint32_t count, void *userData);
+
+/*! @brief ADC capture configuration. */
+typedef struct _adc_capture_config
+{
+    ADC_Type *base;                  /*!< ADC peripheral, already initialized and calibrated. */
+    uint32_t channelGroup;           /*!< Conversion control group whose result register is captured. */
+    int32_t source;                  /*!< DMAMUX request source of the ADC, see dma_request_source_t. */
+    adc_capture_mode_t mode;         /*!< Capture buffer usage. */
+    uint16_t *buffer;                /*!< Capture buffer, both halves, or the ring aligned to its size. */
+    uint32_t samples;                /*!< Samples of the whole buffer, even and up to DMA_CITER_ELINKNO_CITER_MASK.
+                                          A power of two in ring mode. */
+    dmamgr_priority_t priority;      /*!< Placement of the capture channel. */
+    adc_capture_callback_t callback; /*!< Half ready callback, can be NULL. */
+    void *userData;                  /*!< Parameter passed to the callback. */
+} adc_capture_config_t;
+
+/*! @brief ADC capture handle, users shall not touch the values inside. */
+struct _adc_capture_handle
+{
+    ADC_Type *base;                  /*!< ADC peripheral. */
+    DMA_Type *dma;                   /*!< eDMA peripheral. */
+    uint32_t channel;                /*!< eDMA channel. */
+    edma_handle_t edmaHandle;        /*!< eDMA handle of the channel. */
+    adc_capture_mode_t mode;         /*!< Capture buffer usage. */
+    uint16_t *buffer;                /*!< Capture buffer. */
+    uint32_t samples;                /*!< Samples of the whole buffer. */
+    uint32_t halfSamples;            /*!< Samples of one half. */
+    adc_capture_callback_t callback; /*!< Half ready callback. */
+    void *userData;                  /*!< Parameter passed to the callback. */
+    volatile uint32_t heldHalves;    /*!< Bit n is set while half n is reported and not released. */
+    volatile uint32_t halves;        /*!< Number of reported halves. */
+    volatile uint32_t overruns;      /*!< Number of overruns, see ADC_CaptureGetOverruns. */
+    uint8_t nextHalf;                /*!< Half expected to complete next. */
+    volatile uint32_t wraps;         /*!< Number of completed rings, ring mode only. */
+    uint32_t readPosition;           /*!< Samples consumed since the start, ring mode only. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default capture configuration.
+ *
+ * The default configuration captures conversion control group 0 of ADC1 in ping-pong mode at high channel
+ * priority, the buffer, its size and the callback have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_CaptureGetDefaultConfig(adc_capture_config_t *config);
+
+/*!
+ * @brief Creates a capture.
+ *
+ * A channel is requested from the DMA manager, which must be initialized by DMAMGR_Init, and routed to the ADC
+ * request. Its TCD moves one result per request into the buffer and never has to be re-armed.
+ *
+ * In ping-pong mode the destination rewinds after the major loop, and the half and major interrupts report the
+ * completed half while the DMA fills the other one, the consumer reads it in place.
+ *
+ * In ring mode the destination modulo wraps the address in the ring, which must be aligned to its size in
+ * bytes. The only interrupt is the major loop one, once per ring, which counts the wraps. The consumer polls
+ * with ADC_CaptureRingPeek, the producer position comes from the remaining major loop count.
+ *
+ * @param handle Pointer to the capture handle.
+ * @param dma eDMA peripheral base address, initialized by EDMA_Init.
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The capture is ready, call ADC_CaptureStart to run it.
+ * @retval kStatus_DMAMGR_NoFreeChannel No channel is free.
+ * @note The buffer should be non-cacheable, otherwise the consumer has to invalidate the half before reading it.
+ */
+status_t ADC_CaptureCreate(adc_capture_handle_t *handle, DMA_Type *dma, const adc_capture_config_t *config);
+
+/*!
+ * @brief Stops the capture and releases its channel to the DMA manager.
+ *
+ * @param handle Pointer to the capture handle.
+ */
+void ADC_CaptureDestroy(adc_capture_handle_t *handle);
+
+/*!
+ * @brief Starts the capture, the channel accepts the ADC requests.
+ *
+ * @param handle Pointer to the capture handle.
+ */
+void ADC_CaptureStart(adc_capture_handle_t *handle);
+
+/*!
+ * @brief Stops the capture.
+ *
+ * @param handle Pointer to the capture handle.
+ */
+void ADC_CaptureStop(adc_capture_handle_t *handle);
+
+/*!
+ * @brief Hands a reported half back to the DMA.
+ *
+ * A half still held when the DMA starts writing it counts as an overrun.
+ *
+ * @param handle Pointer to the capture handle.
+ * @param half Half passed to the callback.
+ */
+void ADC_CaptureReleaseHalf(adc_capture_handle_t *handle, adc_capture_half_t half);
+
+/*!
+ * @brief Gets the unread samples of the ring.
+ *
+ * Lock-free, for one consumer. The samples are returned in place, up to the end of the ring, so the call
+ * returns the rest after the wrap once they are consumed. When the reader is more than one ring behind, the
+ * unread samples are dropped, the reader restarts at the producer and an overrun is counted.
+ *
+ * @param handle Pointer to the capture handle, in ring mode.
+ * @param samples Returns the first unread sample.
+ * @param count Returns the number of contiguous unread samples.
+ * @retval kStatus_Success The samples are valid until the producer gets one ring ahead of them.
+ * @retval kStatus_ADC_CaptureOverrun The unread samples are lost, count is 0.
+ */
+status_t ADC_CaptureRingPeek(adc_capture_handle_t *handle, const uint16_t **samples, uint32_t *count);
+
+/*!
+ * @brief Consumes samples returned by ADC_CaptureRingPeek.
+ *
+ * The producer keeps running while the samples are read in place, the call checks they were not overwritten.
+ *
+ * @param handle Pointer to the capture handle, in ring mode.
+ * @param count Number of samples consumed, up to the count returned by ADC_CaptureRingPeek.
+ * @retval kStatus_Success The consumed samples were valid.
+ * @retval kStatus_ADC_CaptureOverrun The DMA overwrote some of them while they were read.
+ */
+status_t ADC_CaptureRingConsume(adc_capture_handle_t *handle, uint32_t count);
+
+/*!
+ * @brief Gets the number of samples written since the start.
+ *
+ * @param handle Pointer to the capture handle, in ring mode.
+ * @return Producer position, it wraps at 2^32 samples.
+ */
+uint32_t ADC_CaptureRingGetPosition(adc_capture_handle_t *handle);
+
+/*!
+ * @brief Gets the number of overruns.
+ *
+ * In ping-pong mode it counts the halves lost or overwritten before being released. A half is lost when the
+ * interrupt is delayed past the next half, its interrupt then merges with the next one and only the newest
+ * half is reported. In ring mode it counts the times the reader fell more than one ring behind.
+ *
+ * @param handle Pointer to the capture handle.
+ * @return Number of overruns since ADC_CaptureCreate.
+ */
+static inline uint32_t ADC_CaptureGetOverruns(adc_capture_handle_t *handle)
+{
+    return handle->overruns;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_CAPTURE_H_ */
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "adc_decimator.h"
+#if ADC_DECIMATOR_USE_DSP
+#include "fsl_common.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Sign bit of an offset binary result aligned to Q15. */
+#define ADC_DECIMATOR_SIGN_BIT 0x8000U
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static inline int16_t ADC_DecimatorSaturate(int64_t acc)
+{
+    /* The sum of Q15 by Q15 products is Q30. */
+    acc >>= 15;
+    if (acc > INT16_MAX)
+    {
+        acc = INT16_MAX;
+    }
+    else if (acc < INT16_MIN)
+    {
+        acc = INT16_MIN;
+    }
+    else
+    {
+        /* In range. */
+    }
+
+    return (int16_t)acc;
+}
+
+#if ADC_DECIMATOR_USE_DSP
+static inline int16_t ADC_DecimatorDot(const int16_t *samples, const int16_t *coefficients, uint32_t taps)
+{
+    int64_t acc = 0;
+    uint32_t i  = 0U;
+
+    /* Two taps per SMLALD, the windows start at any sample so the reads may be unaligned. */
+    for (; (i + 4U) <= taps; i += 4U)
+    {
+        acc = (int64_t)__SMLALD(__UNALIGNED_UINT32_READ(&samples[i]), __UNALIGNED_UINT32_READ(&coefficients[i]),
+                                (uint64_t)acc);
+        acc = (int64_t)__SMLALD(__UNALIGNED_UINT32_READ(&samples[i + 2U]),
+                                __UNALIGNED_UINT32_READ(&coefficients[i + 2U]), (uint64_t)acc);
+    }
+    for (; i < taps; i++)
+    {
+        acc += (int32_t)samples[i] * coefficients[i];
+    }
+
+    return ADC_DecimatorSaturate(acc);
+}
+#else
+static inline int16_t ADC_DecimatorDot(const int16_t *samples, const int16_t *coefficients, uint32_t taps)
+{
+    int64_t acc = 0;
+    uint32_t i;
+
+    for (i = 0U; i < taps; i++)
+    {
+        acc += (int32_t)samples[i] * coefficients[i];
+    }
+
+    return ADC_DecimatorSaturate(acc);
+}
+#endif /* ADC_DECIMATOR_USE_DSP */
+
+void ADC_DecimatorGetDefaultConfig(adc_decimator_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->factor     = 1U;
+    config->resolution = 12U;
+}
+
+void ADC_DecimatorInit(adc_decimator_t *handle, const adc_decimator_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert((config->coefficients != NULL) && (config->state != NULL));
+    assert((config->taps != 0U) && (config->factor != 0U) && (config->maxBlock != 0U));
+    assert((config->resolution >= 8U) && (config->resolution <= 16U));
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->coefficients = config->coefficients;
+    handle->taps         = config->taps;
+    handle->factor       = config->factor;
+    handle->shift        = 16U - config->resolution;
+    handle->state        = config->state;
+    handle->maxBlock     = config->maxBlock;
+
+    ADC_DecimatorReset(handle);
+}
+
+void ADC_DecimatorReset(adc_decimator_t *handle)
+{
+    assert(handle != NULL);
+
+    (void)memset(handle->state, 0, (handle->taps - 1U) * sizeof(int16_t));
+    handle->pending = 0U;
+}
+
+uint32_t ADC_DecimatorProcess(adc_decimator_t *handle, const uint16_t *input, uint32_t count, int16_t *output)
+{
+    assert(handle != NULL);
+    assert((input != NULL) && (output != NULL));
+    assert(count <= handle->maxBlock);
+
+    int16_t *block = &handle->state[handle->taps - 1U];
+    uint32_t outputs = 0U;
+    uint32_t i;
+
+    /* Aligned to Q15, flipping the top bit turns offset binary into two's complement. */
+    for (i = 0U; i < count; i++)
+    {
+        block[i] = (int16_t)(uint16_t)(((uint32_t)input[i] << handle->shift) ^ ADC_DECIMATOR_SIGN_BIT);
+    }
+
+    /* The window of the input i starts taps - 1 samples before it, that is at state[i]. */
+    for (i = handle->factor - 1U - handle->pending; i < count; i += handle->factor)
+    {
+        output[outputs] = ADC_DecimatorDot(&handle->state[i], handle->coefficients, handle->taps);
+        outputs++;
+    }
+    handle->pending = (handle->pending + count) % handle->factor;
+
+    /* Keep the history for the windows of the next block. */
+    (void)memmove(handle->state, &handle->state[count], (handle->taps - 1U) * sizeof(int16_t));
+
+    return outputs;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_DECIMATOR_H_
+#define _ADC_DECIMATOR_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*!
+ * @brief Selects the dual 16-bit MAC kernel.
+ *
+ * Set by default on cores with the DSP extension. The portable kernel gives the same results bit for bit and also
+ * builds on a host.
+ */
+#ifndef ADC_DECIMATOR_USE_DSP
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define ADC_DECIMATOR_USE_DSP 1
+#else
+#define ADC_DECIMATOR_USE_DSP 0
+#endif
+#endif
+
+/*! @brief Number of samples of the state buffer of a decimator. */
+#define ADC_DECIMATOR_STATE_SAMPLES(taps, maxBlock) ((taps) - 1U + (maxBlock))
+/*! @brief Largest number of outputs of one block. */
+#define ADC_DECIMATOR_OUTPUT_SAMPLES(maxBlock, factor) (((maxBlock) + (factor) - 1U) / (factor))
+
+/*! @brief Decimator configuration. */
+typedef struct _adc_decimator_config
+{
+    const int16_t *coefficients; /*!< Q15 taps, coefficients[0] weights the oldest sample of the window. */
+    uint32_t taps;               /*!< Number of taps, an even number avoids the scalar tail. */
+    uint32_t factor;             /*!< Decimation factor, one output every factor inputs. */
+    uint32_t resolution;         /*!< Bits of the ADC results, 8 to 16. */
+    int16_t *state;              /*!< ADC_DECIMATOR_STATE_SAMPLES samples. */
+    uint32_t maxBlock;           /*!< Largest number of inputs of one block. */
+} adc_decimator_config_t;
+
+/*! @brief Decimator handle, users shall not touch the values inside. */
+typedef struct _adc_decimator
+{
+    const int16_t *coefficients; /*!< Q15 taps. */
+    uint32_t taps;               /*!< Number of taps. */
+    uint32_t factor;             /*!< Decimation factor. */
+    uint32_t shift;              /*!< Left shift aligning the results to Q15. */
+    int16_t *state;              /*!< Last taps - 1 inputs followed by the current block. */
+    uint32_t maxBlock;           /*!< Largest number of inputs of one block. */
+    uint32_t pending;            /*!< Inputs since the last output. */
+} adc_decimator_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default decimator configuration.
+ *
+ * The default configuration takes 12-bit results without decimation, the taps, the factor and the state buffer have
+ * to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_DecimatorGetDefaultConfig(adc_decimator_config_t *config);
+
+/*!
+ * @brief Initializes a decimating FIR filter.
+ *
+ * The filter takes the uint16_t results of the DMA buffers, centres them and aligns them to Q15, so the output is a
+ * Q15 value with the full scale of the ADC mapped to [-1, 1). Only every factor-th output is computed, which costs
+ * taps / factor multiplications per input like a polyphase decimator. The products are summed in 64 bits and the
+ * output is truncated and saturated to 16 bits.
+ *
+ * With the DSP kernel one SMLALD handles two taps, a 32-tap filter decimating by 4 takes about 10 cycles per input
+ * on the Cortex-M7, that is 10 MHz of the core at the 1 MS/s of one ADC.
+ *
+ * @param handle Pointer to the decimator handle.
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_DecimatorInit(adc_decimator_t *handle, const adc_decimator_config_t *config);
+
+/*!
+ * @brief Clears the filter history, the next block starts a new decimation period.
+ *
+ * @param handle Pointer to the decimator handle.
+ */
+void ADC_DecimatorReset(adc_decimator_t *handle);
+
+/*!
+ * @brief Filters a block of ADC results.
+ *
+ * Blocks of any length up to maxBlock can be passed, the decimation phase carries over, for example a half passed
+ * to the ADC capture or scan callback.
+ *
+ * @param handle Pointer to the decimator handle.
+ * @param input ADC results.
+ * @param count Number of results, up to maxBlock.
+ * @param output Q15 outputs, ADC_DECIMATOR_OUTPUT_SAMPLES samples.
+ * @return Number of outputs written.
+ */
+uint32_t ADC_DecimatorProcess(adc_decimator_t *handle, const uint16_t *input, uint32_t count, int16_t *output);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_DECIMATOR_H_ */
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_event.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* ADCH value of a conversion control group that stops the conversions. */
+#define ADC_EVENT_CHANNEL_DISABLED 0x1FU
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void ADC_EventSetInterrupt(adc_event_handle_t *handle, bool enable)
+{
+    adc_channel_config_t channelConfig;
+
+    /* Writing the control group restarts the continuous conversions. */
+    channelConfig.channelNumber                        = handle->channel;
+    channelConfig.enableInterruptOnConversionCompleted = enable;
+    ADC_SetChannelConfig(handle->base, handle->channelGroup, &channelConfig);
+}
+
+void ADC_EventGetDefaultConfig(adc_event_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base                        = ADC2;
+    config->compare.hardwareCompareMode = kADC_HardwareCompareMode2;
+    config->compare.value1              = 1024U;
+    config->compare.value2              = 3072U;
+    config->preSamples                  = 64U;
+    config->postSamples                 = 64U;
+}
+
+void ADC_EventCreate(adc_event_handle_t *handle, const adc_event_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(config->history != NULL);
+    assert(config->history->mode == kADC_CaptureRing);
+    assert(config->postSamples != 0U);
+    assert((config->preSamples + config->postSamples) <= config->history->samples);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base         = config->base;
+    handle->channelGroup = config->channelGroup;
+    handle->channel      = config->channel;
+    handle->history      = config->history;
+    handle->preSamples   = config->preSamples;
+    handle->postSamples  = config->postSamples;
+    handle->callback     = config->callback;
+    handle->userData     = config->userData;
+
+    /* Only the conversions meeting the condition complete, the other results are not stored. */
+    ADC_SetHardwareCompareConfig(config->base, &config->compare);
+}
+
+void ADC_EventDestroy(adc_event_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    adc_channel_config_t channelConfig;
+
+    channelConfig.channelNumber                        = ADC_EVENT_CHANNEL_DISABLED;
+    channelConfig.enableInterruptOnConversionCompleted = false;
+    ADC_SetChannelConfig(handle->base, handle->channelGroup, &channelConfig);
+    ADC_SetHardwareCompareConfig(handle->base, NULL);
+}
+
+void ADC_EventArm(adc_event_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    handle->pending = false;
+    ADC_EventSetInterrupt(handle, true);
+}
+
+void ADC_EventHandleIRQ(adc_event_handle_t *handle)
+{
+    uint32_t value;
+
+    /* Reading the result clears the conversion complete flag. */
+    value = ADC_GetChannelConversionValue(handle->base, handle->channelGroup);
+
+    if (handle->pending)
+    {
+        return;
+    }
+
+    handle->triggerPosition = ADC_CaptureRingGetPosition(handle->history);
+    handle->triggerValue    = value;
+    handle->events++;
+    handle->pending = true;
+
+    /* The conversions go on unseen until the window is read, one interrupt per event. */
+    ADC_EventSetInterrupt(handle, false);
+
+    if (handle->callback != NULL)
+    {
+        handle->callback(handle, value, handle->userData);
+    }
+}
+
+status_t ADC_EventRead(adc_event_handle_t *handle, uint16_t *window, uint32_t *value)
+{
+    assert(handle != NULL);
+    assert(window != NULL);
+
+    const uint16_t *ring = handle->history->buffer;
+    uint32_t samples     = handle->history->samples;
+    uint32_t total       = handle->preSamples + handle->postSamples;
+    uint32_t start;
+    uint32_t produced;
+    uint32_t index;
+    uint32_t first;
+    status_t status = kStatus_Success;
+
+    if (!handle->pending)
+    {
+        return kStatus_ADC_EventNotReady;
+    }
+
+    start    = handle->triggerPosition - handle->preSamples;
+    produced = ADC_CaptureRingGetPosition(handle->history) - start;
+    if (produced < total)
+    {
+        return kStatus_ADC_EventNotReady;
+    }
+
+    /* The window is copied in one or two parts around the end of the ring. */
+    index = start & (samples - 1U);
+    first = MIN(total, samples - index);
+    (void)memcpy(window, &ring[index], first * sizeof(uint16_t));
+    (void)memcpy(&window[first], ring, (total - first) * sizeof(uint16_t));
+
+    /* The oldest sample is overwritten once the producer is a whole ring ahead of it. */
+    if ((ADC_CaptureRingGetPosition(handle->history) - start) > samples)
+    {
+        handle->overruns++;
+        status = kStatus_ADC_CaptureOverrun;
+    }
+
+    if (value != NULL)
+    {
+        *value = handle->triggerValue;
+    }
+
+    ADC_EventArm(handle);
+
+    return status;
+}
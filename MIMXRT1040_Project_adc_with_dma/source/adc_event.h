@@ -0,0 +1,164 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_EVENT_H_
+#define _ADC_EVENT_H_
+
+#include "fsl_adc.h"
+#include "adc_capture.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief ADC event status codes. */
+enum
+{
+    kStatus_ADC_EventNotReady = MAKE_STATUS(kStatusGroup_ApplicationRangeStart, 3), /*!< No event, or its post-trigger
+                                                                                         samples are not captured
+                                                                                         yet. */
+};
+
+/*! @brief ADC event handle. */
+typedef struct _adc_event_handle adc_event_handle_t;
+
+/*!
+ * @brief Event detected callback, called from the interrupt of the detector ADC.
+ *
+ * The window is not complete yet, read it later with ADC_EventRead.
+ */
+typedef void (*adc_event_callback_t)(adc_event_handle_t *handle, uint32_t value, void *userData);
+
+/*! @brief ADC event configuration. */
+typedef struct _adc_event_config
+{
+    ADC_Type *base;                        /*!< Detector ADC, initialized in continuous conversion and calibrated. */
+    uint32_t channelGroup;                 /*!< Conversion control group of the detector, 0 for software start. */
+    uint32_t channel;                      /*!< ADC input channel, the one the history captures. */
+    adc_hardware_compare_config_t compare; /*!< Condition of an event, the other conversions are discarded. */
+    adc_capture_handle_t *history;         /*!< Running ring mode capture of the same signal. */
+    uint32_t preSamples;                   /*!< History samples before the trigger. */
+    uint32_t postSamples;                  /*!< History samples from the trigger on, at least 1. */
+    adc_event_callback_t callback;         /*!< Event detected callback, can be NULL. */
+    void *userData;                        /*!< Parameter passed to the callback. */
+} adc_event_config_t;
+
+/*! @brief ADC event handle, users shall not touch the values inside. */
+struct _adc_event_handle
+{
+    ADC_Type *base;                    /*!< Detector ADC. */
+    uint32_t channelGroup;             /*!< Conversion control group of the detector. */
+    uint32_t channel;                  /*!< ADC input channel. */
+    adc_capture_handle_t *history;     /*!< History ring. */
+    uint32_t preSamples;               /*!< History samples before the trigger. */
+    uint32_t postSamples;              /*!< History samples from the trigger on. */
+    adc_event_callback_t callback;     /*!< Event detected callback. */
+    void *userData;                    /*!< Parameter passed to the callback. */
+    volatile bool pending;             /*!< An event waits for ADC_EventRead, the detector is disarmed. */
+    volatile uint32_t triggerPosition; /*!< History position when the event was detected. */
+    volatile uint32_t triggerValue;    /*!< Conversion result of the event. */
+    volatile uint32_t events;          /*!< Number of detected events. */
+    uint32_t overruns;                 /*!< Number of windows overwritten before being read. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default event configuration.
+ *
+ * The default configuration watches conversion control group 0 of ADC2 for results outside 1024 to 3072, with
+ * 64 samples before and after the trigger. The channel and the history have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_EventGetDefaultConfig(adc_event_config_t *config);
+
+/*!
+ * @brief Creates an event detector with a pre-trigger history.
+ *
+ * The detector ADC converts continuously with the hardware compare enabled. A conversion not meeting the condition
+ * is discarded by the ADC, it sets no flag and requests neither an interrupt nor a DMA transfer, so the CPU and the
+ * bus only see the events. The compare discards the samples, so the history comes from a second ADC on the same
+ * input captured in ring mode by the eDMA, without the CPU.
+ *
+ * The detector interrupt calls ADC_EventHandleIRQ. It notes the history position and disarms the detector until the
+ * window is read, an event lasting many conversions interrupts once.
+ *
+ * @param handle Pointer to the event handle.
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_EventCreate(adc_event_handle_t *handle, const adc_event_config_t *config);
+
+/*!
+ * @brief Stops the detector.
+ *
+ * @param handle Pointer to the event handle.
+ */
+void ADC_EventDestroy(adc_event_handle_t *handle);
+
+/*!
+ * @brief Arms the detector.
+ *
+ * @param handle Pointer to the event handle.
+ */
+void ADC_EventArm(adc_event_handle_t *handle);
+
+/*!
+ * @brief Handles the interrupt of the detector ADC.
+ *
+ * @param handle Pointer to the event handle.
+ */
+void ADC_EventHandleIRQ(adc_event_handle_t *handle);
+
+/*!
+ * @brief Reads the window around the last event and arms the detector again.
+ *
+ * The window is copied out of the history ring, preSamples before the trigger then postSamples from the trigger on.
+ * The detector and the history run on separate ADCs and the position is taken in the interrupt, so the trigger is
+ * placed within a few samples. The call returns kStatus_ADC_EventNotReady until the post-trigger samples are
+ * captured, the history interrupt wakes the CPU once per ring to poll it.
+ *
+ * @param handle Pointer to the event handle.
+ * @param window Receives preSamples + postSamples samples.
+ * @param value Returns the conversion result that triggered the event, can be NULL.
+ * @retval kStatus_Success The window is copied, the detector is armed.
+ * @retval kStatus_ADC_EventNotReady No event, or the window is not complete yet.
+ * @retval kStatus_ADC_CaptureOverrun The history overwrote the window, the detector is armed.
+ */
+status_t ADC_EventRead(adc_event_handle_t *handle, uint16_t *window, uint32_t *value);
+
+/*!
+ * @brief Gets the number of detected events.
+ *
+ * @param handle Pointer to the event handle.
+ * @return Number of events since ADC_EventCreate.
+ */
+static inline uint32_t ADC_EventGetCount(adc_event_handle_t *handle)
+{
+    return handle->events;
+}
+
+/*!
+ * @brief Gets the number of windows overwritten by the history before being read.
+ *
+ * @param handle Pointer to the event handle.
+ * @return Number of overruns since ADC_EventCreate.
+ */
+static inline uint32_t ADC_EventGetOverruns(adc_event_handle_t *handle)
+{
+    return handle->overruns;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_EVENT_H_ */
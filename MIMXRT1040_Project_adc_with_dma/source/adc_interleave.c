@@ -0,0 +1,286 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_interleave.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* ADC_HCn channel selecting the input given by the ADC_ETC chain segment. */
+#define ADC_INTERLEAVE_EXTERNAL_CHANNEL 16U
+/* Number of ADC_ETC triggers routed to each ADC, the first one of each ADC is used. */
+#define ADC_INTERLEAVE_TRIGGERS_PER_ADC 4U
+/* Largest gain of a correction, Q15, the product with a 16-bit sample fits 32 bits. */
+#define ADC_INTERLEAVE_MAX_GAIN (2U * ADC_INTERLEAVE_UNITY_GAIN)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void ADC_InterleaveCaptureCallback(
+    adc_capture_handle_t *handle, adc_capture_half_t half, const uint16_t *samples, uint32_t count, void *userData);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static ADC_Type *const s_adcInterleaveBases[ADC_INTERLEAVE_ADC_COUNT] = {ADC1, ADC2};
+static const int32_t s_adcInterleaveSources[ADC_INTERLEAVE_ADC_COUNT] = {(int32_t)kDmaRequestMuxADC1,
+                                                                         (int32_t)kDmaRequestMuxADC2};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static inline uint16_t ADC_InterleaveCorrect(uint32_t sample,
+                                             const adc_interleave_correction_t *correction,
+                                             uint32_t maxValue)
+{
+    int32_t value = (int32_t)((sample * correction->gain + (ADC_INTERLEAVE_UNITY_GAIN / 2U)) >> 15U) +
+                    correction->offset;
+
+    if (value < 0)
+    {
+        value = 0;
+    }
+    else if ((uint32_t)value > maxValue)
+    {
+        value = (int32_t)maxValue;
+    }
+    else
+    {
+        /* In range. */
+    }
+
+    return (uint16_t)value;
+}
+
+static void ADC_InterleaveCaptureCallback(
+    adc_capture_handle_t *handle, adc_capture_half_t half, const uint16_t *samples, uint32_t count, void *userData)
+{
+    adc_interleave_handle_t *interleave = (adc_interleave_handle_t *)userData;
+    uint32_t adc                        = (handle == &interleave->captures[0]) ? 0U : 1U;
+    uint32_t offset                     = (uint32_t)half * interleave->frames;
+    uint16_t *output;
+
+    /* ADC2 usually completes last, but the interrupt order is not guaranteed. */
+    interleave->readyAdcs[half] |= (uint8_t)(1U << adc);
+    if (interleave->readyAdcs[half] != ((1U << ADC_INTERLEAVE_ADC_COUNT) - 1U))
+    {
+        return;
+    }
+    interleave->readyAdcs[half] = 0U;
+
+    output = &interleave->output[offset * ADC_INTERLEAVE_ADC_COUNT];
+    ADC_InterleaveMerge(&interleave->captures[0].buffer[offset], &interleave->captures[1].buffer[offset],
+                        interleave->frames, interleave->correction, interleave->maxValue, output);
+    ADC_CaptureReleaseHalf(&interleave->captures[0], half);
+    ADC_CaptureReleaseHalf(&interleave->captures[1], half);
+    interleave->halves++;
+
+    if (interleave->callback != NULL)
+    {
+        interleave->callback(interleave, output, interleave->frames * ADC_INTERLEAVE_ADC_COUNT,
+                             interleave->userData);
+    }
+}
+
+/* Routes one ADC_ETC trigger to conversion control group 0 of its ADC, one conversion per trigger. */
+static void ADC_InterleaveConfigureTrigger(ADC_Type *base, uint32_t triggerGroup, uint32_t channel)
+{
+    adc_etc_trigger_config_t triggerConfig;
+    adc_etc_trigger_chain_config_t chainConfig;
+    adc_channel_config_t channelConfig;
+
+    (void)memset(&triggerConfig, 0, sizeof(triggerConfig));
+    ADC_ETC_SetTriggerConfig(ADC_ETC, triggerGroup, &triggerConfig);
+
+    channelConfig.channelNumber                        = ADC_INTERLEAVE_EXTERNAL_CHANNEL;
+    channelConfig.enableInterruptOnConversionCompleted = false;
+    ADC_SetChannelConfig(base, 0U, &channelConfig);
+
+    (void)memset(&chainConfig, 0, sizeof(chainConfig));
+    chainConfig.ADCHCRegisterSelect = 1U;
+    chainConfig.ADCChannelSelect    = channel;
+    chainConfig.InterruptEnable     = kADC_ETC_InterruptDisable;
+    ADC_ETC_SetTriggerChainConfig(ADC_ETC, triggerGroup, 0U, &chainConfig);
+    ADC_EnableHardwareTrigger(base, true);
+}
+
+void ADC_InterleaveGetDefaultConfig(adc_interleave_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->pwm                = PWM1;
+    config->subModules[0]      = kPWM_Module_0;
+    config->subModules[1]      = kPWM_Module_1;
+    config->sourceClockHz      = CLOCK_GetFreq(kCLOCK_IpgClk);
+    config->resolution         = 12U;
+    config->correction[0].gain = ADC_INTERLEAVE_UNITY_GAIN;
+    config->correction[1].gain = ADC_INTERLEAVE_UNITY_GAIN;
+}
+
+status_t ADC_InterleaveCreate(adc_interleave_handle_t *handle, DMA_Type *dma, const adc_interleave_config_t *config)
+{
+    assert(handle != NULL);
+    assert(dma != NULL);
+    assert(config != NULL);
+    assert((config->captures[0] != NULL) && (config->captures[1] != NULL) && (config->output != NULL));
+    assert((config->frames != 0U) && (config->frames <= (DMA_CITER_ELINKNO_CITER_MASK / 2U)));
+    assert((config->resolution >= 8U) && (config->resolution <= 16U));
+
+    adc_pacer_config_t pacerConfig;
+    adc_capture_config_t captureConfig;
+    uint32_t adc;
+    status_t status;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->output   = config->output;
+    handle->frames   = config->frames;
+    handle->maxValue = (1UL << config->resolution) - 1U;
+    handle->callback = config->callback;
+    handle->userData = config->userData;
+    (void)memcpy(handle->correction, config->correction, sizeof(handle->correction));
+
+    for (adc = 0U; adc < ADC_INTERLEAVE_ADC_COUNT; adc++)
+    {
+        /* Same rate on both submodules, ADC2 half a period after ADC1. */
+        ADC_PacerGetDefaultConfig(&pacerConfig);
+        pacerConfig.base          = config->pwm;
+        pacerConfig.subModule     = config->subModules[adc];
+        pacerConfig.sourceClockHz = config->sourceClockHz;
+        pacerConfig.rateHz        = config->rateHz / ADC_INTERLEAVE_ADC_COUNT;
+        pacerConfig.triggerGroup  = adc * ADC_INTERLEAVE_TRIGGERS_PER_ADC;
+        pacerConfig.phase         = (uint16_t)(adc * (0x10000U / ADC_INTERLEAVE_ADC_COUNT));
+        status                    = ADC_PacerInit(&handle->pacers[adc], &pacerConfig);
+        if (status != kStatus_Success)
+        {
+            return status;
+        }
+
+        ADC_InterleaveConfigureTrigger(s_adcInterleaveBases[adc], pacerConfig.triggerGroup, config->channel);
+    }
+
+    for (adc = 0U; adc < ADC_INTERLEAVE_ADC_COUNT; adc++)
+    {
+        /* Each ADC requests its own channel when its result is ready, ADC_ETC only starts the conversions. */
+        ADC_CaptureGetDefaultConfig(&captureConfig);
+        captureConfig.base     = s_adcInterleaveBases[adc];
+        captureConfig.source   = s_adcInterleaveSources[adc];
+        captureConfig.buffer   = config->captures[adc];
+        captureConfig.samples  = ADC_INTERLEAVE_CAPTURE_SAMPLES(config->frames);
+        captureConfig.callback = ADC_InterleaveCaptureCallback;
+        captureConfig.userData = handle;
+        status                 = ADC_CaptureCreate(&handle->captures[adc], dma, &captureConfig);
+        if (status != kStatus_Success)
+        {
+            if (adc != 0U)
+            {
+                ADC_CaptureDestroy(&handle->captures[0]);
+            }
+            return status;
+        }
+    }
+
+    return kStatus_Success;
+}
+
+void ADC_InterleaveDestroy(adc_interleave_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    uint32_t adc;
+
+    ADC_InterleaveStop(handle);
+    for (adc = 0U; adc < ADC_INTERLEAVE_ADC_COUNT; adc++)
+    {
+        ADC_PacerDeinit(&handle->pacers[adc]);
+        ADC_CaptureDestroy(&handle->captures[adc]);
+    }
+}
+
+void ADC_InterleaveStart(adc_interleave_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    adc_pacer_handle_t *pacers[ADC_INTERLEAVE_ADC_COUNT] = {&handle->pacers[0], &handle->pacers[1]};
+
+    ADC_CaptureStart(&handle->captures[0]);
+    ADC_CaptureStart(&handle->captures[1]);
+    ADC_ETC->CTRL |= ADC_ETC_CTRL_TRIG_ENABLE((1UL << 0U) | (1UL << ADC_INTERLEAVE_TRIGGERS_PER_ADC));
+
+    /* Started together, the counters keep the half period offset. */
+    ADC_PacerStartGroup(pacers, ADC_INTERLEAVE_ADC_COUNT);
+}
+
+void ADC_InterleaveStop(adc_interleave_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_PacerStop(&handle->pacers[0]);
+    ADC_PacerStop(&handle->pacers[1]);
+    ADC_ETC->CTRL &= ~ADC_ETC_CTRL_TRIG_ENABLE((1UL << 0U) | (1UL << ADC_INTERLEAVE_TRIGGERS_PER_ADC));
+    ADC_CaptureStop(&handle->captures[0]);
+    ADC_CaptureStop(&handle->captures[1]);
+}
+
+status_t ADC_InterleaveComputeCorrection(const uint32_t reference[2],
+                                         const uint32_t measured[2],
+                                         uint32_t samples,
+                                         adc_interleave_correction_t *correction)
+{
+    assert(reference != NULL);
+    assert(measured != NULL);
+    assert(correction != NULL);
+
+    int64_t referenceSpan = (int64_t)reference[1] - (int64_t)reference[0];
+    int64_t measuredSpan  = (int64_t)measured[1] - (int64_t)measured[0];
+    int64_t gain;
+    int64_t offset;
+    int64_t divisor;
+
+    if ((samples == 0U) || (measuredSpan <= 0) || (referenceSpan <= 0))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* gain = reference span / measured span, rounded. */
+    gain = ((referenceSpan << 15) + (measuredSpan / 2)) / measuredSpan;
+    if ((gain == 0) || (gain > (int64_t)ADC_INTERLEAVE_MAX_GAIN))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* offset = (reference low - measured low * gain) / samples, in LSB, rounded half away from zero. */
+    offset  = ((int64_t)reference[0] << 15) - ((int64_t)measured[0] * gain);
+    divisor = (int64_t)samples << 15;
+    offset  = (offset + ((offset < 0) ? -(divisor / 2) : (divisor / 2))) / divisor;
+
+    correction->gain   = (uint32_t)gain;
+    correction->offset = (int32_t)offset;
+
+    return kStatus_Success;
+}
+
+void ADC_InterleaveMerge(const uint16_t *first,
+                         const uint16_t *second,
+                         uint32_t frames,
+                         const adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT],
+                         uint32_t maxValue,
+                         uint16_t *output)
+{
+    assert((first != NULL) && (second != NULL) && (output != NULL));
+    assert(correction != NULL);
+
+    uint32_t i;
+
+    for (i = 0U; i < frames; i++)
+    {
+        output[2U * i]      = ADC_InterleaveCorrect(first[i], &correction[0], maxValue);
+        output[2U * i + 1U] = ADC_InterleaveCorrect(second[i], &correction[1], maxValue);
+    }
+}
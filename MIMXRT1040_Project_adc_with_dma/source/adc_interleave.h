@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_INTERLEAVE_H_
+#define _ADC_INTERLEAVE_H_
+
+#include "fsl_adc.h"
+#include "fsl_adc_etc.h"
+#include "adc_capture.h"
+#include "adc_pacer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Number of interleaved ADCs. */
+#define ADC_INTERLEAVE_ADC_COUNT 2U
+/*! @brief Gain of a correction that leaves the samples unchanged, Q15. */
+#define ADC_INTERLEAVE_UNITY_GAIN 0x8000U
+/*! @brief Number of samples of the capture buffer of each ADC. */
+#define ADC_INTERLEAVE_CAPTURE_SAMPLES(frames) (2U * (frames))
+/*! @brief Number of samples of the output buffer, both halves of both ADCs. */
+#define ADC_INTERLEAVE_OUTPUT_SAMPLES(frames) (2U * ADC_INTERLEAVE_ADC_COUNT * (frames))
+
+/*! @brief Offset and gain matching one ADC to the other, y = x * gain / 2^15 + offset. */
+typedef struct _adc_interleave_correction
+{
+    uint32_t gain;  /*!< Gain in Q15, ADC_INTERLEAVE_UNITY_GAIN for none. */
+    int32_t offset; /*!< Offset added after the gain, in LSB. */
+} adc_interleave_correction_t;
+
+/*! @brief ADC interleave handle. */
+typedef struct _adc_interleave_handle adc_interleave_handle_t;
+
+/*!
+ * @brief Merged half ready callback, called from the eDMA interrupt.
+ *
+ * The samples alternate between ADC1 and ADC2, in conversion order. They stay valid until the next half is merged
+ * into the same output half, which is one half time after the call.
+ */
+typedef void (*adc_interleave_callback_t)(adc_interleave_handle_t *handle,
+                                          const uint16_t *samples,
+                                          uint32_t count,
+                                          void *userData);
+
+/*! @brief ADC interleave configuration. */
+typedef struct _adc_interleave_config
+{
+    uint32_t channel;                                                 /*!< ADC input channel wired to both ADCs. */
+    PWM_Type *pwm;                                                    /*!< eFlexPWM peripheral giving the time base. */
+    pwm_submodule_t subModules[ADC_INTERLEAVE_ADC_COUNT];             /*!< Trigger counters of ADC1 and ADC2. */
+    uint32_t sourceClockHz;                                           /*!< PWM source clock, the IPG clock. */
+    uint32_t rateHz;                                                  /*!< Merged sample rate, twice the ADC rate. */
+    uint32_t frames;                                                  /*!< Samples of each ADC per half. */
+    uint16_t *captures[ADC_INTERLEAVE_ADC_COUNT];                     /*!< Capture buffer of each ADC. */
+    uint16_t *output;                                                 /*!< Merged samples, both halves. */
+    uint32_t resolution;                                              /*!< Bits of the ADC results, 8 to 16. */
+    adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT]; /*!< Matching of ADC1 and ADC2. */
+    adc_interleave_callback_t callback;                               /*!< Merged half ready callback, can be NULL. */
+    void *userData;                                                   /*!< Parameter passed to the callback. */
+} adc_interleave_config_t;
+
+/*! @brief ADC interleave handle, users shall not touch the values inside. */
+struct _adc_interleave_handle
+{
+    adc_capture_handle_t captures[ADC_INTERLEAVE_ADC_COUNT];          /*!< Ping-pong capture of each ADC. */
+    adc_pacer_handle_t pacers[ADC_INTERLEAVE_ADC_COUNT];              /*!< Trigger of each ADC, half a period apart. */
+    uint16_t *output;                                                 /*!< Merged samples. */
+    uint32_t frames;                                                  /*!< Samples of each ADC per half. */
+    uint32_t maxValue;                                                /*!< Largest corrected sample. */
+    adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT]; /*!< Matching of ADC1 and ADC2. */
+    adc_interleave_callback_t callback;                               /*!< Merged half ready callback. */
+    void *userData;                                                   /*!< Parameter passed to the callback. */
+    uint8_t readyAdcs[2];                                             /*!< Bit n is set when ADC n is done. */
+    volatile uint32_t halves;                                         /*!< Number of merged halves. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default interleave configuration.
+ *
+ * The default configuration paces ADC1 and ADC2 with submodules 0 and 1 of PWM1 clocked by the IPG clock, with
+ * 12-bit results and no correction. The channel, the rate and the buffers have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_InterleaveGetDefaultConfig(adc_interleave_config_t *config);
+
+/*!
+ * @brief Creates an interleaved capture of one input by ADC1 and ADC2.
+ *
+ * Each ADC is triggered by its own submodule through the XBARA and ADC_ETC triggers 0 and 4, at half the merged
+ * rate. The submodules count on the same clock and start together, the one of ADC2 half a period later in the
+ * count, so the conversions alternate at the merged rate. Each ADC result is moved by its own eDMA channel into a
+ * ping-pong capture. Once both ADCs completed a half, the merge corrects and interleaves them into the output.
+ *
+ * ADC_ETC is initialized by ADC_ETC_Init, both ADCs by ADC_Init with the same settings, hardware trigger and
+ * calibrated, and the DMA manager by DMAMGR_Init. Both capture channels keep the same interrupt priority, so the
+ * merge runs in one of them at a time.
+ *
+ * @param handle Pointer to the interleave handle.
+ * @param dma eDMA peripheral base address, initialized by EDMA_Init.
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The capture is ready, call ADC_InterleaveStart to run it.
+ * @retval kStatus_InvalidArgument The rate is zero or too high for the PWM.
+ * @retval kStatus_OutOfRange The rate is below the slowest achievable one.
+ * @retval kStatus_DMAMGR_NoFreeChannel No channel left.
+ */
+status_t ADC_InterleaveCreate(adc_interleave_handle_t *handle, DMA_Type *dma, const adc_interleave_config_t *config);
+
+/*!
+ * @brief Stops the capture and releases the channels to the DMA manager.
+ *
+ * @param handle Pointer to the interleave handle.
+ */
+void ADC_InterleaveDestroy(adc_interleave_handle_t *handle);
+
+/*!
+ * @brief Starts the captures, then the triggers.
+ *
+ * @param handle Pointer to the interleave handle.
+ */
+void ADC_InterleaveStart(adc_interleave_handle_t *handle);
+
+/*!
+ * @brief Stops the triggers, then the captures.
+ *
+ * @param handle Pointer to the interleave handle.
+ */
+void ADC_InterleaveStop(adc_interleave_handle_t *handle);
+
+/*!
+ * @brief Computes the correction matching an ADC to a reference ADC.
+ *
+ * Both ADCs convert the same two input levels, the sums of samples conversions of each level give the gain and the
+ * offset mapping the measured ADC onto the reference. Use it with two known levels at production, then keep the
+ * correction with the ADC calibration, for example next to the blob of ADC_CalibrationExport.
+ *
+ * The function does not touch the hardware.
+ *
+ * @param reference Sums of the reference ADC at the low and the high level.
+ * @param measured Sums of the matched ADC at the low and the high level.
+ * @param samples Number of conversions of each sum.
+ * @param correction Pointer to the computed correction.
+ * @retval kStatus_Success The correction is computed.
+ * @retval kStatus_InvalidArgument The levels are not distinct, or the gain is out of range.
+ */
+status_t ADC_InterleaveComputeCorrection(const uint32_t reference[2],
+                                         const uint32_t measured[2],
+                                         uint32_t samples,
+                                         adc_interleave_correction_t *correction);
+
+/*!
+ * @brief Corrects and interleaves the samples of both ADCs.
+ *
+ * output[2n] is first[n] and output[2n + 1] is second[n], each corrected by its entry of correction and clamped
+ * to 0 to maxValue. The function does not touch the hardware.
+ *
+ * @param first Samples of the ADC triggered first.
+ * @param second Samples of the ADC triggered half a period later.
+ * @param frames Number of samples of each ADC.
+ * @param correction Corrections of the first and the second ADC.
+ * @param maxValue Largest output sample.
+ * @param output Receives 2 * frames samples.
+ */
+void ADC_InterleaveMerge(const uint16_t *first,
+                         const uint16_t *second,
+                         uint32_t frames,
+                         const adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT],
+                         uint32_t maxValue,
+                         uint16_t *output);
+
+/*!
+ * @brief Gets the achieved merged sample rate.
+ *
+ * @param handle Pointer to the interleave handle.
+ * @return Merged rate in Hz, twice the PWM trigger rate.
+ */
+static inline uint32_t ADC_InterleaveGetRate(adc_interleave_handle_t *handle)
+{
+    return 2U * ADC_PacerGetTiming(&handle->pacers[0])->rateHz;
+}
+
+/*!
+ * @brief Gets the number of overruns of both captures.
+ *
+ * @param handle Pointer to the interleave handle.
+ * @return Number of overruns since ADC_InterleaveCreate.
+ */
+static inline uint32_t ADC_InterleaveGetOverruns(adc_interleave_handle_t *handle)
+{
+    return ADC_CaptureGetOverruns(&handle->captures[0]) + ADC_CaptureGetOverruns(&handle->captures[1]);
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_INTERLEAVE_H_ */
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_pacer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Number of prescaler settings, from /1 to /128. */
+#define ADC_PACER_PRESCALE_COUNT 8U
+/* Number of submodules of an eFlexPWM, each one has its own XBARA trigger input. */
+#define ADC_PACER_SUBMODULE_COUNT 4U
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t ADC_PacerGetInstance(PWM_Type *base)
+{
+    PWM_Type *const bases[] = PWM_BASE_PTRS;
+    uint32_t instance;
+
+    /* The first entry of PWM_BASE_PTRS is a placeholder, PWM1 is instance 1. */
+    for (instance = 1U; instance < ARRAY_SIZE(bases); instance++)
+    {
+        if (bases[instance] == base)
+        {
+            break;
+        }
+    }
+
+    assert(instance < ARRAY_SIZE(bases));
+
+    return instance;
+}
+
+void ADC_PacerGetDefaultConfig(adc_pacer_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base          = PWM1;
+    config->subModule     = kPWM_Module_0;
+    config->sourceClockHz = CLOCK_GetFreq(kCLOCK_IpgClk);
+}
+
+status_t ADC_PacerComputeTiming(uint32_t sourceClockHz, uint32_t rateHz, adc_pacer_timing_t *timing)
+{
+    assert(timing != NULL);
+
+    adc_pacer_timing_t best;
+    uint64_t divider;
+    uint64_t period;
+    uint64_t ticks;
+    uint64_t expected;
+    uint64_t diff;
+    uint64_t bestDiff  = 0U;
+    uint64_t bestTicks = 0U;
+    int64_t error;
+    uint32_t prescale;
+    uint32_t candidate;
+
+    if ((rateHz == 0U) || (rateHz > (sourceClockHz / ADC_PACER_MIN_PERIOD)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The nearest period at the highest prescaler is the longest one needed. */
+    divider = (uint64_t)rateHz << (ADC_PACER_PRESCALE_COUNT - 1U);
+    if ((((uint64_t)sourceClockHz + (divider / 2U)) / divider) > ADC_PACER_MAX_PERIOD)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    for (prescale = 0U; prescale < ADC_PACER_PRESCALE_COUNT; prescale++)
+    {
+        /*
+         * The relative error |sourceClockHz - rateHz * ticks| / (rateHz * ticks) falls and then rises with the
+         * period, the best one of the prescaler is one of the two around the ideal period, clamped to the range.
+         */
+        divider = (uint64_t)rateHz << prescale;
+        for (candidate = 0U; candidate < 2U; candidate++)
+        {
+            period = ((uint64_t)sourceClockHz / divider) + candidate;
+            period = (period < ADC_PACER_MIN_PERIOD) ? ADC_PACER_MIN_PERIOD : period;
+            period = (period > ADC_PACER_MAX_PERIOD) ? ADC_PACER_MAX_PERIOD : period;
+            ticks  = period << prescale;
+
+            /*
+             * Compared exactly as diff / ticks, rateHz cancels out. diff is below 2^39 and ticks below 2^24, the
+             * products fit. The lowest prescaler and then the shortest period is kept on a tie.
+             */
+            expected = divider * period;
+            diff     = (expected > sourceClockHz) ? (expected - sourceClockHz) : (sourceClockHz - expected);
+            if ((bestTicks == 0U) || ((diff * bestTicks) < (bestDiff * ticks)))
+            {
+                /* The achieved rate is sourceClockHz / ticks, the error is rounded half away from zero. */
+                error = ((int64_t)sourceClockHz - (int64_t)expected) * 1000000;
+                error = (error + ((error < 0) ? -(int64_t)(expected / 2U) : (int64_t)(expected / 2U))) /
+                        (int64_t)expected;
+
+                bestDiff      = diff;
+                bestTicks     = ticks;
+                best.prescale = (pwm_clock_prescale_t)prescale;
+                best.period   = (uint32_t)period;
+                best.rateHz   = (uint32_t)(((uint64_t)sourceClockHz + (ticks / 2U)) / ticks);
+                best.errorPpm = (int32_t)error;
+            }
+        }
+    }
+
+    *timing = best;
+
+    return kStatus_Success;
+}
+
+status_t ADC_PacerInit(adc_pacer_handle_t *handle, const adc_pacer_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert((uint32_t)config->subModule < ADC_PACER_SUBMODULE_COUNT);
+    assert(config->triggerGroup < ADC_ETC_TRIGn_CTRL_COUNT);
+
+    pwm_config_t pwmConfig;
+    uint32_t instance = ADC_PacerGetInstance(config->base);
+    uint32_t phaseTicks;
+    status_t status;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base            = config->base;
+    handle->subModule       = config->subModule;
+    handle->triggerRegister = (config->phase == 0U) ? kPWM_ValueRegister_1 : kPWM_ValueRegister_3;
+
+    status = ADC_PacerComputeTiming(config->sourceClockHz, config->rateHz, &handle->timing);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    PWM_GetDefaultConfig(&pwmConfig);
+    pwmConfig.prescale = handle->timing.prescale;
+    status             = PWM_Init(config->base, config->subModule, &pwmConfig);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    /* One trigger per counter period, the outputs of the submodule stay disabled. */
+    config->base->SM[config->subModule].INIT = 0U;
+    config->base->SM[config->subModule].VAL1 = (uint16_t)(handle->timing.period - 1U);
+    if (config->phase != 0U)
+    {
+        /* VAL3 = n is reached n + 1 clocks after the VAL1 match at the end of the previous period. */
+        phaseTicks = ((handle->timing.period * (uint32_t)config->phase) + 0x8000U) >> 16U;
+        config->base->SM[config->subModule].VAL3 =
+            (uint16_t)((handle->timing.period - 1U + phaseTicks) % handle->timing.period);
+    }
+    PWM_OutputTriggerEnable(config->base, config->subModule, handle->triggerRegister, true);
+    PWM_SetPwmLdok(config->base, (uint8_t)(1U << (uint32_t)config->subModule), true);
+
+    /* The trigger inputs of the submodules of all instances follow each other, so do the ADC_ETC outputs. */
+    XBARA_Init(XBARA1);
+    XBARA_SetSignalsConnection(
+        XBARA1,
+        (xbar_input_signal_t)((uint32_t)kXBARA1_InputFlexpwm1Pwm1OutTrig01 +
+                              ((instance - 1U) * ADC_PACER_SUBMODULE_COUNT) + (uint32_t)config->subModule),
+        (xbar_output_signal_t)((uint32_t)kXBARA1_OutputAdcEtcXbar0Trig0 + config->triggerGroup));
+
+    return kStatus_Success;
+}
+
+void ADC_PacerDeinit(adc_pacer_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_PacerStop(handle);
+    PWM_OutputTriggerEnable(handle->base, handle->subModule, handle->triggerRegister, false);
+    PWM_Deinit(handle->base, handle->subModule);
+}
+
+void ADC_PacerStart(adc_pacer_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    PWM_StartTimer(handle->base, (uint8_t)(1U << (uint32_t)handle->subModule));
+}
+
+void ADC_PacerStartGroup(adc_pacer_handle_t *const *handles, uint32_t count)
+{
+    assert(handles != NULL);
+
+    uint32_t mask = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        assert(handles[i]->base == handles[0]->base);
+        assert(handles[i]->timing.period == handles[0]->timing.period);
+        mask |= 1UL << (uint32_t)handles[i]->subModule;
+    }
+
+    /* One write to MCTRL[RUN] releases the counters together. */
+    PWM_StartTimer(handles[0]->base, (uint8_t)mask);
+}
+
+void ADC_PacerStop(adc_pacer_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    PWM_StopTimer(handle->base, (uint8_t)(1U << (uint32_t)handle->subModule));
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_PACER_H_
+#define _ADC_PACER_H_
+
+#include "fsl_pwm.h"
+#include "fsl_xbara.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Longest trigger period in PWM counter clocks, the counter runs from INIT = 0 up to VAL1. */
+#define ADC_PACER_MAX_PERIOD 0x10000U
+/*! @brief Shortest trigger period in PWM counter clocks. */
+#define ADC_PACER_MIN_PERIOD 2U
+
+/*! @brief PWM timing of a trigger rate. */
+typedef struct _adc_pacer_timing
+{
+    pwm_clock_prescale_t prescale; /*!< PWM clock prescaler, the counter clock is the source clock / 2^prescale. */
+    uint32_t period;               /*!< Counter clocks per trigger. */
+    uint32_t rateHz;               /*!< Achieved trigger rate, rounded to the nearest Hz. */
+    int32_t errorPpm;              /*!< Error of the achieved rate against the requested one, in ppm. */
+} adc_pacer_timing_t;
+
+/*! @brief ADC pacer configuration. */
+typedef struct _adc_pacer_config
+{
+    PWM_Type *base;            /*!< eFlexPWM peripheral giving the time base. */
+    pwm_submodule_t subModule; /*!< Submodule used as the trigger counter, its outputs are left untouched. */
+    uint32_t sourceClockHz;    /*!< PWM source clock, the IPG clock. */
+    uint32_t rateHz;           /*!< Requested trigger rate. */
+    uint32_t triggerGroup;     /*!< ADC_ETC trigger the PWM trigger is routed to, 0 to 7. */
+    uint16_t phase;            /*!< Delay of the trigger in 1/65536 of a period, 0x8000 for half a period. */
+} adc_pacer_config_t;
+
+/*! @brief ADC pacer handle, users shall not touch the values inside. */
+typedef struct _adc_pacer_handle
+{
+    PWM_Type *base;                       /*!< eFlexPWM peripheral. */
+    pwm_submodule_t subModule;            /*!< Submodule used as the trigger counter. */
+    adc_pacer_timing_t timing;            /*!< Programmed timing. */
+    pwm_value_register_t triggerRegister; /*!< Value register raising the trigger. */
+} adc_pacer_handle_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default pacer configuration.
+ *
+ * The default configuration uses submodule 0 of PWM1 clocked by the IPG clock and routes its trigger to ADC_ETC
+ * trigger 0, the rate has to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_PacerGetDefaultConfig(adc_pacer_config_t *config);
+
+/*!
+ * @brief Computes the PWM timing closest to a trigger rate.
+ *
+ * The achievable rates are sourceClockHz / (2^prescale * period), with prescale 0 to 7 and period
+ * ADC_PACER_MIN_PERIOD to ADC_PACER_MAX_PERIOD. The rate is exact when it divides the source clock into a period
+ * in range, otherwise the grid step at the requested rate is about rate^2 * 2^prescale / sourceClockHz, and the
+ * prescaler and period with the smallest relative error are taken, the lowest prescaler and then the shortest period
+ * on a tie.
+ *
+ * The function does not touch the hardware.
+ *
+ * @param sourceClockHz PWM source clock.
+ * @param rateHz Requested trigger rate.
+ * @param timing Pointer to the computed timing.
+ * @retval kStatus_Success The timing is computed.
+ * @retval kStatus_InvalidArgument The rate is zero or above half the source clock.
+ * @retval kStatus_OutOfRange The rate is below the slowest achievable one.
+ */
+status_t ADC_PacerComputeTiming(uint32_t sourceClockHz, uint32_t rateHz, adc_pacer_timing_t *timing);
+
+/*!
+ * @brief Initializes a pacer, the ADC_ETC trigger is started by the PWM at a fixed rate.
+ *
+ * The submodule counts from 0 to period - 1 and raises its output trigger 1 on the VAL1 match, once per period. The
+ * XBARA routes the trigger output of the submodule to the ADC_ETC trigger, which has to be set up in hardware
+ * trigger mode, for example by ADC_ScanCreate without softwareTrigger. The sample spacing is then given by the PWM
+ * clock instead of the ADC conversion time.
+ *
+ * A phase moves the trigger to a VAL3 match later in the period, rounded to a counter clock. Pacers at the same rate
+ * started by ADC_PacerStartGroup then trigger at fixed offsets of one time base.
+ *
+ * @param handle Pointer to the pacer handle.
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The pacer is ready, call ADC_PacerStart to run it.
+ * @retval kStatus_InvalidArgument The rate is zero or above half the source clock.
+ * @retval kStatus_OutOfRange The rate is below the slowest achievable one.
+ * @retval kStatus_Fail The submodule can not be initialized.
+ */
+status_t ADC_PacerInit(adc_pacer_handle_t *handle, const adc_pacer_config_t *config);
+
+/*!
+ * @brief Stops the pacer and disables its submodule.
+ *
+ * The XBARA connection is kept.
+ *
+ * @param handle Pointer to the pacer handle.
+ */
+void ADC_PacerDeinit(adc_pacer_handle_t *handle);
+
+/*!
+ * @brief Starts the counter, the first trigger comes one period later.
+ *
+ * @param handle Pointer to the pacer handle.
+ */
+void ADC_PacerStart(adc_pacer_handle_t *handle);
+
+/*!
+ * @brief Starts the counters of several pacers on the same clock edge.
+ *
+ * The pacers use submodules of the same eFlexPWM and the same rate, their triggers keep the offsets given by
+ * their phases.
+ *
+ * @param handles Pointers to the pacer handles.
+ * @param count Number of pacers.
+ */
+void ADC_PacerStartGroup(adc_pacer_handle_t *const *handles, uint32_t count);
+
+/*!
+ * @brief Stops the counter.
+ *
+ * @param handle Pointer to the pacer handle.
+ */
+void ADC_PacerStop(adc_pacer_handle_t *handle);
+
+/*!
+ * @brief Gets the programmed timing.
+ *
+ * @param handle Pointer to the pacer handle.
+ * @return Pointer to the timing computed by ADC_PacerInit.
+ */
+static inline const adc_pacer_timing_t *ADC_PacerGetTiming(adc_pacer_handle_t *handle)
+{
+    return &handle->timing;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_PACER_H_ */
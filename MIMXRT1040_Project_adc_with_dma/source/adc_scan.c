@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_scan.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* ADC_HCn channel selecting the input given by the ADC_ETC chain segment. */
+#define ADC_SCAN_EXTERNAL_CHANNEL 16U
+/* Number of ADC_ETC triggers routed to each ADC. */
+#define ADC_SCAN_TRIGGERS_PER_ADC 4U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void ADC_ScanCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void ADC_ScanCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    adc_scan_handle_t *scan = (adc_scan_handle_t *)param;
+    uint32_t citer;
+    uint32_t writing;
+    uint32_t ready;
+
+    /* CITER of the scatter channel counts the frames left, the half it writes is the one not ready. */
+    citer   = scan->dma->TCD[scan->scatterChannel].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK;
+    writing = (citer > scan->frames) ? (uint32_t)kADC_CaptureHalfA : (uint32_t)kADC_CaptureHalfB;
+    ready   = writing ^ 1U;
+
+    /* The interrupts of both halves merged, the expected half is overwritten already. */
+    if (ready != scan->nextHalf)
+    {
+        scan->overruns++;
+    }
+    scan->nextHalf = (uint8_t)writing;
+    scan->halves++;
+
+    if (scan->callback != NULL)
+    {
+        scan->callback(scan, (adc_capture_half_t)ready, scan->userData);
+    }
+}
+
+/* Programs the ADC_ETC chain and the ADC_HCn registers, one segment per channel. */
+static void ADC_ScanConfigureTrigger(const adc_scan_config_t *config)
+{
+    adc_etc_trigger_config_t triggerConfig;
+    adc_etc_trigger_chain_config_t chainConfig;
+    adc_channel_config_t channelConfig;
+    uint32_t i;
+
+    (void)memset(&triggerConfig, 0, sizeof(triggerConfig));
+    triggerConfig.enableSWTriggerMode = config->softwareTrigger;
+    triggerConfig.triggerChainLength  = config->channelCount - 1U;
+    ADC_ETC_SetTriggerConfig(ADC_ETC, config->triggerGroup, &triggerConfig);
+
+    /* Back to back: every conversion starts when the previous one is done, the chain requests the DMA once. */
+    channelConfig.channelNumber                        = ADC_SCAN_EXTERNAL_CHANNEL;
+    channelConfig.enableInterruptOnConversionCompleted = false;
+    chainConfig.enableB2BMode                          = true;
+    chainConfig.InterruptEnable                        = kADC_ETC_InterruptDisable;
+    for (i = 0U; i < config->channelCount; i++)
+    {
+        ADC_SetChannelConfig(config->base, i, &channelConfig);
+        chainConfig.ADCHCRegisterSelect = 1UL << i;
+        chainConfig.ADCChannelSelect    = config->channels[i];
+        ADC_ETC_SetTriggerChainConfig(ADC_ETC, config->triggerGroup, i, &chainConfig);
+    }
+    ADC_EnableHardwareTrigger(config->base, true);
+}
+
+void ADC_ScanGetDefaultConfig(adc_scan_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base            = ADC1;
+    config->softwareTrigger = true;
+}
+
+status_t ADC_ScanCreate(adc_scan_handle_t *handle, DMA_Type *dma, const adc_scan_config_t *config)
+{
+    assert(handle != NULL);
+    assert(dma != NULL);
+    assert(config != NULL);
+    assert((config->channels != NULL) && (config->staging != NULL) && (config->planes != NULL));
+    assert((config->channelCount != 0U) && (config->channelCount <= ADC_SCAN_MAX_CHANNELS));
+    assert((config->frames != 0U) && (config->frames <= ADC_SCAN_MAX_FRAMES));
+    assert((config->triggerGroup < ADC_SCAN_TRIGGERS_PER_ADC) == (config->base == ADC1));
+
+    dmamgr_channel_config_t channelConfig;
+    edma_transfer_config_t transferConfig;
+    edma_minor_offset_config_t minorOffset;
+    uint32_t frameBytes = config->channelCount * sizeof(uint16_t);
+    uint32_t frames     = 2U * config->frames;
+    /* Two results share one register, whole registers are read when no result is left over. */
+    uint32_t width = ((config->channelCount & 1U) == 0U) ? sizeof(uint32_t) : sizeof(uint16_t);
+    status_t status;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base         = config->base;
+    handle->dma          = dma;
+    handle->triggerGroup = config->triggerGroup;
+    handle->planes       = config->planes;
+    handle->channelCount = config->channelCount;
+    handle->frames       = config->frames;
+    handle->callback     = config->callback;
+    handle->userData     = config->userData;
+
+    DMAMGR_GetDefaultChannelConfig(&channelConfig);
+    channelConfig.source   = (int32_t)kDmaRequestMuxADC_ETC;
+    channelConfig.priority = kDMAMGR_PriorityHigh;
+    status                 = DMAMGR_RequestChannel(&channelConfig, &handle->gatherChannel);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+    /* The scatter channel is only started by the link and interrupts twice per buffer. */
+    channelConfig.source = DMAMGR_NO_SOURCE;
+    channelConfig.busy   = true;
+    status               = DMAMGR_RequestChannel(&channelConfig, &handle->scatterChannel);
+    if (status != kStatus_Success)
+    {
+        (void)DMAMGR_ReleaseChannel(handle->gatherChannel);
+        return status;
+    }
+
+    /* EDMA_CreateHandle clears the TCD, so the handle comes before the TCD is loaded. */
+    EDMA_CreateHandle(&handle->edmaHandle, dma, handle->scatterChannel);
+    EDMA_SetCallback(&handle->edmaHandle, ADC_ScanCallback, handle);
+
+    /*
+     * Gather: one frame of results per request into the next staging slot. The source minor loop offset rewinds
+     * to the first result, the destination runs through both halves and rewinds after the major loop.
+     */
+    EDMA_PrepareTransferConfig(&transferConfig, (void *)(uint32_t)&ADC_ETC->TRIG[config->triggerGroup].TRIGn_RESULT_1_0,
+                               width, (int16_t)width, config->staging, width, (int16_t)width, frameBytes,
+                               frameBytes * frames);
+    minorOffset.enableSrcMinorOffset  = true;
+    minorOffset.enableDestMinorOffset = false;
+    minorOffset.minorOffset           = (uint32_t)(-(int32_t)frameBytes);
+    EDMA_ResetChannel(dma, handle->gatherChannel);
+    EDMA_SetTransferConfig(dma, handle->gatherChannel, &transferConfig, NULL);
+    EDMA_SetMinorOffsetConfig(dma, handle->gatherChannel, &minorOffset);
+    EDMA_SetMajorOffsetConfig(dma, handle->gatherChannel, 0, -(int32_t)(frameBytes * frames));
+    /* The last minor loop raises the major link instead of the minor link, so both are set. */
+    EDMA_SetChannelLink(dma, handle->gatherChannel, kEDMA_MinorLink, handle->scatterChannel);
+    EDMA_SetChannelLink(dma, handle->gatherChannel, kEDMA_MajorLink, handle->scatterChannel);
+    /* EDMA_ResetChannel sets the auto disable request feature, the scan keeps its request. */
+    dma->TCD[handle->gatherChannel].CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
+
+    /*
+     * Scatter: one staging frame per link, sample n into plane n. The destination minor loop offset goes back
+     * from the last plane to the next frame slot of the first plane.
+     */
+    EDMA_PrepareTransferConfig(&transferConfig, config->staging, sizeof(uint16_t), (int16_t)sizeof(uint16_t),
+                               config->planes, sizeof(uint16_t), (int16_t)(frames * sizeof(uint16_t)), frameBytes,
+                               frameBytes * frames);
+    minorOffset.enableSrcMinorOffset  = false;
+    minorOffset.enableDestMinorOffset = true;
+    minorOffset.minorOffset = (uint32_t)((int32_t)sizeof(uint16_t) - (int32_t)(frames * frameBytes));
+    EDMA_ResetChannel(dma, handle->scatterChannel);
+    EDMA_SetTransferConfig(dma, handle->scatterChannel, &transferConfig, NULL);
+    EDMA_SetMinorOffsetConfig(dma, handle->scatterChannel, &minorOffset);
+    EDMA_SetMajorOffsetConfig(dma, handle->scatterChannel, -(int32_t)(frameBytes * frames),
+                              -(int32_t)(frames * sizeof(uint16_t)));
+    dma->TCD[handle->scatterChannel].CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
+    EDMA_EnableChannelInterrupts(dma, handle->scatterChannel,
+                                 (uint32_t)kEDMA_HalfInterruptEnable | (uint32_t)kEDMA_MajorInterruptEnable);
+
+    ADC_ScanConfigureTrigger(config);
+
+    return kStatus_Success;
+}
+
+void ADC_ScanDestroy(adc_scan_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_ScanStop(handle);
+    EDMA_ResetChannel(handle->dma, handle->gatherChannel);
+    EDMA_AbortTransfer(&handle->edmaHandle);
+    (void)DMAMGR_ReleaseChannel(handle->gatherChannel);
+    (void)DMAMGR_ReleaseChannel(handle->scatterChannel);
+}
+
+void ADC_ScanStart(adc_scan_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    EDMA_ClearChannelStatusFlags(handle->dma, handle->gatherChannel, (uint32_t)kEDMA_ErrorFlag);
+    EDMA_ClearChannelStatusFlags(handle->dma, handle->scatterChannel, (uint32_t)kEDMA_ErrorFlag);
+    EDMA_EnableChannelRequest(handle->dma, handle->gatherChannel);
+    ADC_ETC_EnableDMA(ADC_ETC, handle->triggerGroup);
+    ADC_ETC->CTRL |= ADC_ETC_CTRL_TRIG_ENABLE(1UL << handle->triggerGroup);
+}
+
+void ADC_ScanStop(adc_scan_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_ETC->CTRL &= ~ADC_ETC_CTRL_TRIG_ENABLE(1UL << handle->triggerGroup);
+    ADC_ETC_DisableDMA(ADC_ETC, handle->triggerGroup);
+    EDMA_DisableChannelRequest(handle->dma, handle->gatherChannel);
+}
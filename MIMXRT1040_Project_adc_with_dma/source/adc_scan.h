@@ -0,0 +1,172 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_SCAN_H_
+#define _ADC_SCAN_H_
+
+#include "fsl_adc.h"
+#include "fsl_adc_etc.h"
+#include "adc_capture.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of channels of a scan, one per ADC_ETC chain segment and ADC_HC register. */
+#define ADC_SCAN_MAX_CHANNELS FSL_FEATURE_ADC_CONVERSION_CONTROL_COUNT
+/*! @brief Maximum number of frames per half, both halves are linked per minor loop. */
+#define ADC_SCAN_MAX_FRAMES (DMA_CITER_ELINKYES_CITER_MASK / 2U)
+/*! @brief Number of samples of the staging and plane buffers of a scan. */
+#define ADC_SCAN_BUFFER_SAMPLES(channelCount, frames) (2U * (channelCount) * (frames))
+
+/*! @brief ADC scan handle. */
+typedef struct _adc_scan_handle adc_scan_handle_t;
+
+/*!
+ * @brief Half ready callback, called from the eDMA interrupt.
+ *
+ * Every plane holds the frames of the half, get them with ADC_ScanGetPlane. They stay valid until the DMA wraps
+ * around to them, which is one half time after the call.
+ */
+typedef void (*adc_scan_callback_t)(adc_scan_handle_t *handle, adc_capture_half_t half, void *userData);
+
+/*! @brief ADC scan configuration. */
+typedef struct _adc_scan_config
+{
+    ADC_Type *base;               /*!< ADC peripheral, already initialized and calibrated. */
+    uint32_t triggerGroup;        /*!< ADC_ETC trigger, 0 to 3 for ADC1, 4 to 7 for ADC2. */
+    const uint32_t *channels;     /*!< ADC input channels, in conversion order. */
+    uint32_t channelCount;        /*!< Number of channels, up to ADC_SCAN_MAX_CHANNELS. */
+    uint32_t frames;              /*!< Frames (one conversion of every channel) per half, up to ADC_SCAN_MAX_FRAMES. */
+    uint16_t *staging;            /*!< Interleaved frames, ADC_SCAN_BUFFER_SAMPLES samples. */
+    uint16_t *planes;             /*!< Planar output, ADC_SCAN_BUFFER_SAMPLES samples. */
+    bool softwareTrigger;         /*!< Frames are started by ADC_ScanTrigger instead of the XBARA trigger. */
+    adc_scan_callback_t callback; /*!< Half ready callback, can be NULL. */
+    void *userData;               /*!< Parameter passed to the callback. */
+} adc_scan_config_t;
+
+/*! @brief ADC scan handle, users shall not touch the values inside. */
+struct _adc_scan_handle
+{
+    ADC_Type *base;               /*!< ADC peripheral. */
+    DMA_Type *dma;                /*!< eDMA peripheral. */
+    uint32_t triggerGroup;        /*!< ADC_ETC trigger. */
+    uint32_t gatherChannel;       /*!< eDMA channel moving the ADC_ETC results to the staging buffer. */
+    uint32_t scatterChannel;      /*!< eDMA channel moving the frames to the planes. */
+    edma_handle_t edmaHandle;     /*!< eDMA handle of the scatter channel. */
+    uint16_t *planes;             /*!< Planar output. */
+    uint32_t channelCount;        /*!< Number of channels. */
+    uint32_t frames;              /*!< Frames per half. */
+    adc_scan_callback_t callback; /*!< Half ready callback. */
+    void *userData;               /*!< Parameter passed to the callback. */
+    volatile uint32_t halves;     /*!< Number of reported halves. */
+    volatile uint32_t overruns;   /*!< Number of halves lost to merged interrupts. */
+    uint8_t nextHalf;             /*!< Half expected to complete next. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default scan configuration.
+ *
+ * The default configuration scans with trigger 0 of ADC1 started by software, the channels, the buffers and the
+ * callback have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_ScanGetDefaultConfig(adc_scan_config_t *config);
+
+/*!
+ * @brief Creates a scan of several ADC inputs.
+ *
+ * The ADC_ETC trigger runs a chain of back to back conversions, segment n converts the n-th channel through
+ * ADC_HCn, and requests the DMA once the chain is done. Two channels are requested from the DMA manager, which must
+ * be initialized by DMAMGR_Init:
+ * - the gather channel copies the results of the chain as one frame into the staging buffer, its source minor loop
+ *   offset rewinds to the first result after every frame,
+ * - its minor link runs the scatter channel, which copies the frame into the planes with one plane per channel,
+ *   its destination minor loop offset moves to the next frame slot of the first plane.
+ *
+ * The planes hold two halves of frames. The half and major interrupts of the scatter channel report the completed
+ * half while the DMA fills the other one, nothing has to be re-armed.
+ *
+ * ADC_ETC_Init must be called first with kADC_ETC_TrgDMAWithPulsedSignal, and with enableTSCBypass to use ADC2. The
+ * ADC is switched to hardware trigger mode.
+ *
+ * @param handle Pointer to the scan handle.
+ * @param dma eDMA peripheral base address, initialized by EDMA_Init.
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The scan is ready, call ADC_ScanStart to run it.
+ * @retval kStatus_DMAMGR_NoFreeChannel Not enough free channels, none is kept.
+ * @note The planes should be non-cacheable, otherwise the consumer has to invalidate them before reading.
+ */
+status_t ADC_ScanCreate(adc_scan_handle_t *handle, DMA_Type *dma, const adc_scan_config_t *config);
+
+/*!
+ * @brief Stops the scan and releases its channels to the DMA manager.
+ *
+ * @param handle Pointer to the scan handle.
+ */
+void ADC_ScanDestroy(adc_scan_handle_t *handle);
+
+/*!
+ * @brief Starts the scan, the ADC_ETC trigger and the DMA accept the frames.
+ *
+ * @param handle Pointer to the scan handle.
+ */
+void ADC_ScanStart(adc_scan_handle_t *handle);
+
+/*!
+ * @brief Stops the scan.
+ *
+ * @param handle Pointer to the scan handle.
+ */
+void ADC_ScanStop(adc_scan_handle_t *handle);
+
+/*!
+ * @brief Starts one frame of a scan created with softwareTrigger.
+ *
+ * @param handle Pointer to the scan handle.
+ */
+static inline void ADC_ScanTrigger(adc_scan_handle_t *handle)
+{
+    ADC_ETC_DoSoftwareTrigger(ADC_ETC, handle->triggerGroup);
+}
+
+/*!
+ * @brief Gets the samples of one channel in one half.
+ *
+ * @param handle Pointer to the scan handle.
+ * @param half Half passed to the callback.
+ * @param index Index of the channel in the configuration.
+ * @return The frames samples of the channel.
+ */
+static inline const uint16_t *ADC_ScanGetPlane(adc_scan_handle_t *handle, adc_capture_half_t half, uint32_t index)
+{
+    return &handle->planes[(index * 2U * handle->frames) + ((uint32_t)half * handle->frames)];
+}
+
+/*!
+ * @brief Gets the number of halves lost because the interrupt was delayed past the next half.
+ *
+ * @param handle Pointer to the scan handle.
+ * @return Number of overruns since ADC_ScanCreate.
+ */
+static inline uint32_t ADC_ScanGetOverruns(adc_scan_handle_t *handle)
+{
+    return handle->overruns;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_SCAN_H_ */
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "adc_stats.h"
+#if ADC_STATS_USE_DSP
+#include "fsl_common.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* A value in both halves of a word. */
+#define ADC_STATS_PAIR(value) ((uint32_t)(value) * 0x00010001U)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void ADC_StatsStartWindow(adc_stats_result_t *window)
+{
+    (void)memset(window, 0, sizeof(*window));
+    window->min = UINT16_MAX;
+}
+
+/* Adds samples to the current window, the count does not go past the end of the window. */
+static void ADC_StatsAccumulate(adc_stats_handle_t *handle, const uint16_t *samples, uint32_t count)
+{
+    adc_stats_result_t *window = &handle->window;
+    uint32_t above             = handle->above ? 1U : 0U;
+    uint32_t crossings         = 0U;
+    uint32_t minimum           = window->min;
+    uint32_t maximum           = window->max;
+    uint64_t sum               = 0U;
+    uint64_t squares           = 0U;
+    uint32_t side;
+    uint32_t i = 0U;
+
+#if ADC_STATS_USE_DSP
+    uint32_t minPair       = ADC_STATS_PAIR(UINT16_MAX);
+    uint32_t maxPair       = 0U;
+    uint32_t thresholdPair = ADC_STATS_PAIR(handle->threshold);
+    uint32_t pair;
+
+    /* Two samples per word, the halves may start at any sample so the reads may be unaligned. */
+    for (; (i + 2U) <= count; i += 2U)
+    {
+        pair = __UNALIGNED_UINT32_READ(&samples[i]);
+
+        /* USUB16 sets the GE flags of the halves which are greater or equal, SEL takes them. */
+        (void)__USUB16(pair, maxPair);
+        maxPair = __SEL(pair, maxPair);
+        (void)__USUB16(minPair, pair);
+        minPair = __SEL(pair, minPair);
+
+        sum     = __SMLALD(pair, ADC_STATS_PAIR(1U), sum);
+        squares = __SMLALD(pair, pair, squares);
+
+        /* Side of both samples as bit 0 and bit 16, a crossing is a change from the previous sample. */
+        (void)__USUB16(pair, thresholdPair);
+        side = __SEL(ADC_STATS_PAIR(1U), 0U);
+        crossings += (above ^ (side & 1U)) + ((side ^ (side >> 16U)) & 1U);
+        above = side >> 16U;
+    }
+
+    minimum = (minimum < (minPair & 0xFFFFU)) ? minimum : (minPair & 0xFFFFU);
+    minimum = (minimum < (minPair >> 16U)) ? minimum : (minPair >> 16U);
+    maximum = (maximum > (maxPair & 0xFFFFU)) ? maximum : (maxPair & 0xFFFFU);
+    maximum = (maximum > (maxPair >> 16U)) ? maximum : (maxPair >> 16U);
+#endif /* ADC_STATS_USE_DSP */
+
+    for (; i < count; i++)
+    {
+        minimum = (samples[i] < minimum) ? samples[i] : minimum;
+        maximum = (samples[i] > maximum) ? samples[i] : maximum;
+        sum += samples[i];
+        squares += (uint32_t)samples[i] * samples[i];
+
+        side = (samples[i] >= handle->threshold) ? 1U : 0U;
+        crossings += above ^ side;
+        above = side;
+    }
+
+    window->count += count;
+    window->min = (uint16_t)minimum;
+    window->max = (uint16_t)maximum;
+    window->sum += sum;
+    window->sumSquares += squares;
+    window->crossings += crossings;
+    handle->above = (above != 0U);
+}
+
+void ADC_StatsGetDefaultConfig(adc_stats_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->windowSamples = 1000U;
+    config->threshold     = 2048U;
+}
+
+void ADC_StatsInit(adc_stats_handle_t *handle, const adc_stats_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert(config->windowSamples != 0U);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->windowSamples = config->windowSamples;
+    handle->threshold     = config->threshold;
+    handle->callback      = config->callback;
+    handle->userData      = config->userData;
+
+    ADC_StatsReset(handle);
+}
+
+void ADC_StatsReset(adc_stats_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    ADC_StatsStartWindow(&handle->window);
+    handle->primed = false;
+}
+
+void ADC_StatsUpdate(adc_stats_handle_t *handle, const uint16_t *samples, uint32_t count)
+{
+    assert(handle != NULL);
+    assert((samples != NULL) || (count == 0U));
+
+    uint32_t chunk;
+
+    /* The first sample only sets the side, it crosses nothing. */
+    if ((!handle->primed) && (count != 0U))
+    {
+        handle->above  = (samples[0] >= handle->threshold);
+        handle->primed = true;
+    }
+
+    while (count != 0U)
+    {
+        chunk = handle->windowSamples - handle->window.count;
+        chunk = (count < chunk) ? count : chunk;
+        ADC_StatsAccumulate(handle, samples, chunk);
+        samples += chunk;
+        count -= chunk;
+
+        if (handle->window.count == handle->windowSamples)
+        {
+            handle->last = handle->window;
+            handle->windows++;
+            ADC_StatsStartWindow(&handle->window);
+            if (handle->callback != NULL)
+            {
+                handle->callback(handle, &handle->last, handle->userData);
+            }
+        }
+    }
+}
+
+uint32_t ADC_StatsGetMean(const adc_stats_result_t *result)
+{
+    assert(result != NULL);
+
+    return (result->count == 0U) ? 0U : (uint32_t)(result->sum / result->count);
+}
+
+uint32_t ADC_StatsGetRms(const adc_stats_result_t *result)
+{
+    assert(result != NULL);
+
+    uint64_t square;
+    uint32_t root = 0U;
+    uint32_t bit;
+
+    if (result->count == 0U)
+    {
+        return 0U;
+    }
+
+    /* Integer square root bit by bit, the mean square of 16-bit samples fits 32 bits and its root 16 bits. */
+    square = result->sumSquares / result->count;
+    for (bit = 1UL << 15U; bit != 0U; bit >>= 1U)
+    {
+        if ((uint64_t)(root | bit) * (root | bit) <= square)
+        {
+            root |= bit;
+        }
+    }
+
+    return root;
+}
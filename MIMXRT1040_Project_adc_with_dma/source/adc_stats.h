@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_STATS_H_
+#define _ADC_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*!
+ * @brief Selects the packed 16-bit SIMD kernel.
+ *
+ * Set by default on cores with the DSP extension. The portable kernel gives the same results and also builds on a
+ * host.
+ */
+#ifndef ADC_STATS_USE_DSP
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define ADC_STATS_USE_DSP 1
+#else
+#define ADC_STATS_USE_DSP 0
+#endif
+#endif
+
+/*! @brief Statistics of a window of ADC results. */
+typedef struct _adc_stats_result
+{
+    uint32_t count;      /*!< Number of samples. */
+    uint16_t min;        /*!< Smallest sample. */
+    uint16_t max;        /*!< Largest sample. */
+    uint64_t sum;        /*!< Sum of the samples. */
+    uint64_t sumSquares; /*!< Sum of the squared samples. */
+    uint32_t crossings;  /*!< Number of times the samples crossed the threshold, in either direction. */
+} adc_stats_result_t;
+
+/*! @brief ADC statistics handle. */
+typedef struct _adc_stats_handle adc_stats_handle_t;
+
+/*! @brief Window completed callback, called from the context of ADC_StatsUpdate. */
+typedef void (*adc_stats_callback_t)(adc_stats_handle_t *handle, const adc_stats_result_t *result, void *userData);
+
+/*! @brief ADC statistics configuration. */
+typedef struct _adc_stats_config
+{
+    uint32_t windowSamples;         /*!< Samples per window, any block split is allowed. */
+    uint16_t threshold;             /*!< A sample is above the threshold when it is greater than or equal to it. */
+    adc_stats_callback_t callback;  /*!< Window completed callback, can be NULL. */
+    void *userData;                 /*!< Parameter passed to the callback. */
+} adc_stats_config_t;
+
+/*! @brief ADC statistics handle, users shall not touch the values inside. */
+struct _adc_stats_handle
+{
+    uint32_t windowSamples;        /*!< Samples per window. */
+    uint16_t threshold;            /*!< Crossing threshold. */
+    bool primed;                   /*!< A sample was seen, above is valid. */
+    bool above;                    /*!< The last sample was above the threshold. */
+    adc_stats_callback_t callback; /*!< Window completed callback. */
+    void *userData;                /*!< Parameter passed to the callback. */
+    adc_stats_result_t window;     /*!< Statistics of the current window. */
+    adc_stats_result_t last;       /*!< Statistics of the last completed window. */
+    uint32_t windows;              /*!< Number of completed windows. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default statistics configuration.
+ *
+ * The default configuration uses windows of 1000 samples and the mid-scale threshold of 12-bit results.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_StatsGetDefaultConfig(adc_stats_config_t *config);
+
+/*!
+ * @brief Initializes the statistics of a stream of ADC results.
+ *
+ * The blocks are read once. With the SIMD kernel every word holds two samples: USUB16 and SEL keep the packed
+ * minimum and maximum, SMLALD adds both samples and both squares, and the GE flags of USUB16 against the threshold
+ * give the side of both samples. The kernels take results of up to 15 bits.
+ *
+ * @param handle Pointer to the statistics handle.
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_StatsInit(adc_stats_handle_t *handle, const adc_stats_config_t *config);
+
+/*!
+ * @brief Drops the current window, the next sample starts a new one.
+ *
+ * @param handle Pointer to the statistics handle.
+ */
+void ADC_StatsReset(adc_stats_handle_t *handle);
+
+/*!
+ * @brief Adds a block of ADC results.
+ *
+ * The callback is called for every window completed by the block, for example from the ADC capture or scan
+ * callback with the completed half.
+ *
+ * @param handle Pointer to the statistics handle.
+ * @param samples ADC results.
+ * @param count Number of results.
+ */
+void ADC_StatsUpdate(adc_stats_handle_t *handle, const uint16_t *samples, uint32_t count);
+
+/*!
+ * @brief Gets the mean of a window, rounded down.
+ *
+ * @param result Pointer to the statistics.
+ * @return The mean, 0 for an empty window.
+ */
+uint32_t ADC_StatsGetMean(const adc_stats_result_t *result);
+
+/*!
+ * @brief Gets the RMS of a window, rounded down.
+ *
+ * @param result Pointer to the statistics.
+ * @return The square root of the mean of the squares, 0 for an empty window.
+ */
+uint32_t ADC_StatsGetRms(const adc_stats_result_t *result);
+
+/*!
+ * @brief Gets the statistics of the last completed window.
+ *
+ * @param handle Pointer to the statistics handle.
+ * @return Pointer to the statistics, all zero until the first window completes.
+ */
+static inline const adc_stats_result_t *ADC_StatsGetLast(adc_stats_handle_t *handle)
+{
+    return &handle->last;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_STATS_H_ */
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "adc_telemetry.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Largest value of the dropped field of the header. */
+#define ADC_TELEMETRY_MAX_DROPPED 0xFFFFU
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void ADC_TelemetryCallback(LPUART_Type *base, lpuart_edma_handle_t *handle, status_t status, void *userData);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* CRC-32 (reflected polynomial 0xEDB88320) of every nibble, two lookups per byte. */
+static const uint32_t s_adcTelemetryCrcTable[16] = {
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t ADC_TelemetryCrc(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    uint32_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4U) ^ s_adcTelemetryCrcTable[crc & 0xFU];
+        crc = (crc >> 4U) ^ s_adcTelemetryCrcTable[crc & 0xFU];
+    }
+
+    return crc;
+}
+
+/*
+ * Sends the frame at the tail of the queue, the link is idle and the interrupts are masked. A frame the driver
+ * refuses is dropped so that the next one can be tried, otherwise nothing would complete it and the queue would stay
+ * full. Returns the samples of the dropped frame, or NULL.
+ */
+static const uint16_t *ADC_TelemetrySendNext(adc_telemetry_handle_t *handle)
+{
+    adc_telemetry_frame_t *frame = &handle->frames[handle->tail];
+
+    handle->iov[0].base   = &frame->header;
+    handle->iov[0].length = sizeof(frame->header);
+    handle->iov[1].base   = (void *)(uint32_t)frame->samples;
+    handle->iov[1].length = (uint32_t)frame->header.count * sizeof(uint16_t);
+    handle->iov[2].base   = &frame->crc;
+    handle->iov[2].length = sizeof(frame->crc);
+
+    if (kStatus_Success == LPUART_SendEDMAIov(handle->base, &handle->lpuartHandle, handle->iov,
+                                              ADC_TELEMETRY_TCD_COUNT))
+    {
+        handle->sending = true;
+        return NULL;
+    }
+
+    handle->tail = (handle->tail + 1U) % handle->frameCount;
+    handle->queued--;
+    handle->failed++;
+
+    return frame->samples;
+}
+
+/* Sends the next queued frame when the link is idle, and gives back the samples of every frame dropped on the way. */
+static void ADC_TelemetryStartNext(adc_telemetry_handle_t *handle)
+{
+    const uint16_t *samples;
+    uint32_t primask;
+
+    do
+    {
+        samples = NULL;
+        primask = DisableGlobalIRQ();
+        if ((!handle->sending) && (handle->queued != 0U))
+        {
+            samples = ADC_TelemetrySendNext(handle);
+        }
+        EnableGlobalIRQ(primask);
+
+        if ((samples != NULL) && (handle->callback != NULL))
+        {
+            handle->callback(handle, samples, handle->userData);
+        }
+    } while (samples != NULL);
+}
+
+static void ADC_TelemetryCallback(LPUART_Type *base, lpuart_edma_handle_t *handle, status_t status, void *userData)
+{
+    adc_telemetry_handle_t *telemetry = (adc_telemetry_handle_t *)userData;
+    const uint16_t *samples;
+    uint32_t primask;
+
+    if (status != kStatus_LPUART_TxIdle)
+    {
+        return;
+    }
+
+    samples = telemetry->frames[telemetry->tail].samples;
+
+    primask         = DisableGlobalIRQ();
+    telemetry->tail = (telemetry->tail + 1U) % telemetry->frameCount;
+    telemetry->queued--;
+    telemetry->sent++;
+    telemetry->sending = false;
+    EnableGlobalIRQ(primask);
+
+    if (telemetry->callback != NULL)
+    {
+        telemetry->callback(telemetry, samples, telemetry->userData);
+    }
+
+    ADC_TelemetryStartNext(telemetry);
+}
+
+void ADC_TelemetryGetDefaultConfig(adc_telemetry_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base   = LPUART1;
+    config->source = (int32_t)kDmaRequestMuxLPUART1Tx;
+}
+
+status_t ADC_TelemetryCreate(adc_telemetry_handle_t *handle, DMA_Type *dma, const adc_telemetry_config_t *config)
+{
+    assert(handle != NULL);
+    assert(dma != NULL);
+    assert(config != NULL);
+    assert((config->frames != NULL) && (config->frameCount != 0U));
+    assert(config->tcdPool != NULL);
+
+    dmamgr_channel_config_t channelConfig;
+    status_t status;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base       = config->base;
+    handle->frames     = config->frames;
+    handle->frameCount = config->frameCount;
+    handle->callback   = config->callback;
+    handle->userData   = config->userData;
+
+    DMAMGR_GetDefaultChannelConfig(&channelConfig);
+    channelConfig.source = config->source;
+    status               = DMAMGR_RequestChannel(&channelConfig, &handle->channel);
+    if (status != kStatus_Success)
+    {
+        return status;
+    }
+
+    /* The header, the samples and the CRC are sent by one TCD each. */
+    EDMA_CreateHandle(&handle->edmaHandle, dma, handle->channel);
+    EDMA_InstallTCDMemory(&handle->edmaHandle, config->tcdPool, ADC_TELEMETRY_TCD_COUNT);
+    LPUART_TransferCreateHandleEDMA(config->base, &handle->lpuartHandle, ADC_TelemetryCallback, handle,
+                                    &handle->edmaHandle, NULL);
+
+    return kStatus_Success;
+}
+
+void ADC_TelemetryDestroy(adc_telemetry_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    LPUART_TransferAbortSendEDMA(handle->base, &handle->lpuartHandle);
+    (void)DMAMGR_ReleaseChannel(handle->channel);
+}
+
+status_t ADC_TelemetrySubmit(adc_telemetry_handle_t *handle,
+                             const uint16_t *samples,
+                             uint32_t count,
+                             uint32_t timestamp)
+{
+    assert(handle != NULL);
+    assert(samples != NULL);
+    assert((count != 0U) && (count <= ADC_TELEMETRY_MAX_COUNT));
+
+    adc_telemetry_frame_t *frame;
+    uint32_t primask;
+    uint32_t crc;
+
+    /* Only the producer moves head, the entry is not seen by the link until queued is incremented. */
+    if (handle->queued == handle->frameCount)
+    {
+        handle->sequence++;
+        handle->pendingDrops++;
+        handle->dropped++;
+        return kStatus_ADC_TelemetryDropped;
+    }
+
+    frame                   = &handle->frames[handle->head];
+    frame->header.sync      = ADC_TELEMETRY_SYNC;
+    frame->header.version   = ADC_TELEMETRY_VERSION;
+    frame->header.reserved  = 0U;
+    frame->header.sequence  = handle->sequence;
+    frame->header.timestamp = timestamp;
+    frame->header.count     = (uint16_t)count;
+    frame->header.dropped   = (uint16_t)MIN(handle->pendingDrops, ADC_TELEMETRY_MAX_DROPPED);
+    frame->samples          = samples;
+
+    crc        = ADC_TelemetryCrc(0xFFFFFFFFU, (const uint8_t *)&frame->header, sizeof(frame->header));
+    crc        = ADC_TelemetryCrc(crc, (const uint8_t *)samples, count * sizeof(uint16_t));
+    frame->crc = ~crc;
+
+    handle->head = (handle->head + 1U) % handle->frameCount;
+    handle->sequence++;
+    handle->pendingDrops = 0U;
+
+    /* Sent now when the link is idle, otherwise the callback sends the frame in turn. */
+    primask = DisableGlobalIRQ();
+    handle->queued++;
+    EnableGlobalIRQ(primask);
+
+    ADC_TelemetryStartNext(handle);
+
+    return kStatus_Success;
+}
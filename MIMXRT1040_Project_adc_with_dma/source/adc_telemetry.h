@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ADC_TELEMETRY_H_
+#define _ADC_TELEMETRY_H_
+
+#include "fsl_lpuart_edma.h"
+#include "fsl_dma_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief ADC telemetry status codes. */
+enum
+{
+    kStatus_ADC_TelemetryDropped = MAKE_STATUS(kStatusGroup_ApplicationRangeStart, 1), /*!< The queue is full, the
+                                                                                            block is not sent. */
+};
+
+/*! @brief First bytes of every frame, 0x5A then 0xA5 on the wire. */
+#define ADC_TELEMETRY_SYNC 0xA55AU
+/*! @brief Version of the frame format. */
+#define ADC_TELEMETRY_VERSION 1U
+/*! @brief Number of TCDs of the pool, one per segment of a frame. */
+#define ADC_TELEMETRY_TCD_COUNT 3U
+/*!
+ * @brief Largest number of samples of a block.
+ *
+ * The samples are sent by a single TCD of 1-byte transfers, so they are limited by the major loop count.
+ */
+#define ADC_TELEMETRY_MAX_COUNT (DMA_CITER_ELINKNO_CITER_MASK / sizeof(uint16_t))
+
+/*!
+ * @brief Frame header, little endian, followed by the samples and the CRC.
+ *
+ * The CRC is the CRC-32 of IEEE 802.3 (zlib crc32) of the header and the samples.
+ */
+typedef struct _adc_telemetry_header
+{
+    uint16_t sync;      /*!< ADC_TELEMETRY_SYNC. */
+    uint8_t version;    /*!< ADC_TELEMETRY_VERSION. */
+    uint8_t reserved;   /*!< Zero. */
+    uint32_t sequence;  /*!< Block number, dropped blocks use up their number too. */
+    uint32_t timestamp; /*!< Time of the block given by the producer, for example the index of its first sample. */
+    uint16_t count;     /*!< Number of samples. */
+    uint16_t dropped;   /*!< Blocks dropped right before this one, saturated at 0xFFFF. */
+} adc_telemetry_header_t;
+
+/*! @brief Queued frame, the samples are sent in place. */
+typedef struct _adc_telemetry_frame
+{
+    adc_telemetry_header_t header; /*!< Frame header. */
+    uint32_t crc;                  /*!< Frame CRC, sent after the samples. */
+    const uint16_t *samples;       /*!< Samples of the block. */
+} adc_telemetry_frame_t;
+
+/*! @brief ADC telemetry handle. */
+typedef struct _adc_telemetry_handle adc_telemetry_handle_t;
+
+/*!
+ * @brief Block done callback, called from the LPUART interrupt.
+ *
+ * The samples are no longer read, the producer can reuse them, for example with ADC_CaptureReleaseHalf. A queued
+ * block the LPUART driver refuses is dropped and given back the same way, from the context that tried to send it.
+ */
+typedef void (*adc_telemetry_callback_t)(adc_telemetry_handle_t *handle, const uint16_t *samples, void *userData);
+
+/*! @brief ADC telemetry configuration. */
+typedef struct _adc_telemetry_config
+{
+    LPUART_Type *base;                 /*!< LPUART peripheral, already initialized. */
+    int32_t source;                    /*!< DMAMUX request source of the LPUART transmitter. */
+    adc_telemetry_frame_t *frames;     /*!< Queue storage, frameCount entries. */
+    uint32_t frameCount;               /*!< Number of blocks that can wait for the link, at least 1. */
+    edma_tcd_t *tcdPool;               /*!< ADC_TELEMETRY_TCD_COUNT TCDs, 32-byte aligned. */
+    adc_telemetry_callback_t callback; /*!< Block sent callback, can be NULL. */
+    void *userData;                    /*!< Parameter passed to the callback. */
+} adc_telemetry_config_t;
+
+/*! @brief ADC telemetry handle, users shall not touch the values inside. */
+struct _adc_telemetry_handle
+{
+    LPUART_Type *base;                          /*!< LPUART peripheral. */
+    uint32_t channel;                           /*!< eDMA channel of the transmitter. */
+    edma_handle_t edmaHandle;                   /*!< eDMA handle of the transmitter. */
+    lpuart_edma_handle_t lpuartHandle;          /*!< LPUART eDMA handle. */
+    edma_iovec_t iov[ADC_TELEMETRY_TCD_COUNT];  /*!< Segments of the frame being sent. */
+    adc_telemetry_frame_t *frames;              /*!< Queue storage. */
+    uint32_t frameCount;                        /*!< Number of queue entries. */
+    uint32_t head;                              /*!< Next entry to fill. */
+    uint32_t tail;                              /*!< Entry being sent. */
+    volatile uint32_t queued;                   /*!< Entries waiting or being sent. */
+    bool sending;                               /*!< The entry at the tail is on the link. */
+    uint32_t sequence;                          /*!< Sequence number of the next block. */
+    uint32_t pendingDrops;                      /*!< Blocks dropped since the last queued one. */
+    adc_telemetry_callback_t callback;          /*!< Block sent callback. */
+    void *userData;                             /*!< Parameter passed to the callback. */
+    volatile uint32_t sent;                     /*!< Number of sent blocks. */
+    volatile uint32_t dropped;                  /*!< Number of blocks dropped because the queue was full. */
+    volatile uint32_t failed;                   /*!< Number of queued blocks the LPUART driver refused. */
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default telemetry configuration.
+ *
+ * The default configuration sends through LPUART1, the queue storage and the TCD pool have to be set.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void ADC_TelemetryGetDefaultConfig(adc_telemetry_config_t *config);
+
+/*!
+ * @brief Creates a binary telemetry sink for ADC blocks.
+ *
+ * Every block becomes one frame: a header with the sequence number, the timestamp and the sample count, the samples
+ * and a CRC. The frame is sent by LPUART_SendEDMAIov as three segments, the samples are read from the capture buffer
+ * without a copy. The channel is requested from the DMA manager, which must be initialized by DMAMGR_Init.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @param dma eDMA peripheral base address, initialized by EDMA_Init.
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The sink is ready.
+ * @retval kStatus_DMAMGR_NoFreeChannel No channel left.
+ * @note The queue storage and the samples should be non-cacheable, the eDMA reads them.
+ */
+status_t ADC_TelemetryCreate(adc_telemetry_handle_t *handle, DMA_Type *dma, const adc_telemetry_config_t *config);
+
+/*!
+ * @brief Aborts the frame being sent and releases the channel to the DMA manager.
+ *
+ * The callback is not called for the queued blocks.
+ *
+ * @param handle Pointer to the telemetry handle.
+ */
+void ADC_TelemetryDestroy(adc_telemetry_handle_t *handle);
+
+/*!
+ * @brief Queues a block for sending.
+ *
+ * The CRC is computed here, then the frame waits for the link. The samples must stay unchanged until the callback
+ * reports the block sent. When the link is slower than the ADC the queue fills up and the block is dropped. The
+ * dropped block still uses up its sequence number and the next frame carries the count, so the receiver can tell
+ * the drops from link errors. The blocks are submitted from one context, for example the ADC callback.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @param samples Samples of the block.
+ * @param count Number of samples, up to ADC_TELEMETRY_MAX_COUNT.
+ * @param timestamp Time of the block.
+ * @retval kStatus_Success The block is queued.
+ * @retval kStatus_ADC_TelemetryDropped The queue is full, the block is dropped.
+ */
+status_t ADC_TelemetrySubmit(adc_telemetry_handle_t *handle,
+                             const uint16_t *samples,
+                             uint32_t count,
+                             uint32_t timestamp);
+
+/*!
+ * @brief Gets the number of blocks that can be queued, the producer can slow down before blocks are dropped.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @return Number of free queue entries.
+ */
+static inline uint32_t ADC_TelemetryGetFreeCount(adc_telemetry_handle_t *handle)
+{
+    return handle->frameCount - handle->queued;
+}
+
+/*!
+ * @brief Gets the number of blocks dropped because the queue was full.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @return Number of drops since ADC_TelemetryCreate.
+ */
+static inline uint32_t ADC_TelemetryGetDropCount(adc_telemetry_handle_t *handle)
+{
+    return handle->dropped;
+}
+
+/*!
+ * @brief Gets the number of queued blocks that were dropped because the LPUART driver refused them.
+ *
+ * The receiver sees them as gaps in the sequence numbers, like the blocks dropped because the queue was full.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @return Number of refused blocks since ADC_TelemetryCreate.
+ */
+static inline uint32_t ADC_TelemetryGetFailCount(adc_telemetry_handle_t *handle)
+{
+    return handle->failed;
+}
+
+/*!
+ * @brief Gets the number of sent blocks.
+ *
+ * @param handle Pointer to the telemetry handle.
+ * @return Number of blocks sent since ADC_TelemetryCreate.
+ */
+static inline uint32_t ADC_TelemetryGetSentCount(adc_telemetry_handle_t *handle)
+{
+    return handle->sent;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _ADC_TELEMETRY_H_ */
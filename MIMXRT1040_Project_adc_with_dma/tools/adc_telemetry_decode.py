@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 NXP
+# All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+"""Decodes the ADC telemetry frames sent by adc_telemetry.c.
+
+Frame, little endian:
+    uint16 sync (0xA55A), uint8 version, uint8 reserved,
+    uint32 sequence, uint32 timestamp, uint16 count, uint16 dropped,
+    uint16 samples[count],
+    uint32 crc, zlib crc32 of the header and the samples.
+
+The sequence numbers are checked for continuity. A gap announced by the dropped field of the next frame was dropped
+by the board because the link was too slow, any other gap is a frame lost or corrupted on the link.
+
+Usage:
+    adc_telemetry_decode.py /dev/ttyACM0 --baud 115200
+    adc_telemetry_decode.py capture.bin --csv samples.csv
+"""
+
+import argparse
+import os
+import struct
+import sys
+import termios
+import zlib
+
+HEADER = struct.Struct("<HBBIIHH")
+CRC = struct.Struct("<I")
+SYNC = b"\x5a\xa5"
+VERSION = 1
+
+
+def open_input(path, baud):
+    """Opens a file, or a serial port in raw mode."""
+    stream = open(path, "rb", buffering=0)
+    if os.isatty(stream.fileno()):
+        attrs = termios.tcgetattr(stream.fileno())
+        speed = getattr(termios, "B%d" % baud)
+        attrs[0] = 0                                    # iflag
+        attrs[1] = 0                                    # oflag
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                    # lflag
+        attrs[4] = speed
+        attrs[5] = speed
+        attrs[6][termios.VMIN] = 1
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(stream.fileno(), termios.TCSANOW, attrs)
+    return stream
+
+
+class Decoder:
+    """Finds the frames in a byte stream and keeps the link statistics."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.expected = None
+        self.frames = 0
+        self.dropped = 0
+        self.lost = 0
+        self.crc_errors = 0
+        self.skipped = 0
+
+    def feed(self, data):
+        """Adds bytes, returns the decoded frames as (sequence, timestamp, samples)."""
+        self.buffer += data
+        frames = []
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a possible first sync byte.
+                keep = 1 if self.buffer.endswith(SYNC[:1]) else 0
+                self.skipped += len(self.buffer) - keep
+                del self.buffer[:len(self.buffer) - keep]
+                return frames
+            self.skipped += start
+            del self.buffer[:start]
+
+            if len(self.buffer) < HEADER.size:
+                return frames
+            sync, version, _, sequence, timestamp, count, dropped = HEADER.unpack_from(self.buffer)
+            if version != VERSION:
+                # Not a header, look for the next sync.
+                self.skipped += 1
+                del self.buffer[:1]
+                continue
+
+            size = HEADER.size + 2 * count + CRC.size
+            if len(self.buffer) < size:
+                return frames
+            crc, = CRC.unpack_from(self.buffer, size - CRC.size)
+            if zlib.crc32(bytes(self.buffer[:size - CRC.size])) != crc:
+                # Corrupted, or a false sync inside the samples.
+                self.crc_errors += 1
+                self.skipped += 1
+                del self.buffer[:1]
+                continue
+
+            samples = struct.unpack_from("<%dH" % count, self.buffer, HEADER.size)
+            del self.buffer[:size]
+            self.check_sequence(sequence, dropped)
+            self.frames += 1
+            frames.append((sequence, timestamp, samples))
+
+    def check_sequence(self, sequence, dropped):
+        if self.expected is not None:
+            gap = (sequence - self.expected) & 0xFFFFFFFF
+            if gap != 0:
+                announced = min(gap, dropped)
+                self.dropped += announced
+                self.lost += gap - announced
+                print("sequence %u: expected %u, %u dropped by the board, %u lost on the link"
+                      % (sequence, self.expected, announced, gap - announced), file=sys.stderr)
+        self.expected = (sequence + 1) & 0xFFFFFFFF
+
+    def summary(self):
+        return ("%u frames, %u dropped by the board, %u lost on the link, %u CRC errors, %u bytes skipped"
+                % (self.frames, self.dropped, self.lost, self.crc_errors, self.skipped))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="serial port or capture file")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of a serial port")
+    parser.add_argument("--csv", help="write timestamp,sample lines to this file")
+    parser.add_argument("--quiet", action="store_true", help="only print the summary")
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    csv = open(args.csv, "w") if args.csv else None
+    stream = open_input(args.input, args.baud)
+    try:
+        while True:
+            data = stream.read(4096)
+            if not data:
+                break
+            for sequence, timestamp, samples in decoder.feed(data):
+                if not args.quiet:
+                    print("#%u t=%u n=%u first=%u last=%u" % (sequence, timestamp, len(samples), samples[0],
+                                                              samples[-1]))
+                if csv:
+                    for i, sample in enumerate(samples):
+                        csv.write("%u,%u\n" % (timestamp + i, sample))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        stream.close()
+        if csv:
+            csv.close()
+
+    print(decoder.summary())
+    return 0 if (decoder.lost == 0 and decoder.crc_errors == 0) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
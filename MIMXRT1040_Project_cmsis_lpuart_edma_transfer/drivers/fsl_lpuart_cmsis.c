@@ -218,7 +218,7 @@
      (defined(RTE_USART19) && RTE_USART19 && (defined(LPUART19) || defined(LPUART_19))) || \
      (defined(RTE_USART20) && RTE_USART10 && (defined(LPUART20) || defined(LPUART_20))))
 
-#define ARM_LPUART_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR((2), (7))
+#define ARM_LPUART_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR((2), (10))
 
 /*
  * ARMCC does not support split the data section automatically, so the driver
@@ -302,6 +302,11 @@ typedef struct _cmsis_lpuart_edma_driver_state
     edma_handle_t *txHandle;                   /*!< EDMA TX handle.              */
     ARM_USART_SignalEvent_t cb_event;          /*!< Callback function.     */
     uint8_t flags;                             /*!< Control and state flags. */
+    edma_tcd_t *txTcds;                        /*!< TCD pool of the send queue, NULL for no queue. */
+    uint32_t txTcdCount;                       /*!< Number of TCDs of the send queue. */
+    lpuart_handle_t *irqHandle;                /*!< Interrupt transfer handle, NULL for eDMA transfers only. */
+    uint32_t txDmaMinSize;                     /*!< Shortest eDMA send, shorter ones use irqHandle. */
+    uint32_t rxDmaMinSize;                     /*!< Shortest eDMA receive, shorter ones use irqHandle. */
 } cmsis_lpuart_edma_driver_state_t;
 #endif
 
@@ -819,6 +824,11 @@ static void KSDK_LPUART_EdmaCallback(LPUART_Type *base, lpuart_edma_handle_t *ha
     uint32_t event = 0U;
 
     if (kStatus_LPUART_TxIdle == status)
+    {
+        /* With the send queue, each Send completes on its own, this is the end of the last one on the line. */
+        event = (0U != handle->txQueueSize) ? ARM_USART_EVENT_TX_COMPLETE : ARM_USART_EVENT_SEND_COMPLETE;
+    }
+    if (kStatus_LPUART_TxBufferSent == status)
     {
         event = ARM_USART_EVENT_SEND_COMPLETE;
     }
@@ -826,6 +836,15 @@ static void KSDK_LPUART_EdmaCallback(LPUART_Type *base, lpuart_edma_handle_t *ha
     {
         event = ARM_USART_EVENT_RECEIVE_COMPLETE;
     }
+    /* Continuous receive, the byte count is given by GetRxCount. */
+    if (kStatus_LPUART_IdleLineDetected == status)
+    {
+        event = ARM_USART_EVENT_RX_TIMEOUT;
+    }
+    if (kStatus_LPUART_RxRingBufferOverrun == status)
+    {
+        event = ARM_USART_EVENT_RX_OVERFLOW;
+    }
 
     /* User data is actually CMSIS driver callback. */
     if ((0U != event) && (userData != NULL))
@@ -834,6 +853,61 @@ static void KSDK_LPUART_EdmaCallback(LPUART_Type *base, lpuart_edma_handle_t *ha
     }
 }
 
+/* Callback of the interrupt transfers of an instance holding both handles, user data is the driver state. */
+static void KSDK_LPUART_HybridCallback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+{
+    cmsis_lpuart_edma_driver_state_t *lpuart = (cmsis_lpuart_edma_driver_state_t *)userData;
+    uint32_t event                           = 0U;
+
+    if (kStatus_LPUART_TxIdle == status)
+    {
+        event = ARM_USART_EVENT_SEND_COMPLETE;
+        /* The line is idle, as signaled at the end of the send queue. */
+        if (0U != lpuart->handle->txQueueSize)
+        {
+            event |= ARM_USART_EVENT_TX_COMPLETE;
+        }
+    }
+    if (kStatus_LPUART_RxIdle == status)
+    {
+        event = ARM_USART_EVENT_RECEIVE_COMPLETE;
+    }
+    if (kStatus_LPUART_RxHardwareOverrun == status)
+    {
+        event = ARM_USART_EVENT_RX_OVERFLOW;
+    }
+
+    if ((0U != event) && (lpuart->cb_event != NULL))
+    {
+        lpuart->cb_event(event);
+    }
+}
+
+/* LPUART IRQ handler of an instance holding both handles, the handle is the driver state. */
+static void LPUART_HybridHandleIRQ(LPUART_Type *base, void *irqHandle)
+{
+    cmsis_lpuart_edma_driver_state_t *lpuart = (cmsis_lpuart_edma_driver_state_t *)irqHandle;
+    bool ringRunning                         = (NULL != lpuart->handle->rxRingBuffer);
+
+    /* Only takes the TC interrupt during an eDMA send, it is the interrupt transfer's otherwise. */
+    LPUART_TransferEdmaHandleIRQ(base, lpuart->handle);
+
+    if (((uint8_t)kLPUART_TxBusy == lpuart->irqHandle->txState) ||
+        ((uint8_t)kLPUART_RxBusy == lpuart->irqHandle->rxState))
+    {
+        /* The interrupt transfer handler would disable the idle line interrupt of the continuous receive. */
+        if (ringRunning)
+        {
+            LPUART_DisableInterrupts(base, (uint32_t)kLPUART_IdleLineInterruptEnable);
+        }
+        LPUART_TransferHandleIRQ(base, lpuart->irqHandle);
+        if (ringRunning)
+        {
+            LPUART_EnableInterrupts(base, (uint32_t)kLPUART_IdleLineInterruptEnable);
+        }
+    }
+}
+
 static int32_t LPUART_EdmaInitialize(ARM_USART_SignalEvent_t cb_event, cmsis_lpuart_edma_driver_state_t *lpuart)
 {
     if (0U == (lpuart->flags & (uint8_t)USART_FLAG_INIT))
@@ -855,12 +929,17 @@ static int32_t LPUART_EdmaPowerControl(ARM_POWER_STATE state, cmsis_lpuart_edma_
 {
     lpuart_config_t config;
     cmsis_lpuart_edma_resource_t *dmaResource;
+    uint32_t instance;
     int32_t result = ARM_DRIVER_OK;
     switch (state)
     {
         case ARM_POWER_OFF:
             if ((lpuart->flags & (uint8_t)USART_FLAG_POWER) != 0U)
             {
+                if (NULL != lpuart->handle->rxRingBuffer)
+                {
+                    LPUART_TransferStopRingBufferEDMA(lpuart->resource->base, lpuart->handle);
+                }
                 LPUART_Deinit(lpuart->resource->base);
 
 #if (defined(FSL_FEATURE_SOC_DMAMUX_COUNT) && FSL_FEATURE_SOC_DMAMUX_COUNT)
@@ -913,6 +992,20 @@ static int32_t LPUART_EdmaPowerControl(ARM_POWER_STATE state, cmsis_lpuart_edma_
             (void)LPUART_Init(lpuart->resource->base, &config, lpuart->resource->GetFreq());
             LPUART_TransferCreateHandleEDMA(lpuart->resource->base, lpuart->handle, KSDK_LPUART_EdmaCallback,
                                             (void *)lpuart->cb_event, lpuart->txHandle, lpuart->rxHandle);
+            if (NULL != lpuart->txTcds)
+            {
+                LPUART_TransferEnableSendQueueEDMA(lpuart->resource->base, lpuart->handle, lpuart->txTcds,
+                                                   lpuart->txTcdCount);
+            }
+            if (NULL != lpuart->irqHandle)
+            {
+                /* Both handles, the LPUART IRQ goes to the hybrid handler instead of the eDMA one. */
+                LPUART_TransferCreateHandle(lpuart->resource->base, lpuart->irqHandle, KSDK_LPUART_HybridCallback,
+                                            lpuart);
+                instance                 = LPUART_GetInstance(lpuart->resource->base);
+                s_lpuartHandle[instance] = lpuart;
+                s_lpuartIsr[instance]    = LPUART_HybridHandleIRQ;
+            }
 
             lpuart->flags |= ((uint8_t)USART_FLAG_POWER | (uint8_t)USART_FLAG_CONFIGURED);
             break;
@@ -933,7 +1026,23 @@ static int32_t LPUART_EdmaSend(const void *data, uint32_t num, cmsis_lpuart_edma
     xfer.data     = (uint8_t *)data;
     xfer.dataSize = num;
 
-    status = LPUART_SendEDMA(lpuart->resource->base, lpuart->handle, &xfer);
+    if ((NULL != lpuart->irqHandle) && ((uint8_t)kLPUART_TxBusy == lpuart->irqHandle->txState))
+    {
+        /* One path sends at a time, the bytes reach the FIFO in order. */
+        status = kStatus_LPUART_TxBusy;
+    }
+    else if ((NULL != lpuart->irqHandle) && (num < lpuart->txDmaMinSize) &&
+             ((uint8_t)kLPUART_TxIdle == lpuart->handle->txState))
+    {
+        /* Below the crossover, the FIFO interrupts cost less CPU than the eDMA setup and completion. */
+        lpuart->flags |= (uint8_t)USART_FLAG_TX_INTERRUPT;
+        status = LPUART_TransferSendNonBlocking(lpuart->resource->base, lpuart->irqHandle, &xfer);
+    }
+    else
+    {
+        lpuart->flags &= ~(uint8_t)USART_FLAG_TX_INTERRUPT;
+        status = LPUART_SendEDMA(lpuart->resource->base, lpuart->handle, &xfer);
+    }
 
     switch (status)
     {
@@ -943,6 +1052,10 @@ static int32_t LPUART_EdmaSend(const void *data, uint32_t num, cmsis_lpuart_edma
         case kStatus_InvalidArgument:
             ret = ARM_DRIVER_ERROR_PARAMETER;
             break;
+        /* Previous send ongoing, or the send queue is full. */
+        case kStatus_LPUART_TxBusy:
+            ret = ARM_DRIVER_ERROR_BUSY;
+            break;
         case kStatus_LPUART_RxBusy:
             ret = ARM_DRIVER_ERROR_BUSY;
             break;
@@ -963,7 +1076,32 @@ static int32_t LPUART_EdmaReceive(void *data, uint32_t num, cmsis_lpuart_edma_dr
     xfer.data     = (uint8_t *)data;
     xfer.dataSize = num;
 
-    status = LPUART_ReceiveEDMA(lpuart->resource->base, lpuart->handle, &xfer);
+    if ((NULL != lpuart->irqHandle) && ((uint8_t)kLPUART_RxBusy == lpuart->irqHandle->rxState))
+    {
+        status = kStatus_LPUART_RxBusy;
+    }
+    else if (0U != (lpuart->flags & (uint8_t)USART_FLAG_RX_CONTINUOUS))
+    {
+        /* The buffer becomes the ring, the receive is never re-armed. */
+        if ((0U == num) || (0U != (num & (num - 1U))))
+        {
+            return ARM_DRIVER_ERROR_PARAMETER;
+        }
+        lpuart->flags &= ~(uint8_t)USART_FLAG_RX_INTERRUPT;
+        status = LPUART_TransferStartRingBufferEDMA(lpuart->resource->base, lpuart->handle, (uint8_t *)data, num);
+    }
+    else if ((NULL != lpuart->irqHandle) && (num < lpuart->rxDmaMinSize) &&
+             ((uint8_t)kLPUART_RxIdle == lpuart->handle->rxState) && (NULL == lpuart->handle->rxRingBuffer))
+    {
+        /* Below the crossover, the FIFO interrupts cost less CPU than the eDMA setup and completion. */
+        lpuart->flags |= (uint8_t)USART_FLAG_RX_INTERRUPT;
+        status = LPUART_TransferReceiveNonBlocking(lpuart->resource->base, lpuart->irqHandle, &xfer, NULL);
+    }
+    else
+    {
+        lpuart->flags &= ~(uint8_t)USART_FLAG_RX_INTERRUPT;
+        status = LPUART_ReceiveEDMA(lpuart->resource->base, lpuart->handle, &xfer);
+    }
 
     switch (status)
     {
@@ -976,6 +1114,9 @@ static int32_t LPUART_EdmaReceive(void *data, uint32_t num, cmsis_lpuart_edma_dr
         case kStatus_LPUART_TxBusy:
             ret = ARM_DRIVER_ERROR_BUSY;
             break;
+        case kStatus_LPUART_RxBusy:
+            ret = ARM_DRIVER_ERROR_BUSY;
+            break;
         default:
             ret = ARM_DRIVER_ERROR;
             break;
@@ -997,6 +1138,16 @@ static uint32_t LPUART_EdmaGetTxCount(cmsis_lpuart_edma_driver_state_t *lpuart)
 {
     uint32_t cnt;
 
+    if (0U != (lpuart->flags & (uint8_t)USART_FLAG_TX_INTERRUPT))
+    {
+        if (kStatus_NoTransferInProgress ==
+            LPUART_TransferGetSendCount(lpuart->resource->base, lpuart->irqHandle, &cnt))
+        {
+            cnt = lpuart->irqHandle->txDataSizeAll;
+        }
+        return cnt;
+    }
+
     if (kStatus_NoTransferInProgress == LPUART_TransferGetSendCountEDMA(lpuart->resource->base, lpuart->handle, &cnt))
     {
         cnt = lpuart->handle->txDataSizeAll;
@@ -1009,6 +1160,21 @@ static uint32_t LPUART_EdmaGetRxCount(cmsis_lpuart_edma_driver_state_t *lpuart)
 {
     uint32_t cnt;
 
+    if (NULL != lpuart->handle->rxRingBuffer)
+    {
+        return (uint32_t)LPUART_TransferGetRxRingBufferLengthEDMA(lpuart->resource->base, lpuart->handle);
+    }
+
+    if (0U != (lpuart->flags & (uint8_t)USART_FLAG_RX_INTERRUPT))
+    {
+        if (kStatus_NoTransferInProgress ==
+            LPUART_TransferGetReceiveCount(lpuart->resource->base, lpuart->irqHandle, &cnt))
+        {
+            cnt = lpuart->irqHandle->rxDataSizeAll;
+        }
+        return cnt;
+    }
+
     if (kStatus_NoTransferInProgress ==
         LPUART_TransferGetReceiveCountEDMA(lpuart->resource->base, lpuart->handle, &cnt))
     {
@@ -1038,16 +1204,61 @@ static int32_t LPUART_EdmaControl(uint32_t control, uint32_t arg, cmsis_lpuart_e
     {
         /* Abort Send */
         case ARM_USART_ABORT_SEND:
-            LPUART_TransferAbortSendEDMA(lpuart->resource->base, lpuart->handle);
+            if (0U != (lpuart->flags & (uint8_t)USART_FLAG_TX_INTERRUPT))
+            {
+                LPUART_TransferAbortSend(lpuart->resource->base, lpuart->irqHandle);
+            }
+            else
+            {
+                LPUART_TransferAbortSendEDMA(lpuart->resource->base, lpuart->handle);
+            }
             result = ARM_DRIVER_OK;
             break;
 
         /* Abort receive */
         case ARM_USART_ABORT_RECEIVE:
-            LPUART_TransferAbortReceiveEDMA(lpuart->resource->base, lpuart->handle);
+            if (0U != (lpuart->flags & (uint8_t)USART_FLAG_RX_INTERRUPT))
+            {
+                LPUART_TransferAbortReceive(lpuart->resource->base, lpuart->irqHandle);
+            }
+            else
+            {
+                LPUART_TransferAbortReceiveEDMA(lpuart->resource->base, lpuart->handle);
+            }
             result = ARM_DRIVER_OK;
             break;
 
+        /* Continuous receive, started by the next Receive */
+        case ARM_USART_CONTROL_RX_CONTINUOUS:
+            if (arg != 0U)
+            {
+                lpuart->flags |= (uint8_t)USART_FLAG_RX_CONTINUOUS;
+            }
+            else
+            {
+                if (NULL != lpuart->handle->rxRingBuffer)
+                {
+                    LPUART_TransferStopRingBufferEDMA(lpuart->resource->base, lpuart->handle);
+                }
+                lpuart->flags &= ~(uint8_t)USART_FLAG_RX_CONTINUOUS;
+            }
+            result = ARM_DRIVER_OK;
+            break;
+
+        /* Read the continuous receive */
+        case ARM_USART_READ_AVAILABLE:
+            if (NULL == lpuart->handle->rxRingBuffer)
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                result = (int32_t)LPUART_TransferReadRingBufferEDMA(lpuart->resource->base, lpuart->handle,
+                                                                    ((lpuart_transfer_t *)arg)->data,
+                                                                    ((lpuart_transfer_t *)arg)->dataSize);
+            }
+            break;
+
         default:
             isContinue = true;
             break;
@@ -1066,6 +1277,11 @@ static ARM_USART_STATUS LPUART_EdmaGetStatus(cmsis_lpuart_edma_driver_state_t *l
 
     stat.tx_busy = (((uint8_t)kLPUART_TxBusy == lpuart->handle->txState) ? (1U) : (0U));
     stat.rx_busy = (((uint8_t)kLPUART_RxBusy == lpuart->handle->rxState) ? (1U) : (0U));
+    if (NULL != lpuart->irqHandle)
+    {
+        stat.tx_busy |= (((uint8_t)kLPUART_TxBusy == lpuart->irqHandle->txState) ? (1U) : (0U));
+        stat.rx_busy |= (((uint8_t)kLPUART_RxBusy == lpuart->irqHandle->rxState) ? (1U) : (0U));
+    }
 
     stat.tx_underflow = 0U;
     stat.rx_overflow  = (uint32_t)(((ksdk_lpuart_status & (uint32_t)kLPUART_RxOverrunFlag)) != 0U);
@@ -1492,6 +1708,19 @@ static cmsis_lpuart_edma_resource_t LPUART0_EdmaResource = {
 static lpuart_edma_handle_t LPUART0_EdmaHandle;
 static edma_handle_t LPUART0_EdmaRxHandle;
 static edma_handle_t LPUART0_EdmaTxHandle;
+#if !defined(RTE_USART0_DMA_TX_MIN_SIZE)
+#define RTE_USART0_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART0_DMA_RX_MIN_SIZE)
+#define RTE_USART0_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART0_DMA_TX_MIN_SIZE || RTE_USART0_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART0_Handle;
+#endif
+#if defined(RTE_USART0_DMA_TX_QUEUE_LEN) && RTE_USART0_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART0_EdmaTxTcds[RTE_USART0_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart0_edma_driver_state")
@@ -1500,6 +1729,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART0_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART0_EdmaDriverState = {
 #endif
     &LPUART0_Resource, &LPUART0_EdmaResource, &LPUART0_EdmaHandle, &LPUART0_EdmaRxHandle, &LPUART0_EdmaTxHandle,
+#if defined(RTE_USART0_DMA_TX_QUEUE_LEN) && RTE_USART0_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART0_EdmaTxTcds, RTE_USART0_DMA_TX_QUEUE_LEN,
+#elif RTE_USART0_DMA_TX_MIN_SIZE || RTE_USART0_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART0_DMA_TX_MIN_SIZE || RTE_USART0_DMA_RX_MIN_SIZE
+    &LPUART0_Handle, RTE_USART0_DMA_TX_MIN_SIZE, RTE_USART0_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART0_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -1818,6 +2055,19 @@ static cmsis_lpuart_edma_resource_t LPUART1_EdmaResource = {
 static lpuart_edma_handle_t LPUART1_EdmaHandle;
 static edma_handle_t LPUART1_EdmaRxHandle;
 static edma_handle_t LPUART1_EdmaTxHandle;
+#if !defined(RTE_USART1_DMA_TX_MIN_SIZE)
+#define RTE_USART1_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART1_DMA_RX_MIN_SIZE)
+#define RTE_USART1_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART1_DMA_TX_MIN_SIZE || RTE_USART1_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART1_Handle;
+#endif
+#if defined(RTE_USART1_DMA_TX_QUEUE_LEN) && RTE_USART1_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART1_EdmaTxTcds[RTE_USART1_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart1_edma_driver_state")
@@ -1826,6 +2076,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART1_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART1_EdmaDriverState = {
 #endif
     &LPUART1_Resource, &LPUART1_EdmaResource, &LPUART1_EdmaHandle, &LPUART1_EdmaRxHandle, &LPUART1_EdmaTxHandle,
+#if defined(RTE_USART1_DMA_TX_QUEUE_LEN) && RTE_USART1_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART1_EdmaTxTcds, RTE_USART1_DMA_TX_QUEUE_LEN,
+#elif RTE_USART1_DMA_TX_MIN_SIZE || RTE_USART1_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART1_DMA_TX_MIN_SIZE || RTE_USART1_DMA_RX_MIN_SIZE
+    &LPUART1_Handle, RTE_USART1_DMA_TX_MIN_SIZE, RTE_USART1_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART1_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -2133,6 +2391,19 @@ static cmsis_lpuart_edma_resource_t LPUART2_EdmaResource = {
 static lpuart_edma_handle_t LPUART2_EdmaHandle;
 static edma_handle_t LPUART2_EdmaRxHandle;
 static edma_handle_t LPUART2_EdmaTxHandle;
+#if !defined(RTE_USART2_DMA_TX_MIN_SIZE)
+#define RTE_USART2_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART2_DMA_RX_MIN_SIZE)
+#define RTE_USART2_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART2_DMA_TX_MIN_SIZE || RTE_USART2_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART2_Handle;
+#endif
+#if defined(RTE_USART2_DMA_TX_QUEUE_LEN) && RTE_USART2_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART2_EdmaTxTcds[RTE_USART2_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart2_edma_driver_state")
@@ -2141,6 +2412,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART2_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART2_EdmaDriverState = {
 #endif
     &LPUART2_Resource, &LPUART2_EdmaResource, &LPUART2_EdmaHandle, &LPUART2_EdmaRxHandle, &LPUART2_EdmaTxHandle,
+#if defined(RTE_USART2_DMA_TX_QUEUE_LEN) && RTE_USART2_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART2_EdmaTxTcds, RTE_USART2_DMA_TX_QUEUE_LEN,
+#elif RTE_USART2_DMA_TX_MIN_SIZE || RTE_USART2_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART2_DMA_TX_MIN_SIZE || RTE_USART2_DMA_RX_MIN_SIZE
+    &LPUART2_Handle, RTE_USART2_DMA_TX_MIN_SIZE, RTE_USART2_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART2_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -2448,6 +2727,19 @@ static cmsis_lpuart_edma_resource_t LPUART3_EdmaResource = {
 static lpuart_edma_handle_t LPUART3_EdmaHandle;
 static edma_handle_t LPUART3_EdmaRxHandle;
 static edma_handle_t LPUART3_EdmaTxHandle;
+#if !defined(RTE_USART3_DMA_TX_MIN_SIZE)
+#define RTE_USART3_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART3_DMA_RX_MIN_SIZE)
+#define RTE_USART3_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART3_DMA_TX_MIN_SIZE || RTE_USART3_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART3_Handle;
+#endif
+#if defined(RTE_USART3_DMA_TX_QUEUE_LEN) && RTE_USART3_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART3_EdmaTxTcds[RTE_USART3_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart3_edma_driver_state")
@@ -2456,6 +2748,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART3_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART3_EdmaDriverState = {
 #endif
     &LPUART3_Resource, &LPUART3_EdmaResource, &LPUART3_EdmaHandle, &LPUART3_EdmaRxHandle, &LPUART3_EdmaTxHandle,
+#if defined(RTE_USART3_DMA_TX_QUEUE_LEN) && RTE_USART3_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART3_EdmaTxTcds, RTE_USART3_DMA_TX_QUEUE_LEN,
+#elif RTE_USART3_DMA_TX_MIN_SIZE || RTE_USART3_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART3_DMA_TX_MIN_SIZE || RTE_USART3_DMA_RX_MIN_SIZE
+    &LPUART3_Handle, RTE_USART3_DMA_TX_MIN_SIZE, RTE_USART3_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART3_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -2763,6 +3063,19 @@ static cmsis_lpuart_edma_resource_t LPUART4_EdmaResource = {
 static lpuart_edma_handle_t LPUART4_EdmaHandle;
 static edma_handle_t LPUART4_EdmaRxHandle;
 static edma_handle_t LPUART4_EdmaTxHandle;
+#if !defined(RTE_USART4_DMA_TX_MIN_SIZE)
+#define RTE_USART4_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART4_DMA_RX_MIN_SIZE)
+#define RTE_USART4_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART4_DMA_TX_MIN_SIZE || RTE_USART4_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART4_Handle;
+#endif
+#if defined(RTE_USART4_DMA_TX_QUEUE_LEN) && RTE_USART4_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART4_EdmaTxTcds[RTE_USART4_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart4_edma_driver_state")
@@ -2771,6 +3084,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART4_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART4_EdmaDriverState = {
 #endif
     &LPUART4_Resource, &LPUART4_EdmaResource, &LPUART4_EdmaHandle, &LPUART4_EdmaRxHandle, &LPUART4_EdmaTxHandle,
+#if defined(RTE_USART4_DMA_TX_QUEUE_LEN) && RTE_USART4_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART4_EdmaTxTcds, RTE_USART4_DMA_TX_QUEUE_LEN,
+#elif RTE_USART4_DMA_TX_MIN_SIZE || RTE_USART4_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART4_DMA_TX_MIN_SIZE || RTE_USART4_DMA_RX_MIN_SIZE
+    &LPUART4_Handle, RTE_USART4_DMA_TX_MIN_SIZE, RTE_USART4_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART4_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -3080,6 +3401,19 @@ static cmsis_lpuart_edma_resource_t LPUART5_EdmaResource = {
 static lpuart_edma_handle_t LPUART5_EdmaHandle;
 static edma_handle_t LPUART5_EdmaRxHandle;
 static edma_handle_t LPUART5_EdmaTxHandle;
+#if !defined(RTE_USART5_DMA_TX_MIN_SIZE)
+#define RTE_USART5_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART5_DMA_RX_MIN_SIZE)
+#define RTE_USART5_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART5_DMA_TX_MIN_SIZE || RTE_USART5_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART5_Handle;
+#endif
+#if defined(RTE_USART5_DMA_TX_QUEUE_LEN) && RTE_USART5_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART5_EdmaTxTcds[RTE_USART5_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart5_edma_driver_state")
@@ -3088,6 +3422,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART5_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART5_EdmaDriverState = {
 #endif
     &LPUART5_Resource, &LPUART5_EdmaResource, &LPUART5_EdmaHandle, &LPUART5_EdmaRxHandle, &LPUART5_EdmaTxHandle,
+#if defined(RTE_USART5_DMA_TX_QUEUE_LEN) && RTE_USART5_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART5_EdmaTxTcds, RTE_USART5_DMA_TX_QUEUE_LEN,
+#elif RTE_USART5_DMA_TX_MIN_SIZE || RTE_USART5_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART5_DMA_TX_MIN_SIZE || RTE_USART5_DMA_RX_MIN_SIZE
+    &LPUART5_Handle, RTE_USART5_DMA_TX_MIN_SIZE, RTE_USART5_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART5_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -3397,6 +3739,19 @@ static cmsis_lpuart_edma_resource_t LPUART6_EdmaResource = {
 static lpuart_edma_handle_t LPUART6_EdmaHandle;
 static edma_handle_t LPUART6_EdmaRxHandle;
 static edma_handle_t LPUART6_EdmaTxHandle;
+#if !defined(RTE_USART6_DMA_TX_MIN_SIZE)
+#define RTE_USART6_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART6_DMA_RX_MIN_SIZE)
+#define RTE_USART6_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART6_DMA_TX_MIN_SIZE || RTE_USART6_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART6_Handle;
+#endif
+#if defined(RTE_USART6_DMA_TX_QUEUE_LEN) && RTE_USART6_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART6_EdmaTxTcds[RTE_USART6_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart6_edma_driver_state")
@@ -3405,6 +3760,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART6_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART6_EdmaDriverState = {
 #endif
     &LPUART6_Resource, &LPUART6_EdmaResource, &LPUART6_EdmaHandle, &LPUART6_EdmaRxHandle, &LPUART6_EdmaTxHandle,
+#if defined(RTE_USART6_DMA_TX_QUEUE_LEN) && RTE_USART6_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART6_EdmaTxTcds, RTE_USART6_DMA_TX_QUEUE_LEN,
+#elif RTE_USART6_DMA_TX_MIN_SIZE || RTE_USART6_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART6_DMA_TX_MIN_SIZE || RTE_USART6_DMA_RX_MIN_SIZE
+    &LPUART6_Handle, RTE_USART6_DMA_TX_MIN_SIZE, RTE_USART6_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART6_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -3714,6 +4077,19 @@ static cmsis_lpuart_edma_resource_t LPUART7_EdmaResource = {
 static lpuart_edma_handle_t LPUART7_EdmaHandle;
 static edma_handle_t LPUART7_EdmaRxHandle;
 static edma_handle_t LPUART7_EdmaTxHandle;
+#if !defined(RTE_USART7_DMA_TX_MIN_SIZE)
+#define RTE_USART7_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART7_DMA_RX_MIN_SIZE)
+#define RTE_USART7_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART7_DMA_TX_MIN_SIZE || RTE_USART7_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART7_Handle;
+#endif
+#if defined(RTE_USART7_DMA_TX_QUEUE_LEN) && RTE_USART7_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART7_EdmaTxTcds[RTE_USART7_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart7_edma_driver_state")
@@ -3722,6 +4098,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART7_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART7_EdmaDriverState = {
 #endif
     &LPUART7_Resource, &LPUART7_EdmaResource, &LPUART7_EdmaHandle, &LPUART7_EdmaRxHandle, &LPUART7_EdmaTxHandle,
+#if defined(RTE_USART7_DMA_TX_QUEUE_LEN) && RTE_USART7_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART7_EdmaTxTcds, RTE_USART7_DMA_TX_QUEUE_LEN,
+#elif RTE_USART7_DMA_TX_MIN_SIZE || RTE_USART7_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART7_DMA_TX_MIN_SIZE || RTE_USART7_DMA_RX_MIN_SIZE
+    &LPUART7_Handle, RTE_USART7_DMA_TX_MIN_SIZE, RTE_USART7_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART7_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -4031,6 +4415,19 @@ static cmsis_lpuart_edma_resource_t LPUART8_EdmaResource = {
 static lpuart_edma_handle_t LPUART8_EdmaHandle;
 static edma_handle_t LPUART8_EdmaRxHandle;
 static edma_handle_t LPUART8_EdmaTxHandle;
+#if !defined(RTE_USART8_DMA_TX_MIN_SIZE)
+#define RTE_USART8_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART8_DMA_RX_MIN_SIZE)
+#define RTE_USART8_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART8_DMA_TX_MIN_SIZE || RTE_USART8_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART8_Handle;
+#endif
+#if defined(RTE_USART8_DMA_TX_QUEUE_LEN) && RTE_USART8_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART8_EdmaTxTcds[RTE_USART8_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart8_edma_driver_state")
@@ -4039,6 +4436,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART8_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART8_EdmaDriverState = {
 #endif
     &LPUART8_Resource, &LPUART8_EdmaResource, &LPUART8_EdmaHandle, &LPUART8_EdmaRxHandle, &LPUART8_EdmaTxHandle,
+#if defined(RTE_USART8_DMA_TX_QUEUE_LEN) && RTE_USART8_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART8_EdmaTxTcds, RTE_USART8_DMA_TX_QUEUE_LEN,
+#elif RTE_USART8_DMA_TX_MIN_SIZE || RTE_USART8_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART8_DMA_TX_MIN_SIZE || RTE_USART8_DMA_RX_MIN_SIZE
+    &LPUART8_Handle, RTE_USART8_DMA_TX_MIN_SIZE, RTE_USART8_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART8_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -4348,6 +4753,19 @@ static cmsis_lpuart_edma_resource_t LPUART9_EdmaResource = {
 static lpuart_edma_handle_t LPUART9_EdmaHandle;
 static edma_handle_t LPUART9_EdmaRxHandle;
 static edma_handle_t LPUART9_EdmaTxHandle;
+#if !defined(RTE_USART9_DMA_TX_MIN_SIZE)
+#define RTE_USART9_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART9_DMA_RX_MIN_SIZE)
+#define RTE_USART9_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART9_DMA_TX_MIN_SIZE || RTE_USART9_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART9_Handle;
+#endif
+#if defined(RTE_USART9_DMA_TX_QUEUE_LEN) && RTE_USART9_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART9_EdmaTxTcds[RTE_USART9_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart9_edma_driver_state")
@@ -4356,6 +4774,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART9_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART9_EdmaDriverState = {
 #endif
     &LPUART9_Resource, &LPUART9_EdmaResource, &LPUART9_EdmaHandle, &LPUART9_EdmaRxHandle, &LPUART9_EdmaTxHandle,
+#if defined(RTE_USART9_DMA_TX_QUEUE_LEN) && RTE_USART9_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART9_EdmaTxTcds, RTE_USART9_DMA_TX_QUEUE_LEN,
+#elif RTE_USART9_DMA_TX_MIN_SIZE || RTE_USART9_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART9_DMA_TX_MIN_SIZE || RTE_USART9_DMA_RX_MIN_SIZE
+    &LPUART9_Handle, RTE_USART9_DMA_TX_MIN_SIZE, RTE_USART9_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART9_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -4665,6 +5091,19 @@ static cmsis_lpuart_edma_resource_t LPUART10_EdmaResource = {
 static lpuart_edma_handle_t LPUART10_EdmaHandle;
 static edma_handle_t LPUART10_EdmaRxHandle;
 static edma_handle_t LPUART10_EdmaTxHandle;
+#if !defined(RTE_USART10_DMA_TX_MIN_SIZE)
+#define RTE_USART10_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART10_DMA_RX_MIN_SIZE)
+#define RTE_USART10_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART10_DMA_TX_MIN_SIZE || RTE_USART10_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART10_Handle;
+#endif
+#if defined(RTE_USART10_DMA_TX_QUEUE_LEN) && RTE_USART10_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART10_EdmaTxTcds[RTE_USART10_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart10_edma_driver_state")
@@ -4673,6 +5112,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART10_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART10_EdmaDriverState = {
 #endif
     &LPUART10_Resource, &LPUART10_EdmaResource, &LPUART10_EdmaHandle, &LPUART10_EdmaRxHandle, &LPUART10_EdmaTxHandle,
+#if defined(RTE_USART10_DMA_TX_QUEUE_LEN) && RTE_USART10_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART10_EdmaTxTcds, RTE_USART10_DMA_TX_QUEUE_LEN,
+#elif RTE_USART10_DMA_TX_MIN_SIZE || RTE_USART10_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART10_DMA_TX_MIN_SIZE || RTE_USART10_DMA_RX_MIN_SIZE
+    &LPUART10_Handle, RTE_USART10_DMA_TX_MIN_SIZE, RTE_USART10_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART10_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -4982,6 +5429,19 @@ static cmsis_lpuart_edma_resource_t LPUART11_EdmaResource = {
 static lpuart_edma_handle_t LPUART11_EdmaHandle;
 static edma_handle_t LPUART11_EdmaRxHandle;
 static edma_handle_t LPUART11_EdmaTxHandle;
+#if !defined(RTE_USART11_DMA_TX_MIN_SIZE)
+#define RTE_USART11_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART11_DMA_RX_MIN_SIZE)
+#define RTE_USART11_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART11_DMA_TX_MIN_SIZE || RTE_USART11_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART11_Handle;
+#endif
+#if defined(RTE_USART11_DMA_TX_QUEUE_LEN) && RTE_USART11_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART11_EdmaTxTcds[RTE_USART11_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart11_edma_driver_state")
@@ -4990,6 +5450,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART11_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART11_EdmaDriverState = {
 #endif
     &LPUART11_Resource, &LPUART11_EdmaResource, &LPUART11_EdmaHandle, &LPUART11_EdmaRxHandle, &LPUART11_EdmaTxHandle,
+#if defined(RTE_USART11_DMA_TX_QUEUE_LEN) && RTE_USART11_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART11_EdmaTxTcds, RTE_USART11_DMA_TX_QUEUE_LEN,
+#elif RTE_USART11_DMA_TX_MIN_SIZE || RTE_USART11_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART11_DMA_TX_MIN_SIZE || RTE_USART11_DMA_RX_MIN_SIZE
+    &LPUART11_Handle, RTE_USART11_DMA_TX_MIN_SIZE, RTE_USART11_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART11_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -5299,6 +5767,19 @@ static cmsis_lpuart_edma_resource_t LPUART12_EdmaResource = {
 static lpuart_edma_handle_t LPUART12_EdmaHandle;
 static edma_handle_t LPUART12_EdmaRxHandle;
 static edma_handle_t LPUART12_EdmaTxHandle;
+#if !defined(RTE_USART12_DMA_TX_MIN_SIZE)
+#define RTE_USART12_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART12_DMA_RX_MIN_SIZE)
+#define RTE_USART12_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART12_DMA_TX_MIN_SIZE || RTE_USART12_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART12_Handle;
+#endif
+#if defined(RTE_USART12_DMA_TX_QUEUE_LEN) && RTE_USART12_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART12_EdmaTxTcds[RTE_USART12_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart12_edma_driver_state")
@@ -5307,6 +5788,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART12_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART12_EdmaDriverState = {
 #endif
     &LPUART12_Resource, &LPUART12_EdmaResource, &LPUART12_EdmaHandle, &LPUART12_EdmaRxHandle, &LPUART12_EdmaTxHandle,
+#if defined(RTE_USART12_DMA_TX_QUEUE_LEN) && RTE_USART12_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART12_EdmaTxTcds, RTE_USART12_DMA_TX_QUEUE_LEN,
+#elif RTE_USART12_DMA_TX_MIN_SIZE || RTE_USART12_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART12_DMA_TX_MIN_SIZE || RTE_USART12_DMA_RX_MIN_SIZE
+    &LPUART12_Handle, RTE_USART12_DMA_TX_MIN_SIZE, RTE_USART12_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART12_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -5616,6 +6105,19 @@ static cmsis_lpuart_edma_resource_t LPUART13_EdmaResource = {
 static lpuart_edma_handle_t LPUART13_EdmaHandle;
 static edma_handle_t LPUART13_EdmaRxHandle;
 static edma_handle_t LPUART13_EdmaTxHandle;
+#if !defined(RTE_USART13_DMA_TX_MIN_SIZE)
+#define RTE_USART13_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART13_DMA_RX_MIN_SIZE)
+#define RTE_USART13_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART13_DMA_TX_MIN_SIZE || RTE_USART13_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART13_Handle;
+#endif
+#if defined(RTE_USART13_DMA_TX_QUEUE_LEN) && RTE_USART13_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART13_EdmaTxTcds[RTE_USART13_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart13_edma_driver_state")
@@ -5624,6 +6126,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART13_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART13_EdmaDriverState = {
 #endif
     &LPUART13_Resource, &LPUART13_EdmaResource, &LPUART13_EdmaHandle, &LPUART13_EdmaRxHandle, &LPUART13_EdmaTxHandle,
+#if defined(RTE_USART13_DMA_TX_QUEUE_LEN) && RTE_USART13_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART13_EdmaTxTcds, RTE_USART13_DMA_TX_QUEUE_LEN,
+#elif RTE_USART13_DMA_TX_MIN_SIZE || RTE_USART13_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART13_DMA_TX_MIN_SIZE || RTE_USART13_DMA_RX_MIN_SIZE
+    &LPUART13_Handle, RTE_USART13_DMA_TX_MIN_SIZE, RTE_USART13_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART13_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -5933,6 +6443,19 @@ static cmsis_lpuart_edma_resource_t LPUART14_EdmaResource = {
 static lpuart_edma_handle_t LPUART14_EdmaHandle;
 static edma_handle_t LPUART14_EdmaRxHandle;
 static edma_handle_t LPUART14_EdmaTxHandle;
+#if !defined(RTE_USART14_DMA_TX_MIN_SIZE)
+#define RTE_USART14_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART14_DMA_RX_MIN_SIZE)
+#define RTE_USART14_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART14_DMA_TX_MIN_SIZE || RTE_USART14_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART14_Handle;
+#endif
+#if defined(RTE_USART14_DMA_TX_QUEUE_LEN) && RTE_USART14_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART14_EdmaTxTcds[RTE_USART14_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart14_edma_driver_state")
@@ -5941,6 +6464,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART14_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART14_EdmaDriverState = {
 #endif
     &LPUART14_Resource, &LPUART14_EdmaResource, &LPUART14_EdmaHandle, &LPUART14_EdmaRxHandle, &LPUART14_EdmaTxHandle,
+#if defined(RTE_USART14_DMA_TX_QUEUE_LEN) && RTE_USART14_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART14_EdmaTxTcds, RTE_USART14_DMA_TX_QUEUE_LEN,
+#elif RTE_USART14_DMA_TX_MIN_SIZE || RTE_USART14_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART14_DMA_TX_MIN_SIZE || RTE_USART14_DMA_RX_MIN_SIZE
+    &LPUART14_Handle, RTE_USART14_DMA_TX_MIN_SIZE, RTE_USART14_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART14_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -6250,6 +6781,19 @@ static cmsis_lpuart_edma_resource_t LPUART15_EdmaResource = {
 static lpuart_edma_handle_t LPUART15_EdmaHandle;
 static edma_handle_t LPUART15_EdmaRxHandle;
 static edma_handle_t LPUART15_EdmaTxHandle;
+#if !defined(RTE_USART15_DMA_TX_MIN_SIZE)
+#define RTE_USART15_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART15_DMA_RX_MIN_SIZE)
+#define RTE_USART15_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART15_DMA_TX_MIN_SIZE || RTE_USART15_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART15_Handle;
+#endif
+#if defined(RTE_USART15_DMA_TX_QUEUE_LEN) && RTE_USART15_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART15_EdmaTxTcds[RTE_USART15_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart15_edma_driver_state")
@@ -6258,6 +6802,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART15_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART15_EdmaDriverState = {
 #endif
     &LPUART15_Resource, &LPUART15_EdmaResource, &LPUART15_EdmaHandle, &LPUART15_EdmaRxHandle, &LPUART15_EdmaTxHandle,
+#if defined(RTE_USART15_DMA_TX_QUEUE_LEN) && RTE_USART15_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART15_EdmaTxTcds, RTE_USART15_DMA_TX_QUEUE_LEN,
+#elif RTE_USART15_DMA_TX_MIN_SIZE || RTE_USART15_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART15_DMA_TX_MIN_SIZE || RTE_USART15_DMA_RX_MIN_SIZE
+    &LPUART15_Handle, RTE_USART15_DMA_TX_MIN_SIZE, RTE_USART15_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART15_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -6567,6 +7119,19 @@ static cmsis_lpuart_edma_resource_t LPUART16_EdmaResource = {
 static lpuart_edma_handle_t LPUART16_EdmaHandle;
 static edma_handle_t LPUART16_EdmaRxHandle;
 static edma_handle_t LPUART16_EdmaTxHandle;
+#if !defined(RTE_USART16_DMA_TX_MIN_SIZE)
+#define RTE_USART16_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART16_DMA_RX_MIN_SIZE)
+#define RTE_USART16_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART16_DMA_TX_MIN_SIZE || RTE_USART16_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART16_Handle;
+#endif
+#if defined(RTE_USART16_DMA_TX_QUEUE_LEN) && RTE_USART16_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART16_EdmaTxTcds[RTE_USART16_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart16_edma_driver_state")
@@ -6575,6 +7140,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART16_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART16_EdmaDriverState = {
 #endif
     &LPUART16_Resource, &LPUART16_EdmaResource, &LPUART16_EdmaHandle, &LPUART16_EdmaRxHandle, &LPUART16_EdmaTxHandle,
+#if defined(RTE_USART16_DMA_TX_QUEUE_LEN) && RTE_USART16_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART16_EdmaTxTcds, RTE_USART16_DMA_TX_QUEUE_LEN,
+#elif RTE_USART16_DMA_TX_MIN_SIZE || RTE_USART16_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART16_DMA_TX_MIN_SIZE || RTE_USART16_DMA_RX_MIN_SIZE
+    &LPUART16_Handle, RTE_USART16_DMA_TX_MIN_SIZE, RTE_USART16_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART16_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -6884,6 +7457,19 @@ static cmsis_lpuart_edma_resource_t LPUART17_EdmaResource = {
 static lpuart_edma_handle_t LPUART17_EdmaHandle;
 static edma_handle_t LPUART17_EdmaRxHandle;
 static edma_handle_t LPUART17_EdmaTxHandle;
+#if !defined(RTE_USART17_DMA_TX_MIN_SIZE)
+#define RTE_USART17_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART17_DMA_RX_MIN_SIZE)
+#define RTE_USART17_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART17_DMA_TX_MIN_SIZE || RTE_USART17_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART17_Handle;
+#endif
+#if defined(RTE_USART17_DMA_TX_QUEUE_LEN) && RTE_USART17_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART17_EdmaTxTcds[RTE_USART17_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart17_edma_driver_state")
@@ -6892,6 +7478,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART17_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART17_EdmaDriverState = {
 #endif
     &LPUART17_Resource, &LPUART17_EdmaResource, &LPUART17_EdmaHandle, &LPUART17_EdmaRxHandle, &LPUART17_EdmaTxHandle,
+#if defined(RTE_USART17_DMA_TX_QUEUE_LEN) && RTE_USART17_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART17_EdmaTxTcds, RTE_USART17_DMA_TX_QUEUE_LEN,
+#elif RTE_USART17_DMA_TX_MIN_SIZE || RTE_USART17_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART17_DMA_TX_MIN_SIZE || RTE_USART17_DMA_RX_MIN_SIZE
+    &LPUART17_Handle, RTE_USART17_DMA_TX_MIN_SIZE, RTE_USART17_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART17_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -7201,6 +7795,19 @@ static cmsis_lpuart_edma_resource_t LPUART18_EdmaResource = {
 static lpuart_edma_handle_t LPUART18_EdmaHandle;
 static edma_handle_t LPUART18_EdmaRxHandle;
 static edma_handle_t LPUART18_EdmaTxHandle;
+#if !defined(RTE_USART18_DMA_TX_MIN_SIZE)
+#define RTE_USART18_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART18_DMA_RX_MIN_SIZE)
+#define RTE_USART18_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART18_DMA_TX_MIN_SIZE || RTE_USART18_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART18_Handle;
+#endif
+#if defined(RTE_USART18_DMA_TX_QUEUE_LEN) && RTE_USART18_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART18_EdmaTxTcds[RTE_USART18_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart18_edma_driver_state")
@@ -7209,6 +7816,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART18_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART18_EdmaDriverState = {
 #endif
     &LPUART18_Resource, &LPUART18_EdmaResource, &LPUART18_EdmaHandle, &LPUART18_EdmaRxHandle, &LPUART18_EdmaTxHandle,
+#if defined(RTE_USART18_DMA_TX_QUEUE_LEN) && RTE_USART18_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART18_EdmaTxTcds, RTE_USART18_DMA_TX_QUEUE_LEN,
+#elif RTE_USART18_DMA_TX_MIN_SIZE || RTE_USART18_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART18_DMA_TX_MIN_SIZE || RTE_USART18_DMA_RX_MIN_SIZE
+    &LPUART18_Handle, RTE_USART18_DMA_TX_MIN_SIZE, RTE_USART18_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART18_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -7518,6 +8133,19 @@ static cmsis_lpuart_edma_resource_t LPUART19_EdmaResource = {
 static lpuart_edma_handle_t LPUART19_EdmaHandle;
 static edma_handle_t LPUART19_EdmaRxHandle;
 static edma_handle_t LPUART19_EdmaTxHandle;
+#if !defined(RTE_USART19_DMA_TX_MIN_SIZE)
+#define RTE_USART19_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART19_DMA_RX_MIN_SIZE)
+#define RTE_USART19_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART19_DMA_TX_MIN_SIZE || RTE_USART19_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART19_Handle;
+#endif
+#if defined(RTE_USART19_DMA_TX_QUEUE_LEN) && RTE_USART19_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART19_EdmaTxTcds[RTE_USART19_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart19_edma_driver_state")
@@ -7526,6 +8154,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART19_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART19_EdmaDriverState = {
 #endif
     &LPUART19_Resource, &LPUART19_EdmaResource, &LPUART19_EdmaHandle, &LPUART19_EdmaRxHandle, &LPUART19_EdmaTxHandle,
+#if defined(RTE_USART19_DMA_TX_QUEUE_LEN) && RTE_USART19_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART19_EdmaTxTcds, RTE_USART19_DMA_TX_QUEUE_LEN,
+#elif RTE_USART19_DMA_TX_MIN_SIZE || RTE_USART19_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART19_DMA_TX_MIN_SIZE || RTE_USART19_DMA_RX_MIN_SIZE
+    &LPUART19_Handle, RTE_USART19_DMA_TX_MIN_SIZE, RTE_USART19_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART19_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
@@ -7835,6 +8471,19 @@ static cmsis_lpuart_edma_resource_t LPUART20_EdmaResource = {
 static lpuart_edma_handle_t LPUART20_EdmaHandle;
 static edma_handle_t LPUART20_EdmaRxHandle;
 static edma_handle_t LPUART20_EdmaTxHandle;
+#if !defined(RTE_USART20_DMA_TX_MIN_SIZE)
+#define RTE_USART20_DMA_TX_MIN_SIZE 0
+#endif
+#if !defined(RTE_USART20_DMA_RX_MIN_SIZE)
+#define RTE_USART20_DMA_RX_MIN_SIZE 0
+#endif
+#if RTE_USART20_DMA_TX_MIN_SIZE || RTE_USART20_DMA_RX_MIN_SIZE
+static lpuart_handle_t LPUART20_Handle;
+#endif
+#if defined(RTE_USART20_DMA_TX_QUEUE_LEN) && RTE_USART20_DMA_TX_QUEUE_LEN
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t LPUART20_EdmaTxTcds[RTE_USART20_DMA_TX_QUEUE_LEN],
+                              sizeof(edma_tcd_t));
+#endif
 
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION)
 ARMCC_SECTION("lpuart20_edma_driver_state")
@@ -7843,6 +8492,14 @@ static cmsis_lpuart_edma_driver_state_t LPUART20_EdmaDriverState = {
 static cmsis_lpuart_edma_driver_state_t LPUART20_EdmaDriverState = {
 #endif
     &LPUART20_Resource, &LPUART20_EdmaResource, &LPUART20_EdmaHandle, &LPUART20_EdmaRxHandle, &LPUART20_EdmaTxHandle,
+#if defined(RTE_USART20_DMA_TX_QUEUE_LEN) && RTE_USART20_DMA_TX_QUEUE_LEN
+    NULL, 0U, LPUART20_EdmaTxTcds, RTE_USART20_DMA_TX_QUEUE_LEN,
+#elif RTE_USART20_DMA_TX_MIN_SIZE || RTE_USART20_DMA_RX_MIN_SIZE
+    NULL, 0U, NULL, 0U,
+#endif
+#if RTE_USART20_DMA_TX_MIN_SIZE || RTE_USART20_DMA_RX_MIN_SIZE
+    &LPUART20_Handle, RTE_USART20_DMA_TX_MIN_SIZE, RTE_USART20_DMA_RX_MIN_SIZE,
+#endif
 };
 
 static int32_t LPUART20_EdmaInitialize(ARM_USART_SignalEvent_t cb_event)
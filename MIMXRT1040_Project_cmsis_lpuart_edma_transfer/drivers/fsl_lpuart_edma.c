@@ -15,7 +15,8 @@
  * the callback is only called when EDMA transfer done.
  *
  * $Justification fsl_lpuart_edma_c_ref_2$
- * This function only handles the kLPUART_TransmissionCompleteFlag event.
+ * This function only handles the kLPUART_TransmissionCompleteFlag event, and the kLPUART_IdleLineFlag event
+ * while the ring buffer runs.
  *
  */
 /*******************************************************************************
@@ -52,6 +53,12 @@ static LPUART_Type *const s_lpuartBases[] = LPUART_BASE_PTRS;
 /*<! Private handle only used for internally. */
 static lpuart_edma_private_handle_t s_lpuartEdmaPrivateHandle[ARRAY_SIZE(s_lpuartBases)];
 
+/*<! TCD templates of the byte-wide transfers, only the addresses and the length are patched per transfer. */
+static const edma_tcd_t s_lpuartEdmaTxTcdTemplate =
+    EDMA_TCD_TEMPLATE_INIT(kEDMA_TransferSize1Bytes, sizeof(uint8_t), kEDMA_TransferSize1Bytes, 0, sizeof(uint8_t));
+static const edma_tcd_t s_lpuartEdmaRxTcdTemplate =
+    EDMA_TCD_TEMPLATE_INIT(kEDMA_TransferSize1Bytes, 0, kEDMA_TransferSize1Bytes, sizeof(uint8_t), sizeof(uint8_t));
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -78,9 +85,102 @@ static void LPUART_SendEDMACallback(edma_handle_t *handle, void *param, bool tra
  */
 static void LPUART_ReceiveEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
 
+/*!
+ * @brief LPUART EDMA ring buffer wrap callback function.
+ *
+ * This function is called each time the continuous receive wraps around the ring. It counts the lap and sends
+ * @ref kStatus_LPUART_RxRingBufferOverrun to LPUART callback when unread data was overwritten.
+ *
+ * @param handle The EDMA handle.
+ * @param param Callback function parameter.
+ */
+static void LPUART_RingBufferEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*!
+ * @brief LPUART EDMA send queue callback function.
+ *
+ * This function is called when queued TCDs complete. It sends @ref kStatus_LPUART_TxBufferSent to LPUART callback
+ * once per sent buffer, and when the queue runs dry, it stops the channel and enables the TX complete interrupt.
+ *
+ * @param handle The EDMA handle.
+ * @param param Callback function parameter.
+ */
+static void LPUART_SendQueueEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
+/*
+ * Gets the number of bytes written to the ring since the start, a lap count and the offset in the current lap.
+ */
+static uint32_t LPUART_GetRingBufferHeadEDMA(lpuart_edma_handle_t *handle)
+{
+    DMA_Type *dmaBase = handle->rxEdmaHandle->base;
+    uint32_t channel  = handle->rxEdmaHandle->channel;
+    uint32_t mask     = 1UL << channel;
+    uint32_t size     = (uint32_t)handle->rxRingBufferSize;
+    uint32_t laps;
+    uint32_t citer;
+    uint32_t head;
+    bool pending;
+
+    /*
+     * The lap count and CITER can not be read together. A completed lap is either counted by the wrap interrupt,
+     * or still pending and then CITER is already reloaded. DONE can not tell: the next byte clears it while the
+     * interrupt may still be pending. Read again when either changed meanwhile.
+     */
+    do
+    {
+        laps    = handle->rxRingBufferLaps;
+        pending = (0U != (dmaBase->INT & mask));
+        citer   = ((uint32_t)dmaBase->TCD[channel].CITER_ELINKNO & DMA_CITER_ELINKNO_CITER_MASK) >>
+                DMA_CITER_ELINKNO_CITER_SHIFT;
+    } while ((laps != handle->rxRingBufferLaps) || (pending != (0U != (dmaBase->INT & mask))));
+
+    if (pending)
+    {
+        laps++;
+    }
+    head = (laps * size) + (size - citer);
+
+    /* The tail never moves backwards: a head behind it has nothing to read. */
+    if ((int32_t)(head - handle->rxRingBufferTail) < 0)
+    {
+        head = handle->rxRingBufferTail;
+    }
+
+    return head;
+}
+
+/*
+ * Appends a buffer to the send queue.
+ */
+static status_t LPUART_EnqueueSendEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpuart_transfer_t *xfer)
+{
+    status_t status = kStatus_LPUART_TxBusy;
+    uint32_t primask;
+
+    /* The callback resets the eDMA queue when it runs dry, it must not come in between. */
+    primask = DisableGlobalIRQ();
+    if ((handle->txQueueCount < handle->txQueueSize) &&
+        (kStatus_Success == EDMA_SubmitTcdTemplate(handle->txEdmaHandle, &s_lpuartEdmaTxTcdTemplate,
+                                                   (uint32_t)xfer->data, LPUART_GetDataRegisterAddress(base),
+                                                   xfer->dataSize)))
+    {
+        handle->txQueueCount++;
+        handle->txState = (uint8_t)kLPUART_TxBusy;
+        handle->nbytes  = (uint8_t)sizeof(uint8_t);
+
+        /* Linked after the running TCD, or installed in the registers when the channel is stopped. */
+        EDMA_StartTransfer(handle->txEdmaHandle);
+        LPUART_EnableTxDMA(base, true);
+
+        status = kStatus_Success;
+    }
+    EnableGlobalIRQ(primask);
+
+    return status;
+}
 
 static void LPUART_SendEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
 {
@@ -91,11 +191,12 @@ static void LPUART_SendEDMACallback(edma_handle_t *handle, void *param, bool tra
     /* Avoid the warning for unused variables. */
     handle = handle;
     tcds   = tcds;
+    /* A vector sent with LPUART_SendEDMAIov interrupts once per TCD, it is complete when no TCD is left. */
     /*
      * $Branch Coverage Justification$
      * $ref fsl_lpuart_edma_c_ref_1$
      */
-    if (transferDone)
+    if (transferDone && (0 == handle->tcdUsed))
     {
         /* Disable LPUART TX EDMA. */
         LPUART_EnableTxDMA(lpuartPrivateHandle->base, false);
@@ -134,6 +235,66 @@ static void LPUART_ReceiveEDMACallback(edma_handle_t *handle, void *param, bool
     }
 }
 
+static void LPUART_RingBufferEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    assert(NULL != param);
+
+    lpuart_edma_private_handle_t *lpuartPrivateHandle = (lpuart_edma_private_handle_t *)param;
+    lpuart_edma_handle_t *lpuartHandle                = lpuartPrivateHandle->handle;
+
+    /* Avoid warning for unused parameters. */
+    handle       = handle;
+    transferDone = transferDone;
+    tcds         = tcds;
+
+    /*
+     * The channel only interrupts at the end of a lap and goes on from the start of the ring. transferDone is not
+     * used: when the interrupt comes more than one byte late, the next byte has already cleared DONE.
+     */
+    lpuartHandle->rxRingBufferLaps++;
+
+    if (((LPUART_GetRingBufferHeadEDMA(lpuartHandle) - lpuartHandle->rxRingBufferTail) >
+         lpuartHandle->rxRingBufferSize) &&
+        (NULL != lpuartHandle->callback))
+    {
+        lpuartHandle->callback(lpuartPrivateHandle->base, lpuartHandle, kStatus_LPUART_RxRingBufferOverrun,
+                               lpuartHandle->userData);
+    }
+}
+
+static void LPUART_SendQueueEDMACallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    assert(NULL != param);
+
+    lpuart_edma_private_handle_t *lpuartPrivateHandle = (lpuart_edma_private_handle_t *)param;
+    lpuart_edma_handle_t *lpuartHandle                = lpuartPrivateHandle->handle;
+    uint32_t sent;
+
+    /* Each queued buffer owns one TCD and every TCD interrupts, tcds is the number of buffers sent. */
+    sent = tcds;
+    lpuartHandle->txQueueCount -= (uint8_t)sent;
+
+    /* DONE is also set after a reload, the queue ran dry only when no buffer is left. */
+    if (transferDone && (0U == lpuartHandle->txQueueCount))
+    {
+        /* The next buffer restarts the queue from the first TCD. */
+        LPUART_EnableTxDMA(lpuartPrivateHandle->base, false);
+        EDMA_AbortTransfer(handle);
+
+        /* Enable tx complete interrupt */
+        LPUART_EnableInterrupts(lpuartPrivateHandle->base, (uint32_t)kLPUART_TransmissionCompleteInterruptEnable);
+    }
+
+    for (; sent > 0U; sent--)
+    {
+        if (NULL != lpuartHandle->callback)
+        {
+            lpuartHandle->callback(lpuartPrivateHandle->base, lpuartHandle, kStatus_LPUART_TxBufferSent,
+                                   lpuartHandle->userData);
+        }
+    }
+}
+
 /*!
  * brief Initializes the LPUART handle which is used in transactional functions.
  *
@@ -233,9 +394,13 @@ status_t LPUART_SendEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpuart
     assert(NULL != xfer->data);
     assert(0U != xfer->dataSize);
 
-    edma_transfer_config_t xferConfig;
     status_t status;
 
+    if (0U != handle->txQueueSize)
+    {
+        return LPUART_EnqueueSendEDMA(base, handle, xfer);
+    }
+
     /* If previous TX not finished. */
     if ((uint8_t)kLPUART_TxBusy == handle->txState)
     {
@@ -246,18 +411,73 @@ status_t LPUART_SendEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpuart
         handle->txState       = (uint8_t)kLPUART_TxBusy;
         handle->txDataSizeAll = xfer->dataSize;
 
-        /* Prepare transfer. */
-        EDMA_PrepareTransfer(&xferConfig, xfer->data, sizeof(uint8_t),
-                             (void *)(uint32_t *)LPUART_GetDataRegisterAddress(base), sizeof(uint8_t), sizeof(uint8_t),
-                             xfer->dataSize, kEDMA_MemoryToPeripheral);
+        /* Store the initially configured eDMA minor byte transfer count into the LPUART handle */
+        handle->nbytes = (uint8_t)sizeof(uint8_t);
+
+        /* Submit transfer, only the addresses and the length of the TX template change. */
+        if (kStatus_Success != EDMA_SubmitTcdTemplate(handle->txEdmaHandle, &s_lpuartEdmaTxTcdTemplate,
+                                                      (uint32_t)xfer->data, LPUART_GetDataRegisterAddress(base),
+                                                      xfer->dataSize))
+        {
+            return kStatus_Fail;
+        }
+        EDMA_StartTransfer(handle->txEdmaHandle);
+
+        /* Enable LPUART TX EDMA. */
+        LPUART_EnableTxDMA(base, true);
+
+        status = kStatus_Success;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Sends a frame gathered from several buffers using eDMA.
+ *
+ * param base LPUART peripheral base address.
+ * param handle LPUART handle pointer.
+ * param iov Array of iovCount segments, in transmit order.
+ * param iovCount Number of entries in iov.
+ * retval kStatus_Success if succeed, others failed.
+ * retval kStatus_LPUART_TxBusy Previous transfer on going.
+ */
+status_t LPUART_SendEDMAIov(LPUART_Type *base, lpuart_edma_handle_t *handle, const edma_iovec_t *iov, uint32_t iovCount)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txEdmaHandle);
+    assert(NULL != handle->txEdmaHandle->tcdPool);
+    assert(0U == handle->txQueueSize);
+    assert(NULL != iov);
+    assert(0U != iovCount);
+
+    status_t status;
+    size_t dataSize = 0U;
+    uint32_t i;
+
+    /* If previous TX not finished. */
+    if ((uint8_t)kLPUART_TxBusy == handle->txState)
+    {
+        status = kStatus_LPUART_TxBusy;
+    }
+    else
+    {
+        for (i = 0U; i < iovCount; i++)
+        {
+            dataSize += iov[i].length;
+        }
+
+        handle->txState       = (uint8_t)kLPUART_TxBusy;
+        handle->txDataSizeAll = dataSize;
 
         /* Store the initially configured eDMA minor byte transfer count into the LPUART handle */
         handle->nbytes = (uint8_t)sizeof(uint8_t);
 
-        /* Submit transfer. */
-        if (kStatus_Success !=
-            EDMA_SubmitTransfer(handle->txEdmaHandle, (const edma_transfer_config_t *)(uint32_t)&xferConfig))
+        /* Submit one TCD per discontiguous segment, the send completes once all of them are done. */
+        if (kStatus_Success != EDMA_SubmitIov(handle->txEdmaHandle, LPUART_GetDataRegisterAddress(base),
+                                              sizeof(uint8_t), iov, iovCount, kEDMA_MemoryToPeripheral))
         {
+            handle->txState = (uint8_t)kLPUART_TxIdle;
             return kStatus_Fail;
         }
         EDMA_StartTransfer(handle->txEdmaHandle);
@@ -292,7 +512,6 @@ status_t LPUART_ReceiveEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpu
     assert(NULL != xfer->data);
     assert(0U != xfer->dataSize);
 
-    edma_transfer_config_t xferConfig;
     status_t status;
 
     /* If previous RX not finished. */
@@ -305,16 +524,13 @@ status_t LPUART_ReceiveEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpu
         handle->rxState       = (uint8_t)kLPUART_RxBusy;
         handle->rxDataSizeAll = xfer->dataSize;
 
-        /* Prepare transfer. */
-        EDMA_PrepareTransfer(&xferConfig, (void *)(uint32_t *)LPUART_GetDataRegisterAddress(base), sizeof(uint8_t),
-                             xfer->data, sizeof(uint8_t), sizeof(uint8_t), xfer->dataSize, kEDMA_PeripheralToMemory);
-
         /* Store the initially configured eDMA minor byte transfer count into the LPUART handle */
         handle->nbytes = (uint8_t)sizeof(uint8_t);
 
-        /* Submit transfer. */
-        if (kStatus_Success !=
-            EDMA_SubmitTransfer(handle->rxEdmaHandle, (const edma_transfer_config_t *)(uint32_t)&xferConfig))
+        /* Submit transfer, only the addresses and the length of the RX template change. */
+        if (kStatus_Success != EDMA_SubmitTcdTemplate(handle->rxEdmaHandle, &s_lpuartEdmaRxTcdTemplate,
+                                                      LPUART_GetDataRegisterAddress(base), (uint32_t)xfer->data,
+                                                      xfer->dataSize))
         {
             return kStatus_Fail;
         }
@@ -344,10 +560,15 @@ void LPUART_TransferAbortSendEDMA(LPUART_Type *base, lpuart_edma_handle_t *handl
 
     /* Disable LPUART TX EDMA. */
     LPUART_EnableTxDMA(base, false);
+    /* The TC interrupt is only handled during a send, it would not be disabled once the send is idle. */
+    LPUART_DisableInterrupts(base, (uint32_t)kLPUART_TransmissionCompleteInterruptEnable);
 
     /* Stop transfer. */
     EDMA_AbortTransfer(handle->txEdmaHandle);
 
+    /* The queued buffers are dropped. */
+    handle->txQueueCount = 0U;
+
     handle->txState = (uint8_t)kLPUART_TxIdle;
 }
 
@@ -364,6 +585,12 @@ void LPUART_TransferAbortReceiveEDMA(LPUART_Type *base, lpuart_edma_handle_t *ha
     assert(NULL != handle);
     assert(NULL != handle->rxEdmaHandle);
 
+    if (NULL != handle->rxRingBuffer)
+    {
+        LPUART_TransferStopRingBufferEDMA(base, handle);
+        return;
+    }
+
     /* Disable LPUART RX EDMA. */
     LPUART_EnableRxDMA(base, false);
 
@@ -373,6 +600,171 @@ void LPUART_TransferAbortReceiveEDMA(LPUART_Type *base, lpuart_edma_handle_t *ha
     handle->rxState = (uint8_t)kLPUART_RxIdle;
 }
 
+/*!
+ * brief Starts receiving continuously into a ring buffer using eDMA.
+ *
+ * The RX eDMA channel writes the ring over and over without being re-armed, so no byte is lost between two
+ * messages. The channel interrupts once per wrap only. The idle line interrupt is enabled, when the line stays
+ * idle after a frame, the callback is called with ref kStatus_LPUART_IdleLineDetected, then
+ * LPUART_TransferGetRxRingBufferLengthEDMA gives the received bytes and LPUART_TransferReadRingBufferEDMA
+ * copies them out. When the eDMA wraps over unread data, the callback is called with
+ * ref kStatus_LPUART_RxRingBufferOverrun.
+ *
+ * While the ring runs, LPUART_ReceiveEDMA returns ref kStatus_LPUART_RxBusy.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param ringBuffer Ring written by the eDMA, it must not be cached.
+ * param ringBufferSize Size of the ring, a power of 2, at most the eDMA major loop count.
+ * retval kStatus_Success The ring runs.
+ * retval kStatus_LPUART_RxBusy A receive is ongoing.
+ */
+status_t LPUART_TransferStartRingBufferEDMA(LPUART_Type *base,
+                                            lpuart_edma_handle_t *handle,
+                                            uint8_t *ringBuffer,
+                                            size_t ringBufferSize)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxEdmaHandle);
+    assert(NULL != ringBuffer);
+    assert((0U != ringBufferSize) && (0U == (ringBufferSize & (ringBufferSize - 1U))));
+    assert(ringBufferSize <= (DMA_CITER_ELINKNO_CITER_MASK >> DMA_CITER_ELINKNO_CITER_SHIFT));
+
+    edma_handle_t *edmaHandle = handle->rxEdmaHandle;
+    uint32_t instance         = LPUART_GetInstance(base);
+    edma_transfer_config_t xferConfig;
+
+    if ((uint8_t)kLPUART_RxBusy == handle->rxState)
+    {
+        return kStatus_LPUART_RxBusy;
+    }
+
+    handle->rxState          = (uint8_t)kLPUART_RxBusy;
+    handle->rxDataSizeAll    = ringBufferSize;
+    handle->nbytes           = (uint8_t)sizeof(uint8_t);
+    handle->rxRingBuffer     = ringBuffer;
+    handle->rxRingBufferSize = ringBufferSize;
+    handle->rxRingBufferTail = 0U;
+    handle->rxRingBufferLaps = 0U;
+
+    EDMA_PrepareTransfer(&xferConfig, (void *)(uint32_t *)LPUART_GetDataRegisterAddress(base), sizeof(uint8_t),
+                         ringBuffer, sizeof(uint8_t), sizeof(uint8_t), ringBufferSize, kEDMA_PeripheralToMemory);
+    EDMA_ResetChannel(edmaHandle->base, edmaHandle->channel);
+    EDMA_SetTransferConfig(edmaHandle->base, edmaHandle->channel, &xferConfig, NULL);
+    /* Back to the start of the ring after each major loop, with the request left enabled. */
+    EDMA_SetMajorOffsetConfig(edmaHandle->base, edmaHandle->channel, 0, -(int32_t)ringBufferSize);
+    EDMA_EnableAutoStopRequest(edmaHandle->base, edmaHandle->channel, false);
+    EDMA_EnableChannelInterrupts(edmaHandle->base, edmaHandle->channel, (uint32_t)kEDMA_MajorInterruptEnable);
+    EDMA_SetCallback(edmaHandle, LPUART_RingBufferEDMACallback, &s_lpuartEdmaPrivateHandle[instance]);
+    EDMA_EnableChannelRequest(edmaHandle->base, edmaHandle->channel);
+
+    /* The idle line ends a frame, the data stays in the ring until it is read. */
+    (void)LPUART_ClearStatusFlags(base, (uint32_t)kLPUART_IdleLineFlag);
+    LPUART_EnableInterrupts(base, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    LPUART_EnableRxDMA(base, true);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the continuous receive.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferStopRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->rxEdmaHandle);
+
+    uint32_t instance = LPUART_GetInstance(base);
+
+    LPUART_DisableInterrupts(base, (uint32_t)kLPUART_IdleLineInterruptEnable);
+    LPUART_EnableRxDMA(base, false);
+    EDMA_AbortTransfer(handle->rxEdmaHandle);
+
+    /* Back to the one-shot receive. */
+    EDMA_SetCallback(handle->rxEdmaHandle, LPUART_ReceiveEDMACallback, &s_lpuartEdmaPrivateHandle[instance]);
+    handle->rxRingBuffer = NULL;
+    handle->rxState      = (uint8_t)kLPUART_RxIdle;
+}
+
+/*!
+ * brief Gets the number of bytes received in the ring and not read yet.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * return Number of bytes, at most the size of the ring, 0 when the ring does not run.
+ */
+size_t LPUART_TransferGetRxRingBufferLengthEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    uint32_t length;
+
+    /* Avoid warning for unused parameters. */
+    base = base;
+
+    if (NULL == handle->rxRingBuffer)
+    {
+        return 0U;
+    }
+
+    length = LPUART_GetRingBufferHeadEDMA(handle) - handle->rxRingBufferTail;
+
+    return MIN((size_t)length, handle->rxRingBufferSize);
+}
+
+/*!
+ * brief Copies the received bytes out of the ring.
+ *
+ * The function copies what is available and returns right away, the eDMA keeps running. When the eDMA has
+ * overwritten unread data, the oldest bytes are dropped and the copy starts one ring behind the eDMA.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param data Receives the bytes, NULL to drop them, for data already used in place in the ring.
+ * param length Size of data.
+ * return Number of copied bytes.
+ */
+size_t LPUART_TransferReadRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, uint8_t *data, size_t length)
+{
+    assert(NULL != handle);
+
+    size_t size = handle->rxRingBufferSize;
+    uint32_t head;
+    uint32_t index;
+    size_t count;
+    size_t first;
+
+    /* Avoid warning for unused parameters. */
+    base = base;
+
+    if (NULL == handle->rxRingBuffer)
+    {
+        return 0U;
+    }
+
+    head = LPUART_GetRingBufferHeadEDMA(handle);
+    if ((head - handle->rxRingBufferTail) > size)
+    {
+        handle->rxRingBufferTail = head - (uint32_t)size;
+    }
+
+    /* Copied in one or two parts around the end of the ring. */
+    count = MIN(length, (size_t)(head - handle->rxRingBufferTail));
+    if (NULL != data)
+    {
+        index = handle->rxRingBufferTail & ((uint32_t)size - 1U);
+        first = MIN(count, size - index);
+        (void)memcpy(data, &handle->rxRingBuffer[index], first);
+        (void)memcpy(&data[first], handle->rxRingBuffer, count - first);
+    }
+    handle->rxRingBufferTail += (uint32_t)count;
+
+    return count;
+}
+
 /*!
  * brief Gets the number of received bytes.
  *
@@ -427,6 +819,16 @@ status_t LPUART_TransferGetSendCountEDMA(LPUART_Type *base, lpuart_edma_handle_t
         return kStatus_NoTransferInProgress;
     }
 
+    if (0U != handle->txQueueSize)
+    {
+        /* Bytes of the buffer in the channel registers. */
+        *count = (uint32_t)handle->nbytes *
+                 (((uint32_t)handle->txEdmaHandle->base->TCD[handle->txEdmaHandle->channel].BITER_ELINKNO &
+                   DMA_BITER_ELINKNO_BITER_MASK) -
+                  EDMA_GetRemainingMajorLoopCount(handle->txEdmaHandle->base, handle->txEdmaHandle->channel));
+        return kStatus_Success;
+    }
+
     *count = handle->txDataSizeAll -
              ((uint32_t)handle->nbytes *
               EDMA_GetRemainingMajorLoopCount(handle->txEdmaHandle->base, handle->txEdmaHandle->channel));
@@ -434,10 +836,88 @@ status_t LPUART_TransferGetSendCountEDMA(LPUART_Type *base, lpuart_edma_handle_t
     return kStatus_Success;
 }
 
+/*!
+ * brief Enables the send queue.
+ *
+ * In queue mode, LPUART_SendEDMA appends the buffer to the queue instead of returning
+ * ref kStatus_LPUART_TxBusy while a send is ongoing. Each queued buffer takes one TCD of the pool, the TCDs are
+ * linked while the eDMA runs, so the buffers go out back to back without a gap on the line. The callback is called
+ * with ref kStatus_LPUART_TxBufferSent once per buffer, in queue order, when its last byte is written to the
+ * LPUART, then with ref kStatus_LPUART_TxIdle once the queue is empty and the last byte is shifted out. A buffer
+ * can be queued from the callback.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * param tcdPool Memory pool of the TCDs, 32 bytes aligned, it must not be cached.
+ * param tcdCount Number of TCDs of the pool, the number of buffers that can be queued.
+ */
+void LPUART_TransferEnableSendQueueEDMA(LPUART_Type *base,
+                                        lpuart_edma_handle_t *handle,
+                                        edma_tcd_t *tcdPool,
+                                        uint32_t tcdCount)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txEdmaHandle);
+    assert(NULL != tcdPool);
+    assert((0U != tcdCount) && (tcdCount <= (uint32_t)INT8_MAX));
+    assert((uint8_t)kLPUART_TxIdle == handle->txState);
+
+    uint32_t instance = LPUART_GetInstance(base);
+
+    EDMA_AbortTransfer(handle->txEdmaHandle);
+    EDMA_InstallTCDMemory(handle->txEdmaHandle, tcdPool, tcdCount);
+    EDMA_SetCallback(handle->txEdmaHandle, LPUART_SendQueueEDMACallback, &s_lpuartEdmaPrivateHandle[instance]);
+
+    handle->txQueueSize  = (uint8_t)tcdCount;
+    handle->txQueueCount = 0U;
+}
+
+/*!
+ * brief Disables the send queue.
+ *
+ * The ongoing send is aborted, the queued buffers are dropped without callback.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferDisableSendQueueEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+    assert(NULL != handle->txEdmaHandle);
+
+    uint32_t instance = LPUART_GetInstance(base);
+
+    LPUART_DisableInterrupts(base, (uint32_t)kLPUART_TransmissionCompleteInterruptEnable);
+    LPUART_TransferAbortSendEDMA(base, handle);
+
+    /* Back to the one-shot send. */
+    EDMA_InstallTCDMemory(handle->txEdmaHandle, NULL, 0U);
+    EDMA_SetCallback(handle->txEdmaHandle, LPUART_SendEDMACallback, &s_lpuartEdmaPrivateHandle[instance]);
+    handle->txQueueSize = 0U;
+}
+
+/*!
+ * brief Gets the number of queued buffers not sent yet.
+ *
+ * param base LPUART peripheral base address.
+ * param handle Pointer to lpuart_edma_handle_t structure.
+ * return Number of buffers, 0 when the queue is disabled.
+ */
+uint32_t LPUART_TransferGetSendQueueLengthEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle)
+{
+    assert(NULL != handle);
+
+    /* Avoid warning for unused parameters. */
+    base = base;
+
+    return handle->txQueueCount;
+}
+
 /*!
  * brief LPUART eDMA IRQ handle function.
  *
- * This function handles the LPUART tx complete IRQ request and invoke user callback.
+ * This function handles the LPUART tx complete IRQ request and, while the ring runs, the idle line IRQ request,
+ * and invoke user callback.
  * It is not set to static so that it can be used in user application.
  * note This function is used as default IRQ handler by double weak mechanism.
  * If user's specific IRQ handler is implemented, make sure this function is invoked in the handler.
@@ -452,18 +932,37 @@ void LPUART_TransferEdmaHandleIRQ(LPUART_Type *base, void *lpuartEdmaHandle)
      * $Branch Coverage Justification$
      * $ref fsl_lpuart_edma_c_ref_2$
      */
-    if (((uint32_t)kLPUART_TransmissionCompleteFlag & LPUART_GetStatusFlags(base)) != 0U)
-    {
-        lpuart_edma_handle_t *handle = (lpuart_edma_handle_t *)lpuartEdmaHandle;
+    lpuart_edma_handle_t *handle = (lpuart_edma_handle_t *)lpuartEdmaHandle;
+    uint32_t status              = LPUART_GetStatusFlags(base);
 
+    /* The TC flag stays set while the transmitter is idle, it only counts when its interrupt is enabled, and only
+       for an eDMA send: an interrupt transfer handle of the same LPUART also uses it. */
+    if (((uint8_t)kLPUART_TxBusy == handle->txState) && (((uint32_t)kLPUART_TransmissionCompleteFlag & status) != 0U) &&
+        (((uint32_t)kLPUART_TransmissionCompleteInterruptEnable & LPUART_GetEnabledInterrupts(base)) != 0U))
+    {
         /* Disable tx complete interrupt */
         LPUART_DisableInterrupts(base, (uint32_t)kLPUART_TransmissionCompleteInterruptEnable);
 
-        handle->txState = (uint8_t)kLPUART_TxIdle;
+        /* A buffer queued since the queue ran dry is being sent, the line goes idle after it. */
+        if (0U == handle->txQueueCount)
+        {
+            handle->txState = (uint8_t)kLPUART_TxIdle;
+
+            if (handle->callback != NULL)
+            {
+                handle->callback(base, handle, kStatus_LPUART_TxIdle, handle->userData);
+            }
+        }
+    }
+
+    /* End of a frame of the continuous receive. */
+    if ((NULL != handle->rxRingBuffer) && (((uint32_t)kLPUART_IdleLineFlag & status) != 0U))
+    {
+        (void)LPUART_ClearStatusFlags(base, (uint32_t)kLPUART_IdleLineFlag);
 
         if (handle->callback != NULL)
         {
-            handle->callback(base, handle, kStatus_LPUART_TxIdle, handle->userData);
+            handle->callback(base, handle, kStatus_LPUART_IdleLineDetected, handle->userData);
         }
     }
 }
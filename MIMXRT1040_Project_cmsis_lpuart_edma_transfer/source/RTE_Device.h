@@ -35,7 +35,7 @@ extern void LPUART2_InitPins();
 extern void LPUART2_DeinitPins();
 
 #define RTE_USART2        1       /* THE MASTER SWITCH - SET TO 1 */
-#define RTE_USART2_DMA_EN 0
+#define RTE_USART2_DMA_EN 1
 
 /* UART2 configuration. */
 #define RTE_USART2_PIN_INIT           LPUART2_InitPins
@@ -48,5 +48,12 @@ extern void LPUART2_DeinitPins();
 #define RTE_USART2_DMA_RX_PERI_SEL    (uint8_t) kDmaRequestMuxLPUART2Rx
 #define RTE_USART2_DMA_RX_DMAMUX_BASE DMAMUX
 #define RTE_USART2_DMA_RX_DMA_BASE    DMA0
+/* Number of Send calls queued in the eDMA at once, each takes one TCD, 0 for one Send at a time. */
+#define RTE_USART2_DMA_TX_QUEUE_LEN 4
+/* Sends and receives shorter than these go through the FIFO interrupt handler, which costs fewer register accesses
+ * than the eDMA setup and completion: sends below 8 bytes, receives below 2 bytes, which take one interrupt per
+ * character. 0 for eDMA transfers only. */
+#define RTE_USART2_DMA_TX_MIN_SIZE 8
+#define RTE_USART2_DMA_RX_MIN_SIZE 2
 
 #endif /* _RTE_DEVICE_H */
@@ -6,6 +6,15 @@
 #include "fsl_lpuart_cmsis.h"
 #include "fsl_edma.h"
 #include "fsl_dmamux.h"
+#include "uart_frame.h"
+
+/* --- Framing --- */
+/* 1: the peer sends COBS frames, decoded in place in the DMA ring.
+ * 0: raw bytes, echoed as they come (the "!PING_123\n" peer).
+ */
+#ifndef APP_FRAME_DECODER_ENABLE
+#define APP_FRAME_DECODER_ENABLE 0
+#endif
 
 /* --- Driver & DMA Hardware --- */
 #define USART_DRV Driver_USART2
@@ -16,15 +25,20 @@ extern void LPUART2_DriverIRQHandler(void);
 #define EXAMPLE_LPUART_DMA_BASE     DMA0
 
 /* --- Memory (NON-CACHEABLE IS MANDATORY FOR DMA) --- */
-#define MSG_LEN 10
+#define RING_LEN 256  // DMA ring, a power of 2, never re-armed
+#define MSG_LEN  64   // Longest frame we echo
+#define TX_SLOTS RTE_USART2_DMA_TX_QUEUE_LEN  // Echoes queued in the driver at once
 
 /* * We use AT_NONCACHEABLE_SECTION_ALIGN so the DMA hardware and the CPU
  * look at the same physical RAM. 32-byte alignment is required for eDMA.
  */
-AT_NONCACHEABLE_SECTION_ALIGN(uint8_t rxBuffer[MSG_LEN + 1], 32);
-AT_NONCACHEABLE_SECTION_ALIGN(uint8_t txBuffer[MSG_LEN + 1], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(uint8_t rxRing[RING_LEN], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(uint8_t txBuffer[TX_SLOTS][MSG_LEN], 32);
+uint8_t rxBuffer[MSG_LEN + 1];
 
-volatile bool rxDone = false;
+volatile bool rxFrame = false;
+volatile uint32_t txSent = 0;  // One SEND_COMPLETE per queued echo, in order
+uint32_t txQueued = 0;
 
 /* Frequency remains 80MHz */
 uint32_t LPUART2_GetFreq(void) {
@@ -54,11 +68,36 @@ void LPUART2_InitPins(void) {
 void LPUART2_DeinitPins(void) {}
 
 void USART_SignalEvent(uint32_t event) {
-    if (event & ARM_USART_EVENT_RECEIVE_COMPLETE) {
-        rxDone = true;
+    /* The line went idle after a frame, of any length */
+    if (event & ARM_USART_EVENT_RX_TIMEOUT) {
+        rxFrame = true;
+    }
+    /* One queued echo is out, its slot can be reused */
+    if (event & ARM_USART_EVENT_SEND_COMPLETE) {
+        txSent++;
     }
 }
 
+/**
+ * @brief Queues an echo, given in one or two parts, behind the ones still going out.
+ * The driver links it to the previous one in the DMA, so the line never pauses between them.
+ */
+static void EchoSend(const uint8_t *first, uint32_t firstLen, const uint8_t *second, uint32_t secondLen) {
+    uint8_t *slot = txBuffer[txQueued % TX_SLOTS];
+
+    /* Only wait when every slot is still queued */
+    while ((txQueued - txSent) >= TX_SLOTS) {
+    }
+    memcpy(slot, first, firstLen);
+    if (secondLen != 0) {
+        memcpy(&slot[firstLen], second, secondLen);
+    }
+    /* A short echo goes out through the FIFO interrupt, not the DMA queue, the next one waits for it */
+    while (USART_DRV.Send(slot, firstLen + secondLen) == ARM_DRIVER_ERROR_BUSY) {
+    }
+    txQueued++;
+}
+
 int main(void) {
     BOARD_ConfigMPU();
     BOARD_InitBootPins();
@@ -72,31 +111,62 @@ int main(void) {
     USART_DRV.PowerControl(ARM_POWER_FULL);
     USART_DRV.Control(ARM_USART_MODE_ASYNCHRONOUS, 115200);
 
-    PRINTF("RT1040 DMA Mode Active. CPU will sleep during transfer...\r\n");
+    /* * STEP 1: Start the continuous DMA Receive, ONCE.
+     * The DMA fills rxRing forever, wrapping at the end, so there is no gap
+     * between two messages where bytes could be lost.
+     */
+    USART_DRV.Control(ARM_USART_CONTROL_RX_CONTINUOUS, 1);
+    USART_DRV.Receive(rxRing, RING_LEN);
 
-    while (1) {
-        rxDone = false;
-        memset(rxBuffer, 0, sizeof(rxBuffer));
+#if APP_FRAME_DECODER_ENABLE
+    /* The decoder follows the DMA ring from its start, ringTail is the driver side of it */
+    uart_frame_decoder_t decoder;
+    uint32_t ringTail = 0;
+    UART_FrameDecoderInit(&decoder, rxRing, RING_LEN, kUART_FrameCobs, MSG_LEN, 0);
+#endif
+
+    PRINTF("RT1040 DMA Ring Mode Active. CPU will sleep between frames...\r\n");
 
-        /* * STEP 1: Start DMA Receive.
-         * This function tells the DMA: "Go grab 10 bytes from UART and put them in rxBuffer."
-         * The function returns IMMEDIATELY.
+    while (1) {
+        /* * STEP 2: CPU SLEEP until the line goes idle after a frame.
+         * A short or a long frame just ends earlier or later, the link never stalls.
          */
-        USART_DRV.Receive(rxBuffer, MSG_LEN);
+        while (!rxFrame) {
+            __WFI();
+        }
+        rxFrame = false;
 
-        /* * STEP 2: CPU SLEEP.
-         * Instead of checking a flag constantly (polling), we use __WFI().
-         * The CPU physically stops executing code here. It consumes almost no power.
-         * The DMA engine is the ONLY thing running, moving bytes in the background.
+#if APP_FRAME_DECODER_ENABLE
+        /* * STEP 3: Decode the frames right where the DMA wrote them.
+         * No copy: each frame is one or two spans of rxRing (two when it wraps).
          */
-        while (!rxDone) {
-            __WFI(); // CPU sleeps here until the DMA finishes and triggers an interrupt
+        uint32_t head = (ringTail + USART_DRV.GetRxCount()) & (RING_LEN - 1U);
+        uart_frame_t frame;
+        while (UART_FrameDecode(&decoder, head, &frame) == kStatus_Success) {
+            uint32_t count = frame.length[0] + frame.length[1];
+            PRINTF("COBS Frame! %u bytes, %u frames, %u dropped\r\n", (unsigned)count,
+                   (unsigned)UART_FrameDecoderGetFrames(&decoder), (unsigned)UART_FrameDecoderGetErrors(&decoder));
+
+            /* Echo the payload, the one copy is into a TX slot */
+            EchoSend(frame.data[0], frame.length[0], frame.data[1], frame.length[1]);
         }
 
-        /* STEP 3: Process the data now that DMA is done */
-        PRINTF("DMA Finished! Received: %s\r\n", rxBuffer);
+        /* Give the used ring space back to the driver, without copying it */
+        uint32_t used = (UART_FrameDecoderGetTail(&decoder) - ringTail) & (RING_LEN - 1U);
+        LPUART_ReadAvailable(&USART_DRV, NULL, used);
+        ringTail = (ringTail + used) & (RING_LEN - 1U);
+#else
+        /* * STEP 3: Take what arrived, the DMA keeps running meanwhile.
+         * A frame longer than MSG_LEN is read over several turns.
+         */
+        int32_t count;
+        while ((count = LPUART_ReadAvailable(&USART_DRV, rxBuffer, MSG_LEN)) > 0) {
+            rxBuffer[count] = 0;
+            PRINTF("DMA Frame! Received %d bytes: %s\r\n", (int)count, rxBuffer);
 
-        memcpy(txBuffer, rxBuffer, MSG_LEN);
-        USART_DRV.Send(txBuffer, MSG_LEN);
+            /* Queued behind the previous echoes, no wait for them */
+            EchoSend(rxBuffer, count, NULL, 0);
+        }
+#endif
     }
 }
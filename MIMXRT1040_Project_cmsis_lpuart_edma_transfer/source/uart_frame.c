@@ -0,0 +1,236 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "uart_frame.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* COBS frame delimiter, and the code of a block of 254 bytes not followed by a zero. */
+#define UART_FRAME_COBS_DELIMITER 0x00U
+#define UART_FRAME_COBS_MAX_CODE  0xFFU
+
+/* SLIP special bytes, RFC 1055. */
+#define UART_FRAME_SLIP_END     0xC0U
+#define UART_FRAME_SLIP_ESC     0xDBU
+#define UART_FRAME_SLIP_ESC_END 0xDCU
+#define UART_FRAME_SLIP_ESC_ESC 0xDDU
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static inline size_t UART_FrameNext(const uart_frame_decoder_t *decoder, size_t index)
+{
+    index++;
+    return (index == decoder->size) ? 0U : index;
+}
+
+/* Bytes of the ring held by the current frame, from its start to the next byte to decode. */
+static inline size_t UART_FrameUsed(const uart_frame_decoder_t *decoder)
+{
+    return (decoder->read >= decoder->start) ? (decoder->read - decoder->start) :
+                                               (decoder->read + decoder->size - decoder->start);
+}
+
+/* Drops the current frame, the next one starts after the next delimiter. */
+static void UART_FrameError(uart_frame_decoder_t *decoder)
+{
+    decoder->discard = true;
+    decoder->errors++;
+}
+
+/* Starts a frame after the delimiter at read. */
+static void UART_FrameRestart(uart_frame_decoder_t *decoder)
+{
+    decoder->start       = UART_FrameNext(decoder, decoder->read);
+    decoder->write       = decoder->start;
+    decoder->length      = 0U;
+    decoder->block       = 0U;
+    decoder->pendingZero = false;
+    decoder->escape      = false;
+    decoder->discard     = false;
+}
+
+static void UART_FramePut(uart_frame_decoder_t *decoder, uint8_t data)
+{
+    if (decoder->length == decoder->maxLength)
+    {
+        UART_FrameError(decoder);
+        return;
+    }
+
+    decoder->ring[decoder->write] = data;
+    decoder->write                = UART_FrameNext(decoder, decoder->write);
+    decoder->length++;
+}
+
+/* Returns true when the byte ends a frame, even an empty or a dropped one. */
+static bool UART_FrameDecodeCobs(uart_frame_decoder_t *decoder, uint8_t data)
+{
+    if (data == UART_FRAME_COBS_DELIMITER)
+    {
+        /* A block cut by the delimiter is a lost byte. */
+        if ((!decoder->discard) && (decoder->block != 0U))
+        {
+            UART_FrameError(decoder);
+        }
+        return true;
+    }
+
+    if (decoder->discard)
+    {
+        return false;
+    }
+
+    if (decoder->block == 0U)
+    {
+        /* Code byte, the zero it stands for is only inserted if another block follows. */
+        if (decoder->pendingZero)
+        {
+            UART_FramePut(decoder, 0U);
+        }
+        decoder->block       = data - 1U;
+        decoder->pendingZero = (data != UART_FRAME_COBS_MAX_CODE);
+    }
+    else
+    {
+        UART_FramePut(decoder, data);
+        decoder->block--;
+    }
+
+    return false;
+}
+
+/* Returns true when the byte ends a frame, even an empty or a dropped one. */
+static bool UART_FrameDecodeSlip(uart_frame_decoder_t *decoder, uint8_t data)
+{
+    if (data == UART_FRAME_SLIP_END)
+    {
+        if ((!decoder->discard) && decoder->escape)
+        {
+            UART_FrameError(decoder);
+        }
+        return true;
+    }
+
+    if (decoder->discard)
+    {
+        return false;
+    }
+
+    if (decoder->escape)
+    {
+        decoder->escape = false;
+        if (data == UART_FRAME_SLIP_ESC_END)
+        {
+            UART_FramePut(decoder, UART_FRAME_SLIP_END);
+        }
+        else if (data == UART_FRAME_SLIP_ESC_ESC)
+        {
+            UART_FramePut(decoder, UART_FRAME_SLIP_ESC);
+        }
+        else
+        {
+            UART_FrameError(decoder);
+        }
+    }
+    else if (data == UART_FRAME_SLIP_ESC)
+    {
+        decoder->escape = true;
+    }
+    else
+    {
+        UART_FramePut(decoder, data);
+    }
+
+    return false;
+}
+
+void UART_FrameDecoderInit(uart_frame_decoder_t *decoder,
+                           uint8_t *ring,
+                           size_t size,
+                           uart_frame_format_t format,
+                           size_t maxLength,
+                           size_t tail)
+{
+    assert(decoder != NULL);
+    assert(ring != NULL);
+    assert(size != 0U);
+    assert(tail < size);
+    assert((maxLength != 0U) && (maxLength <= size));
+
+    (void)memset(decoder, 0, sizeof(*decoder));
+    decoder->ring      = ring;
+    decoder->size      = size;
+    decoder->format    = format;
+    decoder->maxLength = maxLength;
+    decoder->read      = tail;
+    decoder->start     = tail;
+    decoder->write     = tail;
+}
+
+status_t UART_FrameDecode(uart_frame_decoder_t *decoder, size_t head, uart_frame_t *frame)
+{
+    assert(decoder != NULL);
+    assert(head < decoder->size);
+    assert(frame != NULL);
+
+    bool end;
+    bool valid;
+    size_t first;
+
+    while (decoder->read != head)
+    {
+        if (decoder->format == kUART_FrameCobs)
+        {
+            end = UART_FrameDecodeCobs(decoder, decoder->ring[decoder->read]);
+        }
+        else
+        {
+            end = UART_FrameDecodeSlip(decoder, decoder->ring[decoder->read]);
+        }
+
+        if (!end)
+        {
+            decoder->read = UART_FrameNext(decoder, decoder->read);
+            if ((!decoder->discard) && (UART_FrameUsed(decoder) == (decoder->size - 1U)))
+            {
+                /* The frame fills the ring, a producer stopping at the tail would wait forever. */
+                UART_FrameError(decoder);
+            }
+            if (decoder->discard)
+            {
+                /* Nothing to keep, the ring space is released as it is decoded. */
+                decoder->start = decoder->read;
+                decoder->write = decoder->read;
+            }
+            continue;
+        }
+
+        valid = (!decoder->discard) && (decoder->length != 0U);
+        if (valid)
+        {
+            first            = MIN(decoder->length, decoder->size - decoder->start);
+            frame->data[0]   = &decoder->ring[decoder->start];
+            frame->length[0] = first;
+            frame->data[1]   = decoder->ring;
+            frame->length[1] = decoder->length - first;
+            decoder->frames++;
+        }
+
+        UART_FrameRestart(decoder);
+        decoder->read = decoder->start;
+
+        if (valid)
+        {
+            return kStatus_Success;
+        }
+    }
+
+    return kStatus_UART_FrameNotReady;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _UART_FRAME_H_
+#define _UART_FRAME_H_
+
+#include "fsl_common.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief UART frame status codes. */
+enum
+{
+    kStatus_UART_FrameNotReady = MAKE_STATUS(kStatusGroup_ApplicationRangeStart, 0), /*!< The received bytes do not
+                                                                                          end a frame yet. */
+};
+
+/*! @brief Frame delimiting. */
+typedef enum _uart_frame_format
+{
+    kUART_FrameCobs = 0U, /*!< Consistent Overhead Byte Stuffing, each frame ends with a 0x00 byte. */
+    kUART_FrameSlip,      /*!< SLIP, RFC 1055, each frame ends with a 0xC0 byte. */
+} uart_frame_format_t;
+
+/*! @brief Decoded frame, in place in the ring, the second span is used when the frame wraps. */
+typedef struct _uart_frame
+{
+    uint8_t *data[2]; /*!< Start of each span. */
+    size_t length[2]; /*!< Bytes of each span, length[1] is 0 when the frame does not wrap. */
+} uart_frame_t;
+
+/*! @brief UART frame decoder, users shall not touch the values inside. */
+typedef struct _uart_frame_decoder
+{
+    uint8_t *ring;              /*!< Receive ring the frames are decoded in. */
+    size_t size;                /*!< Bytes of the ring. */
+    uart_frame_format_t format; /*!< Frame delimiting. */
+    size_t maxLength;           /*!< Longest decoded frame. */
+    size_t read;                /*!< Index of the next byte to decode. */
+    size_t write;               /*!< Index of the next decoded byte, never ahead of read. */
+    size_t start;               /*!< Index of the first decoded byte of the current frame. */
+    size_t length;              /*!< Decoded bytes of the current frame. */
+    uint8_t block;              /*!< COBS bytes left in the current block. */
+    bool pendingZero;           /*!< COBS zero to insert before the next block. */
+    bool escape;                /*!< SLIP escape byte received. */
+    bool discard;               /*!< Corrupted frame, dropped up to the next delimiter. */
+    uint32_t frames;            /*!< Number of decoded frames. */
+    uint32_t errors;            /*!< Number of dropped frames. */
+} uart_frame_decoder_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initializes a frame decoder over a receive ring.
+ *
+ * The decoder works on any ring written by a producer up to a head index and released by a tail index, such as
+ * the rxRingBuffer of lpuart_handle_t or the eDMA ring of LPUART_TransferStartRingBufferEDMA. The frames are
+ * decoded in the ring itself: the decoded bytes are written back over the encoded ones, which they never pass
+ * since the encoding only adds bytes, and the frames are returned as spans of the ring, without a copy.
+ *
+ * @param decoder Pointer to the frame decoder.
+ * @param ring Receive ring.
+ * @param size Bytes of the ring.
+ * @param format Frame delimiting.
+ * @param maxLength Longest decoded frame, longer ones are dropped, at most size.
+ * @param tail Index of the first ring byte to decode, the ring tail.
+ */
+void UART_FrameDecoderInit(uart_frame_decoder_t *decoder,
+                           uint8_t *ring,
+                           size_t size,
+                           uart_frame_format_t format,
+                           size_t maxLength,
+                           size_t tail);
+
+/*!
+ * @brief Decodes the received bytes up to the end of the next frame.
+ *
+ * The function returns at each frame end, call it again until it returns kStatus_UART_FrameNotReady. A frame
+ * with an encoding error or longer than maxLength is dropped, the decoding resumes after the next delimiter, and
+ * empty frames are skipped. The frame stays valid until its ring space is released.
+ *
+ * @param decoder Pointer to the frame decoder.
+ * @param head Index of the ring byte the producer writes next, such as rxRingBufferHead of lpuart_handle_t.
+ * @param frame Returns the decoded frame.
+ * @retval kStatus_Success A frame is decoded.
+ * @retval kStatus_UART_FrameNotReady All the received bytes are decoded, no frame ends in them.
+ */
+status_t UART_FrameDecode(uart_frame_decoder_t *decoder, size_t head, uart_frame_t *frame);
+
+/*!
+ * @brief Gets the ring index up to which the ring space can be released.
+ *
+ * The ring is used up to the start of the frame being received. Once the decoded frames are handled, set the
+ * ring tail to this index, such as rxRingBufferTail of lpuart_handle_t, the producer then writes over them.
+ *
+ * @param decoder Pointer to the frame decoder.
+ * @return Ring index of the oldest byte still used.
+ */
+static inline size_t UART_FrameDecoderGetTail(uart_frame_decoder_t *decoder)
+{
+    return decoder->start;
+}
+
+/*!
+ * @brief Gets the number of decoded frames.
+ *
+ * @param decoder Pointer to the frame decoder.
+ * @return Number of frames since UART_FrameDecoderInit.
+ */
+static inline uint32_t UART_FrameDecoderGetFrames(uart_frame_decoder_t *decoder)
+{
+    return decoder->frames;
+}
+
+/*!
+ * @brief Gets the number of dropped frames.
+ *
+ * @param decoder Pointer to the frame decoder.
+ * @return Number of frames dropped for an encoding error or their length since UART_FrameDecoderInit.
+ */
+static inline uint32_t UART_FrameDecoderGetErrors(uart_frame_decoder_t *decoder)
+{
+    return decoder->errors;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _UART_FRAME_H_ */
@@ -23,9 +23,19 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief eDMA driver version */
-#define FSL_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 4, 5)) /*!< Version 2.4.5. */
+#define FSL_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 4, 6)) /*!< Version 2.4.6. */
 /*! @} */
 
+/*! @brief Enables the per handle statistics, see EDMA_GetStatistics. The DWT cycle counter must be available. */
+#ifndef FSL_EDMA_ENABLE_STATISTICS
+#define FSL_EDMA_ENABLE_STATISTICS 0
+#endif
+
+/*! @brief Number of entries of the interrupt duration histogram. */
+#ifndef EDMA_STATISTICS_HISTOGRAM_SIZE
+#define EDMA_STATISTICS_HISTOGRAM_SIZE 16U
+#endif
+
 /*! @brief Compute the offset unit from DCHPRI3 */
 #define DMA_DCHPRI_INDEX(channel) (((channel) & ~0x03U) | (3U - ((channel)&0x03U)))
 
@@ -179,6 +189,33 @@ typedef struct _edma_transfer_config
     uint32_t majorLoopCounts;              /*!< Major loop iteration count. */
 } edma_transfer_config_t;
 
+/*! @brief eDMA I/O vector entry, one memory segment of a discontiguous transfer. */
+typedef struct _edma_iovec
+{
+    void *base;      /*!< Segment address. */
+    uint32_t length; /*!< Segment length in bytes, a multiple of the peripheral transfer width. */
+} edma_iovec_t;
+
+/*!
+ * @brief eDMA 2-D transfer configuration
+ *
+ * The transfer moves rows x columns elements, one row per minor loop. Inside a row the addresses advance
+ * by the element strides, and the first element of a row is a row stride after the first element of
+ * the previous row. The strides are in bytes and may be negative or zero.
+ */
+typedef struct _edma_2d_transfer_config
+{
+    uint32_t srcAddr;          /*!< Address of the first source element. */
+    uint32_t destAddr;         /*!< Address of the first destination element. */
+    uint32_t elementSize;      /*!< Element size in bytes, 1, 2, 4, 8 or 32. */
+    uint32_t columns;          /*!< Elements per row, the minor loop. */
+    uint32_t rows;             /*!< Number of rows, the major loop count. */
+    int16_t srcElementStride;  /*!< Source address step between the elements of a row. */
+    int16_t destElementStride; /*!< Destination address step between the elements of a row. */
+    int32_t srcRowStride;      /*!< Source address step between the first elements of two rows. */
+    int32_t destRowStride;     /*!< Destination address step between the first elements of two rows. */
+} edma_2d_transfer_config_t;
+
 /*! @brief eDMA channel priority configuration */
 typedef struct _edma_channel_Preemption_config
 {
@@ -216,6 +253,20 @@ typedef struct _edma_tcd
     __IO uint16_t BITER;     /*!< BITER register, begin minor loop count. */
 } edma_tcd_t;
 
+/*!
+ * @brief Constant initializer of a TCD template, see EDMA_SubmitTcdTemplate.
+ *
+ * The template describes a transfer without scatter/gather: srcSize and destSize are edma_transfer_size_t
+ * values, srcOffset and destOffset the signed address offsets, minorLoopBytes the bytes moved per request.
+ * The addresses and the major loop count are filled in when the template is submitted.
+ */
+#define EDMA_TCD_TEMPLATE_INIT(srcSize, srcOffset, destSize, destOffset, minorLoopBytes)                            \
+    {                                                                                                                \
+        0U, (uint16_t)(srcOffset), (uint16_t)(DMA_ATTR_SSIZE(srcSize) | DMA_ATTR_DSIZE(destSize)),                  \
+            (uint32_t)(minorLoopBytes), 0U, 0U, (uint16_t)(destOffset), 0U, 0U,                                     \
+            (uint16_t)(DMA_CSR_DREQ_MASK | DMA_CSR_INTMAJOR_MASK), 0U                                               \
+    }
+
 /*! @brief Callback for eDMA */
 struct _edma_handle;
 
@@ -239,6 +290,31 @@ struct _edma_handle;
  */
 typedef void (*edma_callback)(struct _edma_handle *handle, void *userData, bool transferDone, uint32_t tcds);
 
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+/*!
+ * @brief eDMA handle statistics
+ *
+ * Times are CPU cycle counts from MSDK_GetCpuCycleCount. The interrupt entry is the closest observable
+ * point to the hardware DONE, the callback latency is the time the driver spends between the two.
+ */
+typedef struct _edma_statistics
+{
+    uint32_t submitTimestamp;    /*!< Cycle count at the last submit. */
+    uint32_t isrEntryTimestamp;  /*!< Cycle count at the last EDMA_HandleIRQ entry. */
+    uint32_t isrExitTimestamp;   /*!< Cycle count at the last EDMA_HandleIRQ exit. */
+    uint32_t isrCount;           /*!< Number of EDMA_HandleIRQ calls. */
+    uint32_t isrMaxCycles;       /*!< Longest EDMA_HandleIRQ call, callback included. */
+    uint64_t isrTotalCycles;     /*!< Cycles spent in EDMA_HandleIRQ, callback included. */
+    uint32_t isrHistogram[EDMA_STATISTICS_HISTOGRAM_SIZE]; /*!< Entry n counts the calls of 2^n to 2^(n+1)-1 cycles,
+                                                                the last entry also counts the longer ones. */
+    uint32_t callbackMaxLatency; /*!< Longest delay from the EDMA_HandleIRQ entry to the callback call. */
+    uint32_t tcdsDone;           /*!< Number of completed TCDs, or completed transfers without a TCD pool. */
+    uint32_t maxTcdsPerIsr;      /*!< Most TCDs completed in one EDMA_HandleIRQ call. */
+    uint64_t bytesMoved;         /*!< Bytes of the completed major loops. */
+    uint32_t maxQueueDepth;      /*!< Most TCDs queued at once, 1 without a TCD pool. */
+} edma_statistics_t;
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
 /*! @brief eDMA transfer handle structure */
 typedef struct _edma_handle
 {
@@ -253,6 +329,9 @@ typedef struct _edma_handle
                                 the memory. */
     volatile int8_t tcdSize; /*!< The total number of TCD slots in the queue. */
     uint8_t flags;           /*!< The status of the current channel. */
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    edma_statistics_t statistics; /*!< Channel statistics, read them with EDMA_GetStatistics. */
+#endif                            /* FSL_EDMA_ENABLE_STATISTICS */
 } edma_handle_t;
 
 /*******************************************************************************
@@ -694,6 +773,28 @@ void EDMA_TcdDisableInterrupts(edma_tcd_t *tcd, uint32_t mask);
  */
 void EDMA_TcdSetMajorOffsetConfig(edma_tcd_t *tcd, int32_t sourceOffset, int32_t destOffset);
 
+/*!
+ * @brief Configures the eDMA TCD for a 2-D strided transfer.
+ *
+ * A row is one minor loop of columns elements, moved with the element strides as SOFF and DOFF. The jump
+ * from the end of a row to the start of the next one is programmed as the minor loop offset, and SLAST
+ * (and DLAST when nextTcd is NULL) brings the addresses back to the first element when the major loop
+ * completes. Typical uses are de-interleaving multi-channel samples, extracting a column of a block and
+ * transposing a matrix band by band.
+ *
+ * The eDMA has one minor loop offset shared by the source and the destination, so the row jump must be
+ * the same on both sides or zero on one of them. The minor loop offset also limits a row to 1023 bytes.
+ *
+ * @param tcd Pointer to the TCD structure, reset with EDMA_TcdReset.
+ * @param config Pointer to the 2-D transfer configuration.
+ * @param nextTcd Pointer to the next TCD structure. It can be NULL if users
+ *                do not want to enable scatter/gather feature.
+ * @retval kStatus_Success The TCD is configured.
+ * @retval kStatus_InvalidArgument The strides can not be expressed with one minor loop offset.
+ * @note The minor loop mapping must be enabled, EDMA_Init enables it.
+ */
+status_t EDMA_TcdSet2DTransferConfig(edma_tcd_t *tcd, const edma_2d_transfer_config_t *config, edma_tcd_t *nextTcd);
+
 /*! @} */
 /*!
  * @name eDMA Channel Transfer Operation
@@ -838,6 +939,24 @@ void EDMA_CreateHandle(edma_handle_t *handle, DMA_Type *base, uint32_t channel);
  */
 void EDMA_InstallTCDMemory(edma_handle_t *handle, edma_tcd_t *tcdPool, uint32_t tcdSize);
 
+/*!
+ * @brief Enables or disables the lock-free TCD queue mode.
+ *
+ * By default EDMA_SubmitTransfer and EDMA_StartTransfer mask all interrupts while they update the TCD queue.
+ * In lock-free mode the queue is treated as single producer/single consumer: the submitter owns the tail index,
+ * EDMA_HandleIRQ owns the header index, and the shared used-slot counter is updated with exclusive accesses
+ * (LDREX/STREX), so no global interrupt masking happens on the submit path. The one exception is a submission
+ * that finds the chain dead: it installs its TCD in the registers and sets the header index to the TCD after it,
+ * which is why the submitters must not run above the channel interrupt priority, see EDMA_SubmitTransfer.
+ *
+ * @param handle eDMA handle pointer.
+ * @param enable true to enable the lock-free queue mode, false to use the interrupt masking queue.
+ * @note This function shall be called after EDMA_InstallTCDMemory, which resets the mode.
+ * @note In lock-free mode, EDMA_SubmitTransfer must only be called from one context (one task, or one interrupt
+ *       priority level) at a time.
+ */
+void EDMA_EnableLockFreeQueue(edma_handle_t *handle, bool enable);
+
 /*!
  * @brief Installs a callback function for the eDMA transfer.
  *
@@ -916,9 +1035,112 @@ void EDMA_PrepareTransfer(edma_transfer_config_t *config,
  * @retval kStatus_EDMA_Success It means submit transfer request succeed.
  * @retval kStatus_EDMA_QueueFull It means TCD queue is full. Submit transfer request is not allowed.
  * @retval kStatus_EDMA_Busy It means the given channel is busy, need to submit request later.
+ * @note With a TCD pool, this function and the other submit functions must be called in thread mode or from an
+ *       interrupt whose priority is not higher than the one of the channel interrupt. A submission that installs
+ *       its TCD on a dead chain resets the header index of the queue, it must not run while the completion
+ *       interrupt of the previous TCDs is pending. This is asserted.
  */
 status_t EDMA_SubmitTransfer(edma_handle_t *handle, const edma_transfer_config_t *config);
 
+/*!
+ * @brief Submits a batch of eDMA transfer requests.
+ *
+ * This function builds the TCDs for all the configurations in the TCD pool in one pass, links them
+ * with each other and then splices the whole chain after the last submitted TCD. Compared with
+ * calling EDMA_SubmitTransfer count times, the queue is locked once and the previous TCD is
+ * checked against the TCD registers only once. Each TCD raises its own major loop interrupt, so the
+ * callback reports the TCDs the same way as for EDMA_SubmitTransfer.
+ *
+ * @param handle eDMA handle pointer.
+ * @param configs Array of count eDMA transfer configuration structures.
+ * @param count Number of configurations in configs, it must not exceed the TCD pool size.
+ * @retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * @retval kStatus_EDMA_QueueFull It means there are fewer than count free TCDs in the queue, nothing is submitted.
+ * @note The TCD pool must be installed with EDMA_InstallTCDMemory before calling this function.
+ */
+status_t EDMA_SubmitTransferBatch(edma_handle_t *handle, const edma_transfer_config_t *configs, uint32_t count);
+
+/*!
+ * @brief Submits a transfer between a peripheral register and discontiguous memory segments.
+ *
+ * This function builds one TCD per memory segment in the TCD pool, links them and splices the chain after
+ * the last submitted TCD, so a frame spread over several buffers is moved without copying it into a
+ * staging buffer first. Segments that follow each other in memory are merged into one TCD, and a segment
+ * longer than the major loop count allows is split. Every TCD raises the major loop interrupt, as with
+ * EDMA_SubmitTransferBatch, so the callback can be called several times for one vector and the tcds it reports
+ * add up to the number of TCDs built. The vector is complete when the callback reports transferDone, or when
+ * the TCDs of the vector are all counted if more transfers are queued after it.
+ *
+ * @param handle eDMA handle pointer.
+ * @param peripheralAddr Peripheral data register address.
+ * @param width Peripheral transfer width in bytes, also the bytes moved per request.
+ * @param iov Array of iovCount memory segments, in transfer order.
+ * @param iovCount Number of entries in iov.
+ * @param direction kEDMA_MemoryToPeripheral or kEDMA_PeripheralToMemory.
+ * @retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * @retval kStatus_EDMA_QueueFull It means there are not enough free TCDs in the queue, nothing is submitted.
+ * @note The TCD pool must be installed with EDMA_InstallTCDMemory before calling this function.
+ */
+status_t EDMA_SubmitIov(edma_handle_t *handle,
+                        uint32_t peripheralAddr,
+                        uint32_t width,
+                        const edma_iovec_t *iov,
+                        uint32_t iovCount,
+                        edma_transfer_type_t direction);
+
+/*!
+ * @brief Submits a 2-D strided eDMA transfer request.
+ *
+ * This function submits the transfer configured by EDMA_TcdSet2DTransferConfig, to the channel TCD
+ * registers or to the TCD queue when a TCD pool is installed. A large transfer can be split in bands of
+ * rows submitted one after the other, for example to transpose a matrix band by band.
+ *
+ * @param handle eDMA handle pointer.
+ * @param config Pointer to the 2-D transfer configuration.
+ * @retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * @retval kStatus_InvalidArgument The strides can not be expressed with one minor loop offset.
+ * @retval kStatus_EDMA_QueueFull It means TCD queue is full. Submit transfer request is not allowed.
+ * @retval kStatus_EDMA_Busy It means the given channel is busy, need to submit request later.
+ */
+status_t EDMA_Submit2DTransfer(edma_handle_t *handle, const edma_2d_transfer_config_t *config);
+
+/*!
+ * @brief Prepares a TCD template from an eDMA transfer configuration.
+ *
+ * The template keeps the transfer widths, offsets and minor loop byte count of the configuration, the
+ * addresses and the major loop count are ignored. Build the template once, then submit it with
+ * EDMA_SubmitTcdTemplate for every transfer. Templates known at compile time can be defined with
+ * EDMA_TCD_TEMPLATE_INIT instead.
+ *
+ * @param tcdTemplate Pointer to the TCD template, it does not need to be 32 bytes aligned.
+ * @param config Pointer to eDMA transfer configuration structure.
+ */
+void EDMA_PrepareTcdTemplate(edma_tcd_t *tcdTemplate, const edma_transfer_config_t *config);
+
+/*!
+ * @brief Submits an eDMA transfer request built from a TCD template.
+ *
+ * This function is the fast path of EDMA_SubmitTransfer for transfers that only differ in the addresses
+ * and the length. The template image is patched with the addresses and the major loop count and copied
+ * into the channel TCD registers, or into the TCD pool when EDMA_InstallTCDMemory has been called, with
+ * 32-bit writes. The major loop interrupt and the auto stop request feature are enabled as in
+ * EDMA_SubmitTransfer.
+ *
+ * @param handle eDMA handle pointer.
+ * @param tcdTemplate Pointer to the TCD template.
+ * @param srcAddr Source address.
+ * @param destAddr Destination address.
+ * @param majorLoopCounts Major loop iteration count, transfer bytes divided by the minor loop byte count.
+ * @retval kStatus_EDMA_Success It means submit transfer request succeed.
+ * @retval kStatus_EDMA_QueueFull It means TCD queue is full. Submit transfer request is not allowed.
+ * @retval kStatus_EDMA_Busy It means the given channel is busy, need to submit request later.
+ */
+status_t EDMA_SubmitTcdTemplate(edma_handle_t *handle,
+                                const edma_tcd_t *tcdTemplate,
+                                uint32_t srcAddr,
+                                uint32_t destAddr,
+                                uint32_t majorLoopCounts);
+
 /*!
  * @brief eDMA starts transfer.
  *
@@ -977,6 +1199,26 @@ static inline uint32_t EDMA_GetNextTCDAddress(edma_handle_t *handle)
     return (uint32_t)(handle->base->TCD[handle->channel].DLAST_SGA);
 }
 
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+/*!
+ * @brief Gets a snapshot of the eDMA handle statistics.
+ *
+ * The statistics are copied with the interrupts masked, so they are consistent with each other. Compare the
+ * total interrupt cycles of the handles to find the channel using most of the interrupt budget.
+ *
+ * @param handle eDMA handle pointer.
+ * @param statistics Pointer to the statistics copy.
+ */
+void EDMA_GetStatistics(edma_handle_t *handle, edma_statistics_t *statistics);
+
+/*!
+ * @brief Clears the eDMA handle statistics.
+ *
+ * @param handle eDMA handle pointer.
+ */
+void EDMA_ResetStatistics(edma_handle_t *handle);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
 /*!
  * @brief eDMA IRQ handler for the current major loop transfer completion.
  *
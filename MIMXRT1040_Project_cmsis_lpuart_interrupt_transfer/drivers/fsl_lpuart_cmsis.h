@@ -132,9 +132,45 @@ extern ARM_DRIVER_USART Driver_USART5;
 #endif
 
 /* USART Driver state flags */
-#define USART_FLAG_UNINIT     (0UL)
-#define USART_FLAG_INIT       (1UL << 0)
-#define USART_FLAG_POWER      (1UL << 1)
-#define USART_FLAG_CONFIGURED (1UL << 2)
+#define USART_FLAG_UNINIT        (0UL)
+#define USART_FLAG_INIT          (1UL << 0)
+#define USART_FLAG_POWER         (1UL << 1)
+#define USART_FLAG_CONFIGURED    (1UL << 2)
+#define USART_FLAG_RX_CONTINUOUS (1UL << 3)
+/* The last Send/Receive went through the interrupt transfer handle, on the eDMA instances with
+ * RTE_USARTn_DMA_TX_MIN_SIZE or RTE_USARTn_DMA_RX_MIN_SIZE, which use it for the sends and receives shorter
+ * than these sizes. */
+#define USART_FLAG_TX_INTERRUPT (1UL << 4)
+#define USART_FLAG_RX_INTERRUPT (1UL << 5)
+
+/*!
+ * @brief Continuous receive, eDMA instances only; arg: 0=disabled, 1=enabled.
+ *
+ * Once enabled, ARM_USART_Receive starts an eDMA receive using its buffer as a ring, the buffer must not be cached
+ * and its size must be a power of 2. The receive runs until ARM_USART_ABORT_RECEIVE or this control with arg 0,
+ * it signals ARM_USART_EVENT_RX_TIMEOUT on idle line and never ARM_USART_EVENT_RECEIVE_COMPLETE.
+ * ARM_USART_GetRxCount returns the bytes in the ring, LPUART_ReadAvailable reads them.
+ */
+#define ARM_USART_CONTROL_RX_CONTINUOUS (0x80UL << ARM_USART_CONTROL_Pos)
+/*! @brief Reads the bytes of the continuous receive; arg = pointer to lpuart_transfer_t, returns the bytes read. */
+#define ARM_USART_READ_AVAILABLE (0x81UL << ARM_USART_CONTROL_Pos)
+
+/*!
+ * @brief Copies the bytes received in continuous mode, without waiting and without re-arming the receive.
+ *
+ * @param driver CMSIS USART driver, for example &Driver_USART2.
+ * @param data Receives the bytes, NULL to drop them once used in place in the ring.
+ * @param num Size of data, or the number of bytes to drop.
+ * @return Number of bytes read, or a negative ARM_DRIVER_ERROR code.
+ */
+static inline int32_t LPUART_ReadAvailable(ARM_DRIVER_USART *driver, void *data, uint32_t num)
+{
+    lpuart_transfer_t xfer;
+
+    xfer.data     = (uint8_t *)data;
+    xfer.dataSize = num;
+
+    return driver->Control(ARM_USART_READ_AVAILABLE, (uint32_t)&xfer);
+}
 
 #endif /* FSL_LPUART_CMSIS_H_ */
@@ -23,7 +23,7 @@
 /*! @name Driver version */
 /*! @{ */
 /*! @brief LPUART EDMA driver version. */
-#define FSL_LPUART_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 6, 0))
+#define FSL_LPUART_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 8, 1))
 /*! @} */
 
 /* Forward declaration of the handle typedef. */
@@ -52,6 +52,14 @@ struct _lpuart_edma_handle
 
     volatile uint8_t txState; /*!< TX transfer state. */
     volatile uint8_t rxState; /*!< RX transfer state */
+
+    uint8_t *rxRingBuffer;              /*!< Continuous receive ring, NULL when not running. */
+    size_t rxRingBufferSize;            /*!< Size of the ring, a power of 2. */
+    uint32_t rxRingBufferTail;          /*!< Bytes read out of the ring since the start. */
+    volatile uint32_t rxRingBufferLaps; /*!< Number of times the eDMA wrapped around the ring. */
+
+    uint8_t txQueueSize;           /*!< Number of TCDs of the send queue, 0 when the queue is disabled. */
+    volatile uint8_t txQueueCount; /*!< Number of queued buffers not sent yet. */
 };
 
 /*******************************************************************************
@@ -92,15 +100,39 @@ void LPUART_TransferCreateHandleEDMA(LPUART_Type *base,
  * This function sends data using eDMA. This is a non-blocking function, which returns
  * right away. When all data is sent, the send callback function is called.
  *
+ * When the send queue is enabled by LPUART_TransferEnableSendQueueEDMA, the buffer is appended to the queue
+ * instead, see LPUART_TransferEnableSendQueueEDMA.
+ *
  * @param base LPUART peripheral base address.
  * @param handle LPUART handle pointer.
  * @param xfer LPUART eDMA transfer structure. See #lpuart_transfer_t.
  * @retval kStatus_Success if succeed, others failed.
- * @retval kStatus_LPUART_TxBusy Previous transfer on going.
+ * @retval kStatus_LPUART_TxBusy Previous transfer on going, or the send queue is full.
  * @retval kStatus_InvalidArgument Invalid argument.
  */
 status_t LPUART_SendEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, lpuart_transfer_t *xfer);
 
+/*!
+ * @brief Sends a frame gathered from several buffers using eDMA.
+ *
+ * This function sends the segments of iov back to back without copying them into one buffer, see
+ * EDMA_SubmitIov. This is a non-blocking function, which returns right away. When all the segments are
+ * sent, the send callback function is called.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ * @param iov Array of iovCount segments, in transmit order. The array and the buffers must stay valid
+ *            until the send callback is called.
+ * @param iovCount Number of entries in iov.
+ * @retval kStatus_Success if succeed, others failed.
+ * @retval kStatus_LPUART_TxBusy Previous transfer on going.
+ * @note The TX eDMA handle must have a TCD pool installed by EDMA_InstallTCDMemory, with one TCD per
+ *       segment that does not follow the previous one in memory.
+ * @note While a vector is sent, LPUART_TransferGetSendCountEDMA only counts the bytes of the segment being sent.
+ * @note This function can not be used while the send queue is enabled.
+ */
+status_t LPUART_SendEDMAIov(LPUART_Type *base, lpuart_edma_handle_t *handle, const edma_iovec_t *iov, uint32_t iovCount);
+
 /*!
  * @brief Receives data using eDMA.
  *
@@ -165,10 +197,108 @@ status_t LPUART_TransferGetSendCountEDMA(LPUART_Type *base, lpuart_edma_handle_t
  */
 status_t LPUART_TransferGetReceiveCountEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, uint32_t *count);
 
+/*!
+ * @brief Starts receiving continuously into a ring buffer using eDMA.
+ *
+ * The RX eDMA channel writes the ring over and over without being re-armed, so no byte is lost between two
+ * messages. The channel interrupts once per wrap only. The idle line interrupt is enabled, when the line stays
+ * idle after a frame, the callback is called with @ref kStatus_LPUART_IdleLineDetected, then
+ * LPUART_TransferGetRxRingBufferLengthEDMA gives the received bytes and LPUART_TransferReadRingBufferEDMA
+ * copies them out. When the eDMA wraps over unread data, the callback is called with
+ * @ref kStatus_LPUART_RxRingBufferOverrun.
+ *
+ * While the ring runs, LPUART_ReceiveEDMA returns @ref kStatus_LPUART_RxBusy.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param ringBuffer Ring written by the eDMA, it must not be cached.
+ * @param ringBufferSize Size of the ring, a power of 2, at most the eDMA major loop count.
+ * @retval kStatus_Success The ring runs.
+ * @retval kStatus_LPUART_RxBusy A receive is ongoing.
+ */
+status_t LPUART_TransferStartRingBufferEDMA(LPUART_Type *base,
+                                            lpuart_edma_handle_t *handle,
+                                            uint8_t *ringBuffer,
+                                            size_t ringBufferSize);
+
+/*!
+ * @brief Stops the continuous receive.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferStopRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the number of bytes received in the ring and not read yet.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @return Number of bytes, at most the size of the ring, 0 when the ring does not run.
+ */
+size_t LPUART_TransferGetRxRingBufferLengthEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
+/*!
+ * @brief Copies the received bytes out of the ring.
+ *
+ * The function copies what is available and returns right away, the eDMA keeps running. When the eDMA has
+ * overwritten unread data, the oldest bytes are dropped and the copy starts one ring behind the eDMA.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param data Receives the bytes, NULL to drop them, for data already used in place in the ring.
+ * @param length Size of data.
+ * @return Number of copied bytes.
+ */
+size_t LPUART_TransferReadRingBufferEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle, uint8_t *data, size_t length);
+
+/*!
+ * @brief Enables the send queue.
+ *
+ * In queue mode, LPUART_SendEDMA appends the buffer to the queue instead of returning
+ * @ref kStatus_LPUART_TxBusy while a send is ongoing. Each queued buffer takes one TCD of the pool, the TCDs are
+ * linked while the eDMA runs, so the buffers go out back to back without a gap on the line. The callback is called
+ * with @ref kStatus_LPUART_TxBufferSent once per buffer, in queue order, when its last byte is written to the
+ * LPUART, then with @ref kStatus_LPUART_TxIdle once the queue is empty and the last byte is shifted out. A buffer
+ * can be queued from the callback.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @param tcdPool Memory pool of the TCDs, 32 bytes aligned, it must not be cached.
+ * @param tcdCount Number of TCDs of the pool, the number of buffers that can be queued.
+ * @note The queue must be enabled while no send is ongoing, and LPUART_SendEDMA must not be called from an
+ *       interrupt of higher priority than the TX eDMA channel one.
+ * @note While the queue runs, LPUART_TransferGetSendCountEDMA only counts the bytes of the buffer being sent.
+ */
+void LPUART_TransferEnableSendQueueEDMA(LPUART_Type *base,
+                                        lpuart_edma_handle_t *handle,
+                                        edma_tcd_t *tcdPool,
+                                        uint32_t tcdCount);
+
+/*!
+ * @brief Disables the send queue.
+ *
+ * The ongoing send is aborted, the queued buffers are dropped without callback.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ */
+void LPUART_TransferDisableSendQueueEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
+/*!
+ * @brief Gets the number of queued buffers not sent yet.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle Pointer to lpuart_edma_handle_t structure.
+ * @return Number of buffers, 0 when the queue is disabled.
+ */
+uint32_t LPUART_TransferGetSendQueueLengthEDMA(LPUART_Type *base, lpuart_edma_handle_t *handle);
+
 /*!
  * @brief LPUART eDMA IRQ handle function.
  *
- * This function handles the LPUART tx complete IRQ request and invoke user callback.
+ * This function handles the LPUART tx complete IRQ request of an eDMA send and, while the ring runs, the idle line
+ * IRQ request, and invoke user callback.
  * It is not set to static so that it can be used in user application.
  * @note This function is used as default IRQ handler by double weak mechanism.
  * If user's specific IRQ handler is implemented, make sure this function is invoked in the handler.
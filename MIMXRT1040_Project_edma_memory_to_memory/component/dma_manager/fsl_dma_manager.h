@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FSL_DMA_MANAGER_H_
+#define FSL_DMA_MANAGER_H_
+
+#include "fsl_common.h"
+#include "fsl_edma.h"
+#include "fsl_dmamux.h"
+
+/*!
+ * @addtogroup dma_manager
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Let the manager choose the channel. */
+#define DMAMGR_DYNAMIC_ALLOCATE 0xFFU
+
+/*! @brief Leave the DMAMUX channel disabled, for channels started by channel linking or by software. */
+#define DMAMGR_NO_SOURCE (-1)
+
+/*! @brief DMA manager status codes. */
+enum
+{
+    kStatus_DMAMGR_ChannelOccupied = MAKE_STATUS(kStatusGroup_DMAMGR, 0), /*!< The requested channel is in use. */
+    kStatus_DMAMGR_ChannelNotUsed  = MAKE_STATUS(kStatusGroup_DMAMGR, 1), /*!< The channel was not allocated. */
+    kStatus_DMAMGR_NoFreeChannel   = MAKE_STATUS(kStatusGroup_DMAMGR, 2), /*!< All the channels are in use. */
+};
+
+/*! @brief Placement of a dynamically allocated channel. */
+typedef enum _dmamgr_priority
+{
+    kDMAMGR_PriorityLow = 0U, /*!< Lowest free channel, the eDMA fixed priority grows with the channel number. */
+    kDMAMGR_PriorityHigh,     /*!< Highest free channel, in the highest priority group when there are several. */
+} dmamgr_priority_t;
+
+/*! @brief Channel request. */
+typedef struct _dmamgr_channel_config
+{
+    int32_t source;             /*!< DMAMUX request source, see dma_request_source_t, or DMAMGR_NO_SOURCE.
+                                     Ignored when alwaysOn. */
+    bool alwaysOn;              /*!< Route the channel to an always-on source, for memory to memory transfers. */
+    uint32_t channel;           /*!< Wanted channel, or DMAMGR_DYNAMIC_ALLOCATE. */
+    dmamgr_priority_t priority; /*!< Placement of a dynamically allocated channel. */
+    bool busy;                  /*!< The channel interrupts often, keep it away from other busy channels. */
+} dmamgr_channel_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Initializes the DMA manager.
+ *
+ * The eDMA and the DMAMUX must be initialized by EDMA_Init and DMAMUX_Init before requesting channels.
+ *
+ * @param base eDMA peripheral base address.
+ * @param dmamux DMAMUX peripheral base address.
+ */
+void DMAMGR_Init(DMA_Type *base, DMAMUX_Type *dmamux);
+
+/*!
+ * @brief Deinitializes the DMA manager, every allocated channel is released.
+ */
+void DMAMGR_Deinit(void);
+
+/*!
+ * @brief Gets the default channel request.
+ *
+ * The default request asks for a dynamically allocated, low priority, not busy channel without a source.
+ *
+ * @param config Pointer to the channel request.
+ */
+void DMAMGR_GetDefaultChannelConfig(dmamgr_channel_config_t *config);
+
+/*!
+ * @brief Allocates an eDMA channel and routes its DMAMUX source.
+ *
+ * The DMAMUX channel is left disabled when the source is DMAMGR_NO_SOURCE.
+ * A fixed channel is allocated when it is free. For a dynamic request the free channels are searched from the
+ * lowest or the highest channel depending on the priority, and the first one with the lightest interrupt
+ * sharing is taken: channels n and n + FSL_FEATURE_EDMA_MODULE_CHANNEL_IRQ_ENTRY_SHARED_OFFSET share one
+ * interrupt vector, so a busy channel prefers a partner that is free, then one that is not busy.
+ *
+ * @param config Pointer to the channel request.
+ * @param channel Allocated channel.
+ * @retval kStatus_Success The channel is allocated and its DMAMUX channel enabled unless there is no source.
+ * @retval kStatus_DMAMGR_ChannelOccupied The fixed channel is already allocated.
+ * @retval kStatus_DMAMGR_NoFreeChannel No channel is free.
+ */
+status_t DMAMGR_RequestChannel(const dmamgr_channel_config_t *config, uint32_t *channel);
+
+/*!
+ * @brief Releases an eDMA channel.
+ *
+ * The DMAMUX channel is disabled and the channel TCD is reset. Abort the transfer with EDMA_AbortTransfer
+ * before releasing a channel used through an eDMA handle.
+ *
+ * @param channel Channel to release.
+ * @retval kStatus_Success The channel is released.
+ * @retval kStatus_DMAMGR_ChannelNotUsed The channel was not allocated.
+ */
+status_t DMAMGR_ReleaseChannel(uint32_t channel);
+
+/*!
+ * @brief Checks whether a channel is allocated.
+ *
+ * @param channel Channel number.
+ * @retval true The channel is allocated.
+ * @retval false The channel is free.
+ */
+bool DMAMGR_IsChannelOccupied(uint32_t channel);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* FSL_DMA_MANAGER_H_ */
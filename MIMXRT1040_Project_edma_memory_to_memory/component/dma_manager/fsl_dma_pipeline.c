@@ -0,0 +1,253 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_dma_pipeline.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void DMAPIPE_LastStageCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void DMAPIPE_LastStageCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    dmapipe_handle_t *pipeline = (dmapipe_handle_t *)param;
+
+    if (transferDone)
+    {
+        pipeline->completions++;
+        if (pipeline->callback != NULL)
+        {
+            pipeline->callback(pipeline, pipeline->userData);
+        }
+    }
+}
+
+/* Loads the TCD registers of one stage and links it with the next stage. */
+static void DMAPIPE_ConfigureStage(dmapipe_handle_t *handle,
+                                   uint32_t stage,
+                                   const dmapipe_stage_config_t *config,
+                                   bool continuous)
+{
+    DMA_Type *base   = handle->base;
+    uint32_t channel = handle->channels[stage];
+    uint32_t next;
+
+    EDMA_ResetChannel(base, channel);
+    EDMA_SetTransferConfig(base, channel, &config->transfer, NULL);
+    EDMA_SetMajorOffsetConfig(base, channel, config->srcLastOffset, config->destLastOffset);
+
+    if ((stage + 1U) < handle->stageCount)
+    {
+        next = handle->channels[stage + 1U];
+        if (config->link == kDMAPIPE_LinkMinor)
+        {
+            /* The link channel number takes the upper bits of CITER and BITER. */
+            assert(config->transfer.majorLoopCounts <= DMA_CITER_ELINKYES_CITER_MASK);
+            EDMA_SetChannelLink(base, channel, kEDMA_MinorLink, next);
+        }
+        /* The last minor loop raises the major link instead of the minor link, so both are always set. */
+        EDMA_SetChannelLink(base, channel, kEDMA_MajorLink, next);
+    }
+
+    /* EDMA_ResetChannel sets the auto disable request feature, a continuous pipeline keeps its request. */
+    if (continuous)
+    {
+        base->TCD[channel].CSR &= ~(uint16_t)DMA_CSR_DREQ_MASK;
+    }
+}
+
+/*!
+ * brief Gets the default pipeline configuration.
+ *
+ * param config Pointer to the pipeline configuration.
+ */
+void DMAPIPE_GetDefaultConfig(dmapipe_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->source   = DMAMGR_NO_SOURCE;
+    config->priority = kDMAMGR_PriorityLow;
+}
+
+/*!
+ * brief Builds a pipeline of linked eDMA channels.
+ *
+ * param handle Pointer to the pipeline handle.
+ * param base eDMA peripheral base address, initialized by EDMA_Init.
+ * param config Pointer to the pipeline configuration.
+ * retval kStatus_Success The pipeline is built, call DMAPIPE_Start to run it.
+ * retval kStatus_DMAMGR_NoFreeChannel Not enough free channels, none is kept.
+ */
+status_t DMAPIPE_Create(dmapipe_handle_t *handle, DMA_Type *base, const dmapipe_config_t *config)
+{
+    assert(handle != NULL);
+    assert(base != NULL);
+    assert(config != NULL);
+    assert(config->stages != NULL);
+    assert((config->stageCount != 0U) && (config->stageCount <= DMAPIPE_MAX_STAGES));
+
+    dmamgr_channel_config_t channelConfig;
+    status_t status;
+    uint32_t stage;
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->base     = base;
+    handle->callback = config->callback;
+    handle->userData = config->userData;
+
+    for (stage = 0U; stage < config->stageCount; stage++)
+    {
+        DMAMGR_GetDefaultChannelConfig(&channelConfig);
+        channelConfig.priority = config->priority;
+        /* Only the first stage is paced by a request, the others are started by their link. */
+        if (stage == 0U)
+        {
+            channelConfig.source   = config->source;
+            channelConfig.alwaysOn = config->alwaysOn;
+        }
+        else
+        {
+            channelConfig.source = DMAMGR_NO_SOURCE;
+        }
+        /* The last stage owns the only interrupt of the pipeline. */
+        channelConfig.busy = ((stage + 1U) == config->stageCount);
+
+        status = DMAMGR_RequestChannel(&channelConfig, &handle->channels[stage]);
+        if (status != kStatus_Success)
+        {
+            while (stage > 0U)
+            {
+                stage--;
+                (void)DMAMGR_ReleaseChannel(handle->channels[stage]);
+            }
+            return status;
+        }
+    }
+    handle->stageCount = config->stageCount;
+
+    /* EDMA_CreateHandle clears the TCD, so the last stage gets its handle before its TCD is loaded. */
+    EDMA_CreateHandle(&handle->lastStage, base, handle->channels[handle->stageCount - 1U]);
+    EDMA_SetCallback(&handle->lastStage, DMAPIPE_LastStageCallback, handle);
+
+    for (stage = 0U; stage < handle->stageCount; stage++)
+    {
+        DMAPIPE_ConfigureStage(handle, stage, &config->stages[stage], config->continuous);
+    }
+    EDMA_EnableChannelInterrupts(base, handle->channels[handle->stageCount - 1U],
+                                 (uint32_t)kEDMA_MajorInterruptEnable);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Stops the pipeline and releases its channels to the DMA manager.
+ *
+ * param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Destroy(dmapipe_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    uint32_t stage;
+
+    if (handle->stageCount == 0U)
+    {
+        return;
+    }
+
+    DMAPIPE_Stop(handle);
+    EDMA_AbortTransfer(&handle->lastStage);
+    for (stage = 0U; stage < handle->stageCount; stage++)
+    {
+        (void)DMAMGR_ReleaseChannel(handle->channels[stage]);
+    }
+    handle->stageCount = 0U;
+}
+
+/*!
+ * brief Starts the pipeline, the first stage accepts requests from its source.
+ *
+ * The error flags of the stages are cleared. When a stage error halted the eDMA, see
+ * edma_config_t::enableHaltOnError, the engine is resumed.
+ *
+ * param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Start(dmapipe_handle_t *handle)
+{
+    assert(handle != NULL);
+    assert(handle->stageCount != 0U);
+
+    uint32_t stage;
+    uint32_t errors = 0U;
+
+    for (stage = 0U; stage < handle->stageCount; stage++)
+    {
+        errors |= handle->base->ERR & (1UL << handle->channels[stage]);
+        EDMA_ClearChannelStatusFlags(handle->base, handle->channels[stage], (uint32_t)kEDMA_ErrorFlag);
+    }
+    /* With halt on error, the error of a stage stopped the whole engine. */
+    if (errors != 0U)
+    {
+        handle->base->CR &= ~DMA_CR_HALT_MASK;
+    }
+    EDMA_EnableChannelRequest(handle->base, handle->channels[0]);
+}
+
+/*!
+ * brief Stops the pipeline.
+ *
+ * param handle Pointer to the pipeline handle.
+ */
+void DMAPIPE_Stop(dmapipe_handle_t *handle)
+{
+    assert(handle != NULL);
+    assert(handle->stageCount != 0U);
+
+    EDMA_DisableChannelRequest(handle->base, handle->channels[0]);
+}
+
+/*!
+ * brief Gets the pipeline status.
+ *
+ * param handle Pointer to the pipeline handle.
+ * param status Pointer to the pipeline status.
+ */
+void DMAPIPE_GetStatus(dmapipe_handle_t *handle, dmapipe_status_t *status)
+{
+    assert(handle != NULL);
+    assert(status != NULL);
+
+    uint32_t channel;
+    uint32_t stage;
+
+    status->running     = false;
+    status->completions = handle->completions;
+    status->errorStages = 0U;
+
+    for (stage = 0U; stage < handle->stageCount; stage++)
+    {
+        channel = handle->channels[stage];
+        if ((handle->base->TCD[channel].CSR & DMA_CSR_ACTIVE_MASK) != 0U)
+        {
+            status->running = true;
+        }
+        if ((handle->base->ERR & (1UL << channel)) != 0U)
+        {
+            status->errorStages |= (1UL << stage);
+        }
+    }
+    if ((stage != 0U) && ((handle->base->ERQ & (1UL << handle->channels[0])) != 0U))
+    {
+        status->running = true;
+    }
+}
@@ -42,15 +42,6 @@ enum
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
-/*!
- * @brief Check whether the RX ring buffer is full.
- *
- * @userData handle LPUART handle pointer.
- * @retval true  RX ring buffer is full.
- * @retval false RX ring buffer is not full.
- */
-static bool LPUART_TransferIsRxRingBufferFull(LPUART_Type *base, lpuart_handle_t *handle);
-
 /*!
  * @brief Write to TX register using non-blocking method.
  *
@@ -87,10 +78,24 @@ static void LPUART_WriteNonBlocking16bit(LPUART_Type *base, const uint16_t *data
  * sure the RX register is full or TX FIFO has data before calling this function.
  *
  * @param base LPUART peripheral base address.
- * @param data Start address of the buffer to store the received data.
+ * @param data Start address of the uint8_t buffer to store the received data.
+ * @param index Index of the first data to store in the buffer.
  * @param length Size of the buffer.
  */
-static void LPUART_ReadNonBlocking(LPUART_Type *base, uint8_t *data, size_t length);
+static void LPUART_ReadNonBlocking(LPUART_Type *base, void *data, size_t index, size_t length);
+#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
+/*!
+ * @brief Read RX register using non-blocking method in 7bit mode.
+ *
+ * This function reads data from the RX register directly and drops the parity bit above the 7 data bits.
+ *
+ * @param base LPUART peripheral base address.
+ * @param data Start address of the uint8_t buffer to store the received data.
+ * @param index Index of the first data to store in the buffer.
+ * @param length Size of the buffer.
+ */
+static void LPUART_ReadNonBlocking7bit(LPUART_Type *base, void *data, size_t index, size_t length);
+#endif
 /*!
  * @brief Read RX register using non-blocking method in 9bit or 10bit mode.
  *
@@ -99,10 +104,28 @@ static void LPUART_ReadNonBlocking(LPUART_Type *base, uint8_t *data, size_t leng
  * @note This function only support 9bit or 10bit transfer.
  *
  * @param base LPUART peripheral base address.
- * @param data Start address of the buffer to store the received data.
+ * @param data Start address of the uint16_t buffer to store the received data.
+ * @param index Index of the first data to store in the buffer.
  * @param length Size of the buffer.
  */
-static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, uint16_t *data, size_t length);
+static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, void *data, size_t index, size_t length);
+/*!
+ * @brief Selects the RX FIFO read function of the handle data width.
+ *
+ * @param handle LPUART handle pointer.
+ */
+static void LPUART_TransferSetRxRead(lpuart_handle_t *handle);
+/*!
+ * @brief Reads received data from the RX FIFO into the RX ring buffer.
+ *
+ * The data is stored in one or two parts around the end of the ring buffer, and the ring buffer
+ * indexes are updated once.
+ *
+ * @param base LPUART peripheral base address.
+ * @param handle LPUART handle pointer.
+ * @param length Number of data to read, less than the ring buffer size.
+ */
+static void LPUART_TransferReadRxRingBuffer(LPUART_Type *base, lpuart_handle_t *handle, size_t length);
 /*!
  * @brief LPUART_TransferHandleIDLEIsReady handle function.
  * This function handles when IDLE is ready.
@@ -237,23 +260,6 @@ size_t LPUART_TransferGetRxRingBufferLength(LPUART_Type *base, lpuart_handle_t *
     return size;
 }
 
-static bool LPUART_TransferIsRxRingBufferFull(LPUART_Type *base, lpuart_handle_t *handle)
-{
-    assert(NULL != handle);
-
-    bool full;
-
-    if (LPUART_TransferGetRxRingBufferLength(base, handle) == (handle->rxRingBufferSize - 1U))
-    {
-        full = true;
-    }
-    else
-    {
-        full = false;
-    }
-    return full;
-}
-
 static void LPUART_WriteNonBlocking(LPUART_Type *base, const uint8_t *data, size_t length)
 {
     assert(NULL != data);
@@ -281,47 +287,105 @@ static void LPUART_WriteNonBlocking16bit(LPUART_Type *base, const uint16_t *data
     }
 }
 
-static void LPUART_ReadNonBlocking(LPUART_Type *base, uint8_t *data, size_t length)
+/* The data width is resolved once per transfer into the read functions below, their loops do not test it per data. */
+static void LPUART_ReadNonBlocking(LPUART_Type *base, void *data, size_t index, size_t length)
 {
     assert(NULL != data);
 
+    uint8_t *buffer = &((uint8_t *)data)[index];
     size_t i;
-#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
-    uint32_t ctrl        = base->CTRL;
-    bool isSevenDataBits = (((ctrl & LPUART_CTRL_M7_MASK) != 0U) ||
-                            (((ctrl & LPUART_CTRL_M_MASK) == 0U) && ((ctrl & LPUART_CTRL_PE_MASK) != 0U)));
-#endif
 
     /* The Non Blocking read data API assume user have ensured there is enough space in
     peripheral to write. */
     for (i = 0; i < length; i++)
     {
+        buffer[i] = (uint8_t)(base->DATA);
+    }
+}
+
 #if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
-        if (isSevenDataBits)
-        {
-            data[i] = (uint8_t)(base->DATA & 0x7FU);
-        }
-        else
-        {
-            data[i] = (uint8_t)base->DATA;
-        }
-#else
-        data[i] = (uint8_t)(base->DATA);
-#endif
+static void LPUART_ReadNonBlocking7bit(LPUART_Type *base, void *data, size_t index, size_t length)
+{
+    assert(NULL != data);
+
+    uint8_t *buffer = &((uint8_t *)data)[index];
+    size_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        buffer[i] = (uint8_t)(base->DATA & 0x7FU);
     }
 }
+#endif
 
-static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, uint16_t *data, size_t length)
+static void LPUART_ReadNonBlocking16bit(LPUART_Type *base, void *data, size_t index, size_t length)
 {
     assert(NULL != data);
 
+    uint16_t *buffer = &((uint16_t *)data)[index];
     size_t i;
     /* The Non Blocking read data API assume user have ensured there is enough space in
     peripheral to write. */
     for (i = 0; i < length; i++)
     {
-        data[i] = (uint16_t)(base->DATA & 0x03FFU);
+        buffer[i] = (uint16_t)(base->DATA & 0x03FFU);
+    }
+}
+
+/* Selects the RX FIFO read of the data width, is16bitData may be set by the user after the handle creation. */
+static void LPUART_TransferSetRxRead(lpuart_handle_t *handle)
+{
+    handle->rxRead = LPUART_ReadNonBlocking;
+#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
+    if (handle->isSevenDataBits)
+    {
+        handle->rxRead = LPUART_ReadNonBlocking7bit;
+    }
+#endif
+    if (handle->is16bitData)
+    {
+        handle->rxRead = LPUART_ReadNonBlocking16bit;
+    }
+}
+
+static void LPUART_TransferReadRxRingBuffer(LPUART_Type *base, lpuart_handle_t *handle, size_t length)
+{
+    size_t size = handle->rxRingBufferSize;
+    size_t head = handle->rxRingBufferHead;
+    size_t tail = handle->rxRingBufferTail;
+    size_t space;
+    size_t index;
+    size_t first;
+
+    /* If RX ring buffer has no room for all the data, trigger callback to notify over run. */
+    space = ((tail > head) ? 0U : size) + tail - head - 1U;
+    if (length > space)
+    {
+        if (NULL != handle->callback)
+        {
+            handle->callback(base, handle, kStatus_LPUART_RxRingBufferOverrun, handle->userData);
+        }
+
+        /* If there is still no room after callback function, the oldest data is overridden. */
+        space = size - 1U - LPUART_TransferGetRxRingBufferLength(base, handle);
+        if (length > space)
+        {
+            index                    = (size_t)handle->rxRingBufferTail + length - space;
+            handle->rxRingBufferTail = (uint16_t)((index >= size) ? (index - size) : index);
+        }
+    }
+
+    /* Read the data up to the end of the ring buffer, then the rest from its start. */
+    first = MIN(length, size - head);
+    handle->rxRead(base, handle->rxRingBuffer, head, first);
+    if (first != length)
+    {
+        handle->rxRead(base, handle->rxRingBuffer, 0U, length - first);
     }
+
+    /* Wrap to 0. Not use modulo (%) because it might be large and slow. */
+    index                    = head + length;
+    handle->rxRingBufferHead = (uint16_t)((index >= size) ? (index - size) : index);
 }
 
 /*!
@@ -1489,6 +1553,7 @@ void LPUART_TransferCreateHandle(LPUART_Type *base,
     handle->isSevenDataBits = isSevenDataBits;
 #endif
     handle->is16bitData = false;
+    LPUART_TransferSetRxRead(handle);
 
     /* Get instance from peripheral base address. */
     instance = LPUART_GetInstance(base);
@@ -1548,8 +1613,11 @@ void LPUART_TransferStartRingBuffer(LPUART_Type *base,
     {
         handle->rxRingBufferSize = ringBufferSize / 2U;
     }
+    /* One data of the ring buffer is reserved to tell it full from empty. */
+    assert(handle->rxRingBufferSize > 1U);
     handle->rxRingBufferHead = 0U;
     handle->rxRingBufferTail = 0U;
+    LPUART_TransferSetRxRead(handle);
 
     /* Disable and re-enable the global interrupt to protect the interrupt enable register during read-modify-wrte. */
     uint32_t irqMask = DisableGlobalIRQ();
@@ -1775,6 +1843,7 @@ status_t LPUART_TransferReceiveNonBlocking(LPUART_Type *base,
     {
         bytesToReceive       = xfer->dataSize;
         bytesCurrentReceived = 0;
+        LPUART_TransferSetRxRead(handle);
 
         /* If RX ring buffer is used. */
         if (NULL != handle->rxRingBuffer)
@@ -1961,14 +2030,13 @@ static void LPUART_TransferHandleIDLEReady(LPUART_Type *base, lpuart_handle_t *h
     {
         tempCount = (uint8_t)MIN(handle->rxDataSize, count);
         /* Using non block API to read the data from the registers. */
+        handle->rxRead(base, handle->rxData, 0U, tempCount);
         if (!handle->is16bitData)
         {
-            LPUART_ReadNonBlocking(base, handle->rxData, tempCount);
             handle->rxData = &handle->rxData[tempCount];
         }
         else
         {
-            LPUART_ReadNonBlocking16bit(base, handle->rxData16, tempCount);
             handle->rxData16 = &handle->rxData16[tempCount];
         }
         handle->rxDataSize -= tempCount;
@@ -2013,8 +2081,6 @@ static void LPUART_TransferHandleReceiveDataFull(LPUART_Type *base, lpuart_handl
 {
     uint8_t count;
     uint8_t tempCount;
-    uint16_t tpmRxRingBufferHead;
-    uint32_t tpmData;
     uint32_t irqMask;
 
     /* Get the size that can be stored into buffer for this interrupt. */
@@ -2034,14 +2100,13 @@ static void LPUART_TransferHandleReceiveDataFull(LPUART_Type *base, lpuart_handl
 #endif
 
         /* Using non block API to read the data from the registers. */
+        handle->rxRead(base, handle->rxData, 0U, tempCount);
         if (!handle->is16bitData)
         {
-            LPUART_ReadNonBlocking(base, handle->rxData, tempCount);
             handle->rxData = &handle->rxData[tempCount];
         }
         else
         {
-            LPUART_ReadNonBlocking16bit(base, handle->rxData16, tempCount);
             handle->rxData16 = &handle->rxData16[tempCount];
         }
         handle->rxDataSize -= tempCount;
@@ -2059,74 +2124,15 @@ static void LPUART_TransferHandleReceiveDataFull(LPUART_Type *base, lpuart_handl
         }
     }
 
-    /* If use RX ring buffer, receive data to ring buffer. */
+    /* If use RX ring buffer, receive the rest of the FIFO to ring buffer. */
     if (NULL != handle->rxRingBuffer)
     {
         while (0U != count)
         {
-            count--;
-            /* If RX ring buffer is full, trigger callback to notify over run. */
-            if (LPUART_TransferIsRxRingBufferFull(base, handle))
-            {
-                if (NULL != handle->callback)
-                {
-                    handle->callback(base, handle, kStatus_LPUART_RxRingBufferOverrun, handle->userData);
-                }
-            }
-
-            /* If ring buffer is still full after callback function, the oldest data is overridden. */
-            if (LPUART_TransferIsRxRingBufferFull(base, handle))
-            {
-                /* Increase handle->rxRingBufferTail to make room for new data. */
-                if (((uint32_t)handle->rxRingBufferTail + 1U) == handle->rxRingBufferSize)
-                {
-                    handle->rxRingBufferTail = 0U;
-                }
-                else
-                {
-                    handle->rxRingBufferTail++;
-                }
-            }
-
-            /* Read data. */
-            tpmRxRingBufferHead = handle->rxRingBufferHead;
-            tpmData             = base->DATA;
-#if defined(FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT) && FSL_FEATURE_LPUART_HAS_7BIT_DATA_SUPPORT
-            if (handle->isSevenDataBits)
-            {
-                handle->rxRingBuffer[tpmRxRingBufferHead] = (uint8_t)(tpmData & 0x7FU);
-            }
-            else
-            {
-                if (!handle->is16bitData)
-                {
-                    handle->rxRingBuffer[tpmRxRingBufferHead] = (uint8_t)tpmData;
-                }
-                else
-                {
-                    handle->rxRingBuffer16[tpmRxRingBufferHead] = (uint16_t)(tpmData & 0x3FFU);
-                }
-            }
-#else
-            if (!handle->is16bitData)
-            {
-                handle->rxRingBuffer[tpmRxRingBufferHead] = (uint8_t)tpmData;
-            }
-            else
-            {
-                handle->rxRingBuffer16[tpmRxRingBufferHead] = (uint16_t)(tpmData & 0x3FFU);
-            }
-#endif
-
-            /* Increase handle->rxRingBufferHead. */
-            if (((uint32_t)handle->rxRingBufferHead + 1U) == handle->rxRingBufferSize)
-            {
-                handle->rxRingBufferHead = 0U;
-            }
-            else
-            {
-                handle->rxRingBufferHead++;
-            }
+            /* Only a ring buffer smaller than the FIFO takes more than one part. */
+            tempCount = (uint8_t)MIN(count, handle->rxRingBufferSize - 1U);
+            LPUART_TransferReadRxRingBuffer(base, handle, tempCount);
+            count -= tempCount;
         }
     }
     /* If no receive requst pending, stop RX interrupt. */
@@ -0,0 +1,558 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "edma_benchmark.h"
+#include "edma_memcpy.h"
+#include "fsl_debug_console.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Channels n and n + 16 share one interrupt vector. */
+#define EDMA_BENCHMARK_IRQ(channel) ((IRQn_Type)((uint32_t)DMA0_DMA16_IRQn + ((channel) & 0xFU)))
+
+/* Ways of queueing the descriptors of one run. */
+typedef enum _edma_benchmark_mode
+{
+    kEDMA_BenchmarkIrqMasking = 0U, /* EDMA_SubmitTransfer per descriptor, default queue. */
+    kEDMA_BenchmarkLockFree,        /* EDMA_SubmitTransfer per descriptor, lock-free queue. */
+    kEDMA_BenchmarkBatch,           /* One EDMA_SubmitTransferBatch call, default queue. */
+    kEDMA_BenchmarkTemplate,        /* EDMA_SubmitTcdTemplate per descriptor, default queue. */
+} edma_benchmark_mode_t;
+
+/* 2-D cases of EDMA_Benchmark2D. */
+typedef enum _edma_benchmark_2d_case
+{
+    kEDMA_Benchmark2DDeinterleave = 0U, /* Interleaved 16-bit samples to one block per channel. */
+    kEDMA_Benchmark2DColumn,            /* One column of the matrix to a vector. */
+    kEDMA_Benchmark2DTranspose,         /* Matrix transpose, one TCD per band of rows. */
+} edma_benchmark_2d_case_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void EDMA_BenchmarkCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_handle_t s_benchHandle;
+static edma_transfer_config_t s_benchConfigs[EDMA_BENCHMARK_MAX_DEPTH];
+static const char *const s_benchModeName[] = {"IRQ masking", "Lock-free", "Batch", "TCD template"};
+static const edma_tcd_t s_benchTcdTemplate    = EDMA_TCD_TEMPLATE_INIT(
+    kEDMA_TransferSize4Bytes, sizeof(uint32_t), kEDMA_TransferSize4Bytes, sizeof(uint32_t), sizeof(uint32_t));
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t s_benchTcdPool[EDMA_BENCHMARK_MAX_DEPTH], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint32_t s_benchSrc[EDMA_BENCHMARK_MAX_DEPTH], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint32_t s_benchDest[EDMA_BENCHMARK_MAX_DEPTH], 32);
+
+static volatile uint32_t s_benchTcdsDone;
+static volatile uint32_t s_benchDoneTimestamp;
+static volatile uint32_t s_benchIrqLatency;
+static uint32_t s_benchSubmitCycles;
+
+SDK_ALIGN(static uint8_t s_memcpySrc[EDMA_BENCHMARK_MEMCPY_MAX_SIZE], 32U);
+SDK_ALIGN(static uint8_t s_memcpyDest[EDMA_BENCHMARK_MEMCPY_MAX_SIZE], 32U);
+static volatile bool s_memcpyDone;
+
+static const char *const s_bench2DCaseName[] = {"De-interleave", "Column", "Transpose"};
+static const uint32_t s_bench2DCaseBytes[]    = {EDMA_BENCHMARK_2D_CHANNELS * EDMA_BENCHMARK_2D_FRAMES * sizeof(uint16_t),
+                                                 EDMA_BENCHMARK_2D_SIDE * sizeof(uint32_t),
+                                                 EDMA_BENCHMARK_2D_SIDE * EDMA_BENCHMARK_2D_SIDE * sizeof(uint32_t)};
+AT_NONCACHEABLE_SECTION_ALIGN(static uint32_t s_bench2DSrc[EDMA_BENCHMARK_2D_SIDE * EDMA_BENCHMARK_2D_SIDE], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint32_t s_bench2DDest[EDMA_BENCHMARK_2D_SIDE * EDMA_BENCHMARK_2D_SIDE], 32);
+static uint32_t s_bench2DRef[EDMA_BENCHMARK_2D_SIDE * EDMA_BENCHMARK_2D_SIDE];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void EDMA_BenchmarkCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    s_benchTcdsDone += tcds;
+    s_benchDoneTimestamp = MSDK_GetCpuCycleCount();
+}
+
+static void EDMA_BenchmarkMemcpyCallback(status_t status, void *userData)
+{
+    s_memcpyDone = true;
+}
+
+/* Latency probe: the elapsed count since the SysTick reload is the delay until the handler was entered. */
+void SysTick_Handler(void)
+{
+    uint32_t latency = SysTick->LOAD - SysTick->VAL;
+
+    if (latency > s_benchIrqLatency)
+    {
+        s_benchIrqLatency = latency;
+    }
+}
+
+/* Runs one batch of depth descriptors, returns the elapsed cycles or 0 on timeout. */
+/* The cycles spent until the last descriptor is queued are saved in s_benchSubmitCycles. */
+static uint32_t EDMA_BenchmarkRun(uint32_t depth, edma_benchmark_mode_t mode)
+{
+    uint32_t start;
+    uint32_t i;
+
+    EDMA_AbortTransfer(&s_benchHandle);
+    EDMA_InstallTCDMemory(&s_benchHandle, s_benchTcdPool, EDMA_BENCHMARK_MAX_DEPTH);
+    EDMA_EnableLockFreeQueue(&s_benchHandle, mode == kEDMA_BenchmarkLockFree);
+
+    s_benchTcdsDone      = 0U;
+    s_benchDoneTimestamp = 0U;
+
+    start = MSDK_GetCpuCycleCount();
+    for (i = 0U; i < depth; i++)
+    {
+        if (mode == kEDMA_BenchmarkTemplate)
+        {
+            /* No transfer configuration, only the addresses and the count of the template are patched. */
+            (void)EDMA_SubmitTcdTemplate(&s_benchHandle, &s_benchTcdTemplate, (uint32_t)&s_benchSrc[i],
+                                         (uint32_t)&s_benchDest[i], 1U);
+        }
+        else
+        {
+            EDMA_PrepareTransfer(&s_benchConfigs[i], &s_benchSrc[i], sizeof(s_benchSrc[0]), &s_benchDest[i],
+                                 sizeof(s_benchDest[0]), sizeof(s_benchSrc[0]), sizeof(s_benchSrc[0]),
+                                 kEDMA_MemoryToMemory);
+            if (mode != kEDMA_BenchmarkBatch)
+            {
+                (void)EDMA_SubmitTransfer(&s_benchHandle, &s_benchConfigs[i]);
+            }
+        }
+        if ((i == 0U) && (mode != kEDMA_BenchmarkBatch))
+        {
+            EDMA_StartTransfer(&s_benchHandle);
+        }
+    }
+    if (mode == kEDMA_BenchmarkBatch)
+    {
+        (void)EDMA_SubmitTransferBatch(&s_benchHandle, s_benchConfigs, depth);
+        EDMA_StartTransfer(&s_benchHandle);
+    }
+    s_benchSubmitCycles = MSDK_GetCpuCycleCount() - start;
+
+    while (s_benchTcdsDone < depth)
+    {
+        if ((MSDK_GetCpuCycleCount() - start) > EDMA_BENCHMARK_TIMEOUT_CYCLES)
+        {
+            return 0U;
+        }
+    }
+
+    return s_benchDoneTimestamp - start;
+}
+
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+/* Prints the driver statistics gathered by the handle during one sweep. */
+static void EDMA_BenchmarkPrintStatistics(void)
+{
+    edma_statistics_t statistics;
+    uint32_t i;
+
+    EDMA_GetStatistics(&s_benchHandle, &statistics);
+    if (statistics.isrCount == 0U)
+    {
+        return;
+    }
+
+    PRINTF("driver: %u IRQs, %u TCDs, %u bytes, avg %u max %u IRQ cycles, max %u to callback, "
+           "max %u TCDs/IRQ, max depth %u\r\n",
+           statistics.isrCount, statistics.tcdsDone, (uint32_t)statistics.bytesMoved,
+           (uint32_t)(statistics.isrTotalCycles / statistics.isrCount), statistics.isrMaxCycles,
+           statistics.callbackMaxLatency, statistics.maxTcdsPerIsr, statistics.maxQueueDepth);
+    PRINTF("IRQ cycles log2 histogram:");
+    for (i = 0U; i < EDMA_STATISTICS_HISTOGRAM_SIZE; i++)
+    {
+        PRINTF(" %u", statistics.isrHistogram[i]);
+    }
+    PRINTF("\r\n");
+}
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
+/* Sweeps the queue depth in one queue mode, returns false on timeout. */
+static bool EDMA_BenchmarkSweep(edma_benchmark_mode_t mode, uint32_t cyclesPerUs)
+{
+    uint32_t depth;
+    uint32_t run;
+    uint32_t cycles;
+    uint32_t total;
+    uint32_t worst;
+    uint32_t submit;
+
+    PRINTF("\r\n%s queue\r\n", s_benchModeName[mode]);
+    PRINTF("depth\tcycles\tworst\tcyc/TCD\tns/TCD\tsub/TCD\tirq lat\r\n");
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    EDMA_ResetStatistics(&s_benchHandle);
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
+    for (depth = 1U; depth <= EDMA_BENCHMARK_MAX_DEPTH; depth++)
+    {
+        total             = 0U;
+        worst             = 0U;
+        submit            = 0U;
+        s_benchIrqLatency = 0U;
+        for (run = 0U; run < EDMA_BENCHMARK_ITERATIONS; run++)
+        {
+            cycles = EDMA_BenchmarkRun(depth, mode);
+            if (cycles == 0U)
+            {
+                PRINTF("%u\ttimeout after %u of %u TCDs\r\n", depth, s_benchTcdsDone, depth);
+                return false;
+            }
+            total += cycles;
+            submit += s_benchSubmitCycles;
+            worst = (cycles > worst) ? cycles : worst;
+        }
+        cycles = total / EDMA_BENCHMARK_ITERATIONS;
+        PRINTF("%u\t%u\t%u\t%u\t%u\t%u\t%u\r\n", depth, cycles, worst, cycles / depth,
+               ((cycles / depth) * 1000U) / cyclesPerUs, submit / EDMA_BENCHMARK_ITERATIONS / depth,
+               s_benchIrqLatency);
+    }
+#if defined(FSL_EDMA_ENABLE_STATISTICS) && FSL_EDMA_ENABLE_STATISTICS
+    EDMA_BenchmarkPrintStatistics();
+#endif /* FSL_EDMA_ENABLE_STATISTICS */
+
+    return true;
+}
+
+/*!
+ * brief Measures the submit-to-callback cost of the eDMA TCD queue.
+ *
+ * param base eDMA peripheral base address.
+ * param channel eDMA channel number. The channel must be routed to an always-on DMAMUX source.
+ */
+void EDMA_BenchmarkSubmitToCallback(DMA_Type *base, uint32_t channel)
+{
+    uint32_t cyclesPerUs = SystemCoreClock / 1000000U;
+    uint32_t mode;
+    uint32_t i;
+
+    for (i = 0U; i < EDMA_BENCHMARK_MAX_DEPTH; i++)
+    {
+        s_benchSrc[i] = i;
+    }
+
+    MSDK_EnableCpuCycleCounter();
+    EDMA_CreateHandle(&s_benchHandle, base, channel);
+    EDMA_SetCallback(&s_benchHandle, EDMA_BenchmarkCallback, NULL);
+
+    /* The probe preempts the eDMA handler, so only interrupt masking delays it. */
+    (void)SysTick_Config(EDMA_BENCHMARK_PROBE_PERIOD);
+    NVIC_SetPriority(SysTick_IRQn, 0U);
+    NVIC_SetPriority(EDMA_BENCHMARK_IRQ(channel), 1U);
+
+    PRINTF("\r\nEDMA submit-to-callback benchmark, %u runs per depth, core %u MHz\r\n", EDMA_BENCHMARK_ITERATIONS,
+           cyclesPerUs);
+    PRINTF("sub/TCD: cycles to queue one TCD, irq lat: worst SysTick entry latency in cycles\r\n");
+
+    for (mode = (uint32_t)kEDMA_BenchmarkIrqMasking; mode <= (uint32_t)kEDMA_BenchmarkTemplate; mode++)
+    {
+        if (!EDMA_BenchmarkSweep((edma_benchmark_mode_t)mode, cyclesPerUs))
+        {
+            break;
+        }
+    }
+
+    SysTick->CTRL = 0U;
+    EDMA_AbortTransfer(&s_benchHandle);
+}
+
+/* Average cycles of one copy of size bytes, with the CPU when useDma is false. */
+static uint32_t EDMA_BenchmarkMemcpyRun(uint32_t size, bool useDma)
+{
+    uint32_t start;
+    uint32_t total = 0U;
+    uint32_t run;
+
+    for (run = 0U; run < EDMA_BENCHMARK_ITERATIONS; run++)
+    {
+        s_memcpyDone = false;
+        start        = MSDK_GetCpuCycleCount();
+        if (useDma)
+        {
+            (void)EDMA_MemcpyAsync(s_memcpyDest, s_memcpySrc, size, EDMA_BenchmarkMemcpyCallback, NULL);
+            while (!s_memcpyDone)
+            {
+            }
+        }
+        else
+        {
+            (void)memcpy(s_memcpyDest, s_memcpySrc, size);
+        }
+        total += MSDK_GetCpuCycleCount() - start;
+    }
+
+    return total / EDMA_BENCHMARK_ITERATIONS;
+}
+
+/*!
+ * brief Measures the throughput of the eDMA memcpy service.
+ *
+ * param base eDMA peripheral base address.
+ */
+void EDMA_BenchmarkMemcpy(DMA_Type *base)
+{
+    edma_memcpy_config_t config;
+    uint32_t cyclesPerUs = SystemCoreClock / 1000000U;
+    uint32_t crossover   = 0U;
+    uint32_t cpu;
+    uint32_t single;
+    uint32_t striped;
+    uint32_t size;
+    uint32_t i;
+
+    for (i = 0U; i < EDMA_BENCHMARK_MEMCPY_MAX_SIZE; i++)
+    {
+        s_memcpySrc[i] = (uint8_t)i;
+    }
+
+    MSDK_EnableCpuCycleCounter();
+    EDMA_MemcpyDeinit();
+    EDMA_MemcpyGetDefaultConfig(&config);
+    config.base         = base;
+    config.cpuThreshold = 0U;
+
+    PRINTF("\r\nEDMA memcpy throughput in MB/s, %u runs per size\r\n", EDMA_BENCHMARK_ITERATIONS);
+    PRINTF("size\tCPU\t1 ch\t%u ch\r\n", EDMA_MEMCPY_MAX_CHANNELS);
+
+    for (size = 16U; size <= EDMA_BENCHMARK_MEMCPY_MAX_SIZE; size <<= 1U)
+    {
+        cpu = EDMA_BenchmarkMemcpyRun(size, false);
+
+        config.channelCount   = 1U;
+        config.stripeMinBytes = EDMA_MEMCPY_STRIPE_MIN_BYTES;
+        if (EDMA_MemcpyInit(&config) != kStatus_Success)
+        {
+            PRINTF("No free eDMA channel for the memcpy service\r\n");
+            return;
+        }
+        single = EDMA_BenchmarkMemcpyRun(size, true);
+        EDMA_MemcpyDeinit();
+
+        config.channelCount   = EDMA_MEMCPY_MAX_CHANNELS;
+        config.stripeMinBytes = EDMA_BENCHMARK_MEMCPY_STRIPE_MIN_BYTES;
+        if (EDMA_MemcpyInit(&config) != kStatus_Success)
+        {
+            PRINTF("Not enough free eDMA channels for the memcpy service\r\n");
+            return;
+        }
+        striped = EDMA_BenchmarkMemcpyRun(size, true);
+        EDMA_MemcpyDeinit();
+
+        if ((crossover == 0U) && (single < cpu))
+        {
+            crossover = size;
+        }
+        /* bytes per us is MB/s */
+        PRINTF("%u\t%u\t%u\t%u\r\n", size, (size * cyclesPerUs) / cpu, (size * cyclesPerUs) / single,
+               (size * cyclesPerUs) / striped);
+    }
+
+    if (memcmp(s_memcpySrc, s_memcpyDest, EDMA_BENCHMARK_MEMCPY_MAX_SIZE) != 0)
+    {
+        PRINTF("Copy mismatch\r\n");
+    }
+    if (crossover != 0U)
+    {
+        PRINTF("One channel beats the CPU from %u bytes\r\n", crossover);
+    }
+    else
+    {
+        PRINTF("The CPU is faster at every size\r\n");
+    }
+
+    EDMA_MemcpyGetDefaultConfig(&config);
+    config.base = base;
+    (void)EDMA_MemcpyInit(&config);
+}
+
+/* Moves one 2-D case with the CPU into s_bench2DRef, or with the eDMA into s_bench2DDest. */
+/* Returns the elapsed cycles, or 0 when the transfer could not be submitted or timed out. */
+static uint32_t EDMA_Benchmark2DRun(edma_benchmark_2d_case_t testCase, bool useDma)
+{
+    edma_2d_transfer_config_t config;
+    const uint16_t *samples = (const uint16_t *)s_bench2DSrc;
+    uint16_t *planar        = (uint16_t *)s_bench2DRef;
+    uint32_t tcds           = 1U;
+    uint32_t start;
+    uint32_t row;
+    uint32_t col;
+    uint32_t band;
+
+    (void)memset(&config, 0, sizeof(config));
+    EDMA_AbortTransfer(&s_benchHandle);
+    EDMA_InstallTCDMemory(&s_benchHandle, s_benchTcdPool, EDMA_BENCHMARK_MAX_DEPTH);
+    s_benchTcdsDone = 0U;
+
+    start = MSDK_GetCpuCycleCount();
+    switch (testCase)
+    {
+        case kEDMA_Benchmark2DDeinterleave:
+            if (!useDma)
+            {
+                for (row = 0U; row < EDMA_BENCHMARK_2D_CHANNELS; row++)
+                {
+                    for (col = 0U; col < EDMA_BENCHMARK_2D_FRAMES; col++)
+                    {
+                        planar[(row * EDMA_BENCHMARK_2D_FRAMES) + col] =
+                            samples[(col * EDMA_BENCHMARK_2D_CHANNELS) + row];
+                    }
+                }
+                break;
+            }
+            /* One row per channel: every channel-th sample in, one contiguous block out. */
+            config.srcAddr           = (uint32_t)s_bench2DSrc;
+            config.destAddr          = (uint32_t)s_bench2DDest;
+            config.elementSize       = sizeof(uint16_t);
+            config.columns           = EDMA_BENCHMARK_2D_FRAMES;
+            config.rows              = EDMA_BENCHMARK_2D_CHANNELS;
+            config.srcElementStride  = (int16_t)(EDMA_BENCHMARK_2D_CHANNELS * sizeof(uint16_t));
+            config.destElementStride = (int16_t)sizeof(uint16_t);
+            config.srcRowStride      = (int32_t)sizeof(uint16_t);
+            config.destRowStride     = (int32_t)(EDMA_BENCHMARK_2D_FRAMES * sizeof(uint16_t));
+            if (kStatus_Success != EDMA_Submit2DTransfer(&s_benchHandle, &config))
+            {
+                return 0U;
+            }
+            break;
+
+        case kEDMA_Benchmark2DColumn:
+            if (!useDma)
+            {
+                for (row = 0U; row < EDMA_BENCHMARK_2D_SIDE; row++)
+                {
+                    s_bench2DRef[row] = s_bench2DSrc[(row * EDMA_BENCHMARK_2D_SIDE) + 1U];
+                }
+                break;
+            }
+            /* A single row, the element stride walks down column 1. */
+            config.srcAddr           = (uint32_t)&s_bench2DSrc[1];
+            config.destAddr          = (uint32_t)s_bench2DDest;
+            config.elementSize       = sizeof(uint32_t);
+            config.columns           = EDMA_BENCHMARK_2D_SIDE;
+            config.rows              = 1U;
+            config.srcElementStride  = (int16_t)(EDMA_BENCHMARK_2D_SIDE * sizeof(uint32_t));
+            config.destElementStride = (int16_t)sizeof(uint32_t);
+            if (kStatus_Success != EDMA_Submit2DTransfer(&s_benchHandle, &config))
+            {
+                return 0U;
+            }
+            break;
+
+        case kEDMA_Benchmark2DTranspose:
+            if (!useDma)
+            {
+                for (row = 0U; row < EDMA_BENCHMARK_2D_SIDE; row++)
+                {
+                    for (col = 0U; col < EDMA_BENCHMARK_2D_SIDE; col++)
+                    {
+                        s_bench2DRef[(col * EDMA_BENCHMARK_2D_SIDE) + row] =
+                            s_bench2DSrc[(row * EDMA_BENCHMARK_2D_SIDE) + col];
+                    }
+                }
+                break;
+            }
+            /* Source rows are read in order and written as destination columns. */
+            tcds                     = EDMA_BENCHMARK_2D_SIDE / EDMA_BENCHMARK_2D_BAND;
+            config.elementSize       = sizeof(uint32_t);
+            config.columns           = EDMA_BENCHMARK_2D_SIDE;
+            config.rows              = EDMA_BENCHMARK_2D_BAND;
+            config.srcElementStride  = (int16_t)sizeof(uint32_t);
+            config.destElementStride = (int16_t)(EDMA_BENCHMARK_2D_SIDE * sizeof(uint32_t));
+            config.srcRowStride      = (int32_t)(EDMA_BENCHMARK_2D_SIDE * sizeof(uint32_t));
+            config.destRowStride     = (int32_t)sizeof(uint32_t);
+            for (band = 0U; band < tcds; band++)
+            {
+                config.srcAddr  = (uint32_t)&s_bench2DSrc[band * EDMA_BENCHMARK_2D_BAND * EDMA_BENCHMARK_2D_SIDE];
+                config.destAddr = (uint32_t)&s_bench2DDest[band * EDMA_BENCHMARK_2D_BAND];
+                if (kStatus_Success != EDMA_Submit2DTransfer(&s_benchHandle, &config))
+                {
+                    return 0U;
+                }
+                if (band == 0U)
+                {
+                    EDMA_StartTransfer(&s_benchHandle);
+                }
+            }
+            break;
+
+        default:
+            assert(false);
+            break;
+    }
+    if (!useDma)
+    {
+        return MSDK_GetCpuCycleCount() - start;
+    }
+    EDMA_StartTransfer(&s_benchHandle);
+
+    while (s_benchTcdsDone < tcds)
+    {
+        if ((MSDK_GetCpuCycleCount() - start) > EDMA_BENCHMARK_TIMEOUT_CYCLES)
+        {
+            return 0U;
+        }
+    }
+
+    return s_benchDoneTimestamp - start;
+}
+
+/*!
+ * brief Checks and measures the 2-D strided transfers against CPU loops.
+ *
+ * param base eDMA peripheral base address.
+ * param channel eDMA channel number. The channel must be routed to an always-on DMAMUX source.
+ */
+void EDMA_Benchmark2D(DMA_Type *base, uint32_t channel)
+{
+    uint32_t testCase;
+    uint32_t run;
+    uint32_t cycles;
+    uint32_t cpu;
+    uint32_t dma;
+    uint32_t size;
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(s_bench2DSrc); i++)
+    {
+        s_bench2DSrc[i] = (i << 16U) | (i ^ 0x5AU);
+    }
+
+    MSDK_EnableCpuCycleCounter();
+    EDMA_CreateHandle(&s_benchHandle, base, channel);
+    EDMA_SetCallback(&s_benchHandle, EDMA_BenchmarkCallback, NULL);
+
+    PRINTF("\r\nEDMA 2-D transfers against CPU loops, %u runs per case\r\n", EDMA_BENCHMARK_ITERATIONS);
+    PRINTF("bytes\tCPU\teDMA\tresult\tcase\r\n");
+
+    for (testCase = (uint32_t)kEDMA_Benchmark2DDeinterleave; testCase <= (uint32_t)kEDMA_Benchmark2DTranspose;
+         testCase++)
+    {
+        size = s_bench2DCaseBytes[testCase];
+        cpu = 0U;
+        dma = 0U;
+        for (run = 0U; run < EDMA_BENCHMARK_ITERATIONS; run++)
+        {
+            cpu += EDMA_Benchmark2DRun((edma_benchmark_2d_case_t)testCase, false);
+            (void)memset(s_bench2DDest, 0, sizeof(s_bench2DDest));
+            cycles = EDMA_Benchmark2DRun((edma_benchmark_2d_case_t)testCase, true);
+            if (cycles == 0U)
+            {
+                PRINTF("%u\tfailed after %u TCDs\t%s\r\n", size, s_benchTcdsDone, s_bench2DCaseName[testCase]);
+                EDMA_AbortTransfer(&s_benchHandle);
+                return;
+            }
+            dma += cycles;
+        }
+        PRINTF("%u\t%u\t%u\t%s\t%s\r\n", size, cpu / EDMA_BENCHMARK_ITERATIONS, dma / EDMA_BENCHMARK_ITERATIONS,
+               (memcmp(s_bench2DDest, s_bench2DRef, size) == 0) ? "OK" : "mismatch", s_bench2DCaseName[testCase]);
+    }
+
+    EDMA_AbortTransfer(&s_benchHandle);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EDMA_BENCHMARK_H_
+#define _EDMA_BENCHMARK_H_
+
+#include "fsl_edma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Deepest TCD queue measured, also the size of the benchmark TCD pool. */
+#define EDMA_BENCHMARK_MAX_DEPTH 32U
+/*! @brief Number of runs averaged for every queue depth. */
+#define EDMA_BENCHMARK_ITERATIONS 16U
+/*! @brief Busy-wait budget (in CPU cycles) before a run is reported as timed out. */
+#define EDMA_BENCHMARK_TIMEOUT_CYCLES 6000000U
+/*! @brief SysTick period (in CPU cycles) of the interrupt latency probe, kept off multiples of the run time. */
+#define EDMA_BENCHMARK_PROBE_PERIOD 997U
+/*! @brief Largest copy measured by EDMA_BenchmarkMemcpy, the smallest one is 16 bytes. */
+#define EDMA_BENCHMARK_MEMCPY_MAX_SIZE (32U * 1024U)
+/*! @brief Minimum stripe size used for the multi-channel column of EDMA_BenchmarkMemcpy. */
+#define EDMA_BENCHMARK_MEMCPY_STRIPE_MIN_BYTES 256U
+/*! @brief Channels and frames of the 16-bit samples de-interleaved by EDMA_Benchmark2D. */
+#define EDMA_BENCHMARK_2D_CHANNELS 8U
+#define EDMA_BENCHMARK_2D_FRAMES   64U
+/*! @brief Side of the square 32-bit matrix used by the column and transpose cases of EDMA_Benchmark2D. */
+#define EDMA_BENCHMARK_2D_SIDE 32U
+/*! @brief Rows per band of the band by band transpose. */
+#define EDMA_BENCHMARK_2D_BAND 8U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Measures the submit-to-callback cost of the eDMA TCD queue.
+ *
+ * For every queue depth from 1 to EDMA_BENCHMARK_MAX_DEPTH, the function submits that many 4-byte
+ * memory-to-memory descriptors through EDMA_SubmitTransfer, starts the channel and waits until the
+ * callback has reported all of them. The elapsed DWT cycle count is averaged over
+ * EDMA_BENCHMARK_ITERATIONS runs and printed together with the per-descriptor cost in ns.
+ * The sweep runs with the default interrupt masking queue, in the lock-free queue mode, with the
+ * whole chain queued by one EDMA_SubmitTransferBatch call, and with EDMA_SubmitTcdTemplate. The
+ * cycles spent queueing the descriptors, including EDMA_PrepareTransfer where it is used, are
+ * printed per descriptor as well.
+ * A SysTick interrupt with the highest priority fires every EDMA_BENCHMARK_PROBE_PERIOD cycles during
+ * the sweep, and its worst entry latency shows how long the queue kept interrupts masked.
+ *
+ * @note The function takes over SysTick_Handler and lowers the priority of the channel interrupt.
+ *
+ * @param base eDMA peripheral base address.
+ * @param channel eDMA channel number. The channel must be routed to an always-on DMAMUX source.
+ */
+void EDMA_BenchmarkSubmitToCallback(DMA_Type *base, uint32_t channel);
+
+/*!
+ * @brief Measures the throughput of the eDMA memcpy service.
+ *
+ * For every power of two copy size from 16 bytes to EDMA_BENCHMARK_MEMCPY_MAX_SIZE, the function prints the
+ * throughput in MB/s of the CPU memcpy, of EDMA_MemcpyAsync on one channel and of EDMA_MemcpyAsync striped
+ * across EDMA_MEMCPY_MAX_CHANNELS channels, then the smallest size where one channel beats the CPU. The
+ * buffers are cacheable, so the DMA figures include the cache maintenance.
+ * The channels are allocated through the DMA manager, which must be initialized.
+ *
+ * @param base eDMA peripheral base address.
+ * @note The memcpy service is left initialized with its default configuration.
+ */
+void EDMA_BenchmarkMemcpy(DMA_Type *base);
+
+/*!
+ * @brief Checks and measures the 2-D strided transfers against CPU loops.
+ *
+ * Three cases are moved with EDMA_Submit2DTransfer and with the equivalent CPU loop: de-interleaving
+ * EDMA_BENCHMARK_2D_CHANNELS channels of 16-bit samples, extracting one column of a 32-bit matrix, and
+ * transposing the matrix in bands of EDMA_BENCHMARK_2D_BAND rows queued in the TCD pool. For every case the
+ * function prints the average cycles of both, and whether the eDMA result matches the CPU result.
+ *
+ * @param base eDMA peripheral base address.
+ * @param channel eDMA channel number. The channel must be routed to an always-on DMAMUX source.
+ */
+void EDMA_Benchmark2D(DMA_Type *base, uint32_t channel);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _EDMA_BENCHMARK_H_ */
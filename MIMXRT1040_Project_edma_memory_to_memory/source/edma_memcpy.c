@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include "edma_memcpy.h"
+#include "fsl_cache.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Largest eDMA transfer size, also the stripe alignment so every stripe keeps the address alignment. */
+#define EDMA_MEMCPY_MAX_WIDTH 32U
+
+/* One queued copy. */
+typedef struct _edma_memcpy_request
+{
+    uint8_t *dest;
+    const uint8_t *src;
+    size_t size;
+    edma_memcpy_callback_t callback;
+    void *userData;
+} edma_memcpy_request_t;
+
+/* Service state, the request at head is the one being copied. */
+typedef struct _edma_memcpy_context
+{
+    edma_memcpy_config_t config;
+    edma_handle_t handles[EDMA_MEMCPY_MAX_CHANNELS];
+    edma_memcpy_request_t queue[EDMA_MEMCPY_QUEUE_LENGTH];
+    volatile uint8_t head;
+    volatile uint8_t count;
+    volatile uint8_t pendingStripes;
+} edma_memcpy_context_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void EDMA_MemcpyCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds);
+static void EDMA_MemcpyStart(const edma_memcpy_request_t *request);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_memcpy_context_t s_memcpy;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Widest transfer size allowed by the alignment of both addresses and the size. */
+static uint32_t EDMA_MemcpyWidth(uint32_t dest, uint32_t src, size_t size)
+{
+    uint32_t align = dest | src;
+    uint32_t width = EDMA_MEMCPY_MAX_WIDTH;
+
+    while ((width > 1U) && (((align & (width - 1U)) != 0U) || (width > size)))
+    {
+        width >>= 1U;
+#if !(defined(FSL_FEATURE_EDMA_SUPPORT_16_BYTES_TRANSFER) && FSL_FEATURE_EDMA_SUPPORT_16_BYTES_TRANSFER)
+        if (width == 16U)
+        {
+            width = 8U;
+        }
+#endif
+    }
+
+    return width;
+}
+
+void EDMA_MemcpyGetDefaultConfig(edma_memcpy_config_t *config)
+{
+    assert(config != NULL);
+
+    uint32_t i;
+
+    (void)memset(config, 0, sizeof(*config));
+
+    config->base = DMA0;
+    for (i = 0U; i < EDMA_MEMCPY_MAX_CHANNELS; i++)
+    {
+        config->channels[i] = DMAMGR_DYNAMIC_ALLOCATE;
+    }
+    config->channelCount   = EDMA_MEMCPY_MAX_CHANNELS;
+    config->cpuThreshold   = EDMA_MEMCPY_CPU_THRESHOLD;
+    config->stripeMinBytes = EDMA_MEMCPY_STRIPE_MIN_BYTES;
+}
+
+status_t EDMA_MemcpyInit(const edma_memcpy_config_t *config)
+{
+    assert(config != NULL);
+    assert((config->channelCount != 0U) && (config->channelCount <= EDMA_MEMCPY_MAX_CHANNELS));
+    assert(config->stripeMinBytes != 0U);
+
+    dmamgr_channel_config_t channelConfig;
+    status_t status;
+    uint32_t i;
+
+    (void)memset(&s_memcpy, 0, sizeof(s_memcpy));
+    s_memcpy.config = *config;
+
+    /* Copies are bulk background work: low priority, one interrupt per stripe. */
+    DMAMGR_GetDefaultChannelConfig(&channelConfig);
+    channelConfig.alwaysOn = true;
+    channelConfig.priority = kDMAMGR_PriorityLow;
+
+    for (i = 0U; i < config->channelCount; i++)
+    {
+        channelConfig.channel = config->channels[i];
+        status                = DMAMGR_RequestChannel(&channelConfig, &s_memcpy.config.channels[i]);
+        if (status != kStatus_Success)
+        {
+            while (i > 0U)
+            {
+                i--;
+                (void)DMAMGR_ReleaseChannel(s_memcpy.config.channels[i]);
+            }
+            s_memcpy.config.channelCount = 0U;
+            return status;
+        }
+        EDMA_CreateHandle(&s_memcpy.handles[i], config->base, s_memcpy.config.channels[i]);
+        EDMA_SetCallback(&s_memcpy.handles[i], EDMA_MemcpyCallback, NULL);
+    }
+
+    return kStatus_Success;
+}
+
+void EDMA_MemcpyDeinit(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_memcpy.config.channelCount; i++)
+    {
+        EDMA_AbortTransfer(&s_memcpy.handles[i]);
+        (void)DMAMGR_ReleaseChannel(s_memcpy.config.channels[i]);
+    }
+
+    s_memcpy.config.channelCount = 0U;
+    s_memcpy.count               = 0U;
+    s_memcpy.pendingStripes      = 0U;
+}
+
+/* Splits the request into stripes and starts one channel per stripe. */
+static void EDMA_MemcpyStart(const edma_memcpy_request_t *request)
+{
+    edma_transfer_config_t transferConfig;
+    uint32_t stripes;
+    uint32_t stripe;
+    size_t chunk;
+    size_t offset;
+    size_t length;
+    size_t body[EDMA_MEMCPY_MAX_CHANNELS];
+    uint32_t width[EDMA_MEMCPY_MAX_CHANNELS];
+    uint32_t nbytes[EDMA_MEMCPY_MAX_CHANNELS];
+
+    stripes = (uint32_t)(request->size / s_memcpy.config.stripeMinBytes);
+    stripes = (stripes > s_memcpy.config.channelCount) ? s_memcpy.config.channelCount : stripes;
+    stripes = (stripes == 0U) ? 1U : stripes;
+    chunk   = (request->size / stripes) & ~(size_t)(EDMA_MEMCPY_MAX_WIDTH - 1U);
+
+    /* Copy the tails the transfer size can not cover first, the cache maintenance below then covers them too. */
+    for (stripe = 0U; stripe < stripes; stripe++)
+    {
+        offset        = stripe * chunk;
+        length        = (stripe == (stripes - 1U)) ? (request->size - offset) : chunk;
+        width[stripe] = EDMA_MemcpyWidth((uint32_t)&request->dest[offset], (uint32_t)&request->src[offset], length);
+        /* Grow the minor loop until the major loop count fits CITER. */
+        nbytes[stripe] = width[stripe];
+        while ((length / nbytes[stripe]) > DMA_CITER_ELINKNO_CITER_MASK)
+        {
+            nbytes[stripe] <<= 1U;
+        }
+        body[stripe] = length & ~(size_t)(nbytes[stripe] - 1U);
+        (void)memcpy(&request->dest[offset + body[stripe]], &request->src[offset + body[stripe]],
+                     length - body[stripe]);
+    }
+
+    DCACHE_CleanByRange((uint32_t)request->src, request->size);
+    DCACHE_CleanInvalidateByRange((uint32_t)request->dest, request->size);
+
+    s_memcpy.pendingStripes = (uint8_t)stripes;
+    for (stripe = 0U; stripe < stripes; stripe++)
+    {
+        offset = stripe * chunk;
+        EDMA_PrepareTransfer(&transferConfig, (void *)(uint32_t)&request->src[offset], width[stripe],
+                             &request->dest[offset], width[stripe], nbytes[stripe], body[stripe],
+                             kEDMA_MemoryToMemory);
+        (void)EDMA_SubmitTransfer(&s_memcpy.handles[stripe], &transferConfig);
+        EDMA_StartTransfer(&s_memcpy.handles[stripe]);
+    }
+}
+
+static void EDMA_MemcpyCallback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    edma_memcpy_request_t request;
+    uint32_t primask;
+    bool startNext;
+
+    if (!transferDone)
+    {
+        return;
+    }
+
+    /* The stripe channels may use different interrupt priorities. */
+    primask = DisableGlobalIRQ();
+    s_memcpy.pendingStripes--;
+    if (s_memcpy.pendingStripes != 0U)
+    {
+        EnableGlobalIRQ(primask);
+        return;
+    }
+    request       = s_memcpy.queue[s_memcpy.head];
+    s_memcpy.head = (uint8_t)((s_memcpy.head + 1U) % EDMA_MEMCPY_QUEUE_LENGTH);
+    s_memcpy.count--;
+    startNext = (s_memcpy.count != 0U);
+    EnableGlobalIRQ(primask);
+
+    /* Drop the lines the core may have speculatively fetched while the eDMA was writing. */
+    DCACHE_InvalidateByRange((uint32_t)request.dest, request.size);
+
+    /* A copy queued from the callback finds the service idle and starts itself when startNext is false. */
+    if (request.callback != NULL)
+    {
+        request.callback(kStatus_Success, request.userData);
+    }
+    if (startNext)
+    {
+        EDMA_MemcpyStart(&s_memcpy.queue[s_memcpy.head]);
+    }
+}
+
+status_t EDMA_MemcpyAsync(void *dest, const void *src, size_t size, edma_memcpy_callback_t callback, void *userData)
+{
+    assert((dest != NULL) && (src != NULL));
+
+    edma_memcpy_request_t *request;
+    uint32_t primask;
+    bool start;
+
+    if ((size == 0U) || (size < s_memcpy.config.cpuThreshold))
+    {
+        (void)memcpy(dest, src, size);
+        if (callback != NULL)
+        {
+            callback(kStatus_Success, userData);
+        }
+        return kStatus_Success;
+    }
+
+    primask = DisableGlobalIRQ();
+    if (s_memcpy.count >= EDMA_MEMCPY_QUEUE_LENGTH)
+    {
+        EnableGlobalIRQ(primask);
+        return kStatus_EDMA_QueueFull;
+    }
+    request = &s_memcpy.queue[(s_memcpy.head + s_memcpy.count) % EDMA_MEMCPY_QUEUE_LENGTH];
+    request->dest     = (uint8_t *)dest;
+    request->src      = (const uint8_t *)src;
+    request->size     = size;
+    request->callback = callback;
+    request->userData = userData;
+    s_memcpy.count++;
+    start = (s_memcpy.count == 1U);
+    EnableGlobalIRQ(primask);
+
+    /* Nothing else can start the head request, so the cache maintenance runs with interrupts enabled. */
+    if (start)
+    {
+        EDMA_MemcpyStart(request);
+    }
+
+    return kStatus_Success;
+}
+
+bool EDMA_MemcpyIsBusy(void)
+{
+    return (s_memcpy.count != 0U);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _EDMA_MEMCPY_H_
+#define _EDMA_MEMCPY_H_
+
+#include "fsl_edma.h"
+#include "fsl_dma_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Maximum number of always-on channels a copy is striped across. */
+#define EDMA_MEMCPY_MAX_CHANNELS 4U
+/*! @brief Number of copy requests that can wait for the DMA. */
+#define EDMA_MEMCPY_QUEUE_LENGTH 8U
+/*!
+ * @brief Default size (in bytes) below which the copy is done by the CPU.
+ *
+ * Estimated crossover of CPU memcpy and one eDMA channel. EDMA_BenchmarkMemcpy prints the measured
+ * crossover for the actual memory map and core clock, use it to tune the cpuThreshold configuration.
+ */
+#define EDMA_MEMCPY_CPU_THRESHOLD 512U
+/*! @brief Default minimum number of bytes per channel when a copy is striped. */
+#define EDMA_MEMCPY_STRIPE_MIN_BYTES 4096U
+
+/*! @brief Copy completion callback, called from the eDMA interrupt unless the copy was done by the CPU. */
+typedef void (*edma_memcpy_callback_t)(status_t status, void *userData);
+
+/*! @brief eDMA memcpy service configuration. */
+typedef struct _edma_memcpy_config
+{
+    DMA_Type *base;                              /*!< eDMA peripheral, already initialized by EDMA_Init. */
+    uint32_t channels[EDMA_MEMCPY_MAX_CHANNELS]; /*!< Channels requested, or DMAMGR_DYNAMIC_ALLOCATE. */
+    uint32_t channelCount;                       /*!< Number of entries used in channels. */
+    size_t cpuThreshold;                         /*!< Copies smaller than this are done by the CPU. */
+    size_t stripeMinBytes;                       /*!< A channel is only added when it gets this many bytes. */
+} edma_memcpy_config_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Gets the default memcpy service configuration.
+ *
+ * The default configuration uses EDMA_MEMCPY_MAX_CHANNELS dynamically allocated channels of DMA0,
+ * EDMA_MEMCPY_CPU_THRESHOLD and EDMA_MEMCPY_STRIPE_MIN_BYTES.
+ *
+ * @param config Pointer to the configuration structure.
+ */
+void EDMA_MemcpyGetDefaultConfig(edma_memcpy_config_t *config);
+
+/*!
+ * @brief Initializes the memcpy service.
+ *
+ * Every channel in the configuration is requested from the DMA manager, which must be initialized by
+ * DMAMGR_Init, routed to an always-on DMAMUX source and gets an eDMA handle.
+ *
+ * @param config Pointer to the configuration structure.
+ * @retval kStatus_Success The service is ready.
+ * @retval kStatus_DMAMGR_ChannelOccupied A fixed channel of the configuration is already allocated.
+ * @retval kStatus_DMAMGR_NoFreeChannel Not enough free channels, none is kept.
+ */
+status_t EDMA_MemcpyInit(const edma_memcpy_config_t *config);
+
+/*!
+ * @brief Deinitializes the memcpy service.
+ *
+ * Aborts the running copy, drops the queued requests without calling their callbacks and releases the channels
+ * to the DMA manager.
+ */
+void EDMA_MemcpyDeinit(void);
+
+/*!
+ * @brief Copies memory asynchronously.
+ *
+ * Copies smaller than the CPU threshold are done immediately with memcpy and the callback is called before
+ * this function returns. Larger copies are queued and served in order. Each copy is split across the
+ * configured channels in stripes of at least stripeMinBytes, every stripe is moved with the widest transfer
+ * size (up to 32 bytes) allowed by the alignment of the addresses, and the bytes left over by that size are
+ * copied by the CPU.
+ *
+ * @param dest Destination address.
+ * @param src Source address.
+ * @param size Number of bytes to copy.
+ * @param callback Callback called when the copy is done, can be NULL.
+ * @param userData Parameter passed to the callback.
+ * @retval kStatus_Success The copy is done or queued.
+ * @retval kStatus_EDMA_QueueFull There are already EDMA_MEMCPY_QUEUE_LENGTH copies waiting.
+ * @note The D-cache is cleaned and invalidated over the buffers. A cacheable destination should be aligned to
+ *       and sized in multiples of the 32-byte cache line, otherwise data next to it may be lost.
+ * @note A copy done by the CPU is not ordered against the copies still waiting for the DMA.
+ */
+status_t EDMA_MemcpyAsync(void *dest, const void *src, size_t size, edma_memcpy_callback_t callback, void *userData);
+
+/*!
+ * @brief Checks whether copies are running or queued.
+ *
+ * @retval true At least one copy is running or queued.
+ * @retval false The service is idle.
+ */
+bool EDMA_MemcpyIsBusy(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif /* _EDMA_MEMCPY_H_ */
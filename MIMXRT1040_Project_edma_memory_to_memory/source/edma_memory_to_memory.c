@@ -11,6 +11,8 @@
 #include "fsl_debug_console.h"
 #include "fsl_edma.h"
 #include "fsl_dmamux.h"
+#include "fsl_dma_manager.h"
+#include "edma_benchmark.h"
 
 /*******************************************************************************
  * Definitions
@@ -50,6 +52,8 @@ int main(void)
     uint32_t i = 0;
     edma_transfer_config_t transferConfig;
     edma_config_t userConfig;
+    dmamgr_channel_config_t channelConfig;
+    uint32_t channel;
 
     BOARD_InitHardware();
     /* Print source buffer */
@@ -61,12 +65,6 @@ int main(void)
     }
     /* Configure DMAMUX */
     DMAMUX_Init(EXAMPLE_DMAMUX);
-#if defined(FSL_FEATURE_DMAMUX_HAS_A_ON) && FSL_FEATURE_DMAMUX_HAS_A_ON
-    DMAMUX_EnableAlwaysOn(EXAMPLE_DMAMUX, 0, true);
-#else
-    DMAMUX_SetSource(EXAMPLE_DMAMUX, 0, 63);
-#endif /* FSL_FEATURE_DMAMUX_HAS_A_ON */
-    DMAMUX_EnableChannel(EXAMPLE_DMAMUX, 0);
     /* Configure EDMA one shot transfer */
     /*
      * userConfig.enableRoundRobinArbitration = false;
@@ -76,7 +74,12 @@ int main(void)
      */
     EDMA_GetDefaultConfig(&userConfig);
     EDMA_Init(EXAMPLE_DMA, &userConfig);
-    EDMA_CreateHandle(&g_EDMA_Handle, EXAMPLE_DMA, 0);
+    /* Allocate a channel routed to an always-on DMAMUX source */
+    DMAMGR_Init(EXAMPLE_DMA, EXAMPLE_DMAMUX);
+    DMAMGR_GetDefaultChannelConfig(&channelConfig);
+    channelConfig.alwaysOn = true;
+    (void)DMAMGR_RequestChannel(&channelConfig, &channel);
+    EDMA_CreateHandle(&g_EDMA_Handle, EXAMPLE_DMA, channel);
     EDMA_SetCallback(&g_EDMA_Handle, EDMA_Callback, NULL);
     EDMA_PrepareTransfer(&transferConfig, srcAddr, sizeof(srcAddr[0]), destAddr, sizeof(destAddr[0]),
                          sizeof(srcAddr[0]), sizeof(srcAddr), kEDMA_MemoryToMemory);
@@ -93,6 +96,12 @@ int main(void)
     {
         PRINTF("%d\t", destAddr[i]);
     }
+    /* Measure the TCD queue cost on the same always-on channel. */
+    EDMA_BenchmarkSubmitToCallback(EXAMPLE_DMA, channel);
+    /* Check the 2-D strided transfers against CPU loops on the same channel. */
+    EDMA_Benchmark2D(EXAMPLE_DMA, channel);
+    /* Compare the memcpy service with the CPU on channels allocated next to it. */
+    EDMA_BenchmarkMemcpy(EXAMPLE_DMA);
     while (1)
     {
     }
@@ -0,0 +1,237 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host counterpart of EDMA_BenchmarkSubmitToCallback: the submit-to-callback cost of the eDMA TCD queue for
+ * queue depths 1 to 32, with fsl_edma.c and fsl_dmamux.c running against the DMA0 and DMAMUX register models.
+ * The engine cost is given in model cycles, the CPU cost (submission and interrupt handler) in host ns without
+ * the register traps.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_mmio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_DMA              DMA0
+#define BENCH_DMAMUX           DMAMUX
+#define BENCH_CHANNEL          0U
+#define BENCH_MAX_DEPTH        32U
+#define BENCH_ITERATIONS       16U
+/* Engine cycles after which a run that did not complete is reported as stalled. */
+#define BENCH_TIMEOUT_CYCLES   1000000U
+
+/* Ways of queueing the descriptors of one run, as in the on-board benchmark. */
+typedef enum _bench_mode
+{
+    kBench_IrqMasking = 0U, /* EDMA_SubmitTransfer per descriptor, default queue. */
+    kBench_LockFree,        /* EDMA_SubmitTransfer per descriptor, lock-free queue. */
+    kBench_Batch,           /* One EDMA_SubmitTransferBatch call, default queue. */
+    kBench_Template,        /* EDMA_SubmitTcdTemplate per descriptor, default queue. */
+} bench_mode_t;
+
+/* Cost of one run. */
+typedef struct _bench_result
+{
+    uint32_t cycles;   /* Engine cycles from the first submit to the last callback. */
+    uint32_t irqs;     /* Interrupts taken. */
+    uint64_t submitNs; /* Host ns spent queueing, traps excluded. */
+    uint64_t irqNs;    /* Host ns spent in the interrupt handler, traps excluded. */
+    uint64_t traps;    /* Trapped register accesses of the CPU. */
+} bench_result_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_handle_t s_handle;
+static edma_transfer_config_t s_configs[BENCH_MAX_DEPTH];
+static const char *const s_modeName[] = {"IRQ masking", "Lock-free", "Batch", "TCD template"};
+static const edma_tcd_t s_tcdTemplate = EDMA_TCD_TEMPLATE_INIT(
+    kEDMA_TransferSize4Bytes, sizeof(uint32_t), kEDMA_TransferSize4Bytes, sizeof(uint32_t), sizeof(uint32_t));
+/* The driver passes addresses as uint32_t, the buffers are static to stay below 4 GB. */
+SDK_ALIGN(static edma_tcd_t s_tcdPool[BENCH_MAX_DEPTH], 32U);
+SDK_ALIGN(static uint32_t s_src[BENCH_MAX_DEPTH], 32U);
+SDK_ALIGN(static uint32_t s_dest[BENCH_MAX_DEPTH], 32U);
+
+static volatile uint32_t s_tcdsDone;
+static volatile uint64_t s_doneCycles;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void BENCH_Callback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    (void)handle;
+    (void)param;
+    (void)transferDone;
+    s_tcdsDone += tcds;
+    s_doneCycles = HOST_DmaGetCycles();
+}
+
+static uint64_t BENCH_ExcludeTraps(uint64_t ns, uint64_t traps)
+{
+    uint64_t trapNs = traps * HOST_MmioGetTrapCost();
+
+    return (ns > trapNs) ? (ns - trapNs) : 0U;
+}
+
+/* Runs one batch of depth descriptors, false when the queue stalled or the data is wrong. */
+static bool BENCH_Run(uint32_t depth, bench_mode_t mode, bench_result_t *result)
+{
+    uint64_t startCycles;
+    uint64_t startNs;
+    uint64_t startTraps;
+    uint64_t startIrqs;
+    uint64_t startIrqNs;
+    uint64_t traps;
+    uint32_t i;
+
+    EDMA_AbortTransfer(&s_handle);
+    EDMA_InstallTCDMemory(&s_handle, s_tcdPool, BENCH_MAX_DEPTH);
+    EDMA_EnableLockFreeQueue(&s_handle, mode == kBench_LockFree);
+    (void)memset(s_dest, 0, sizeof(s_dest));
+    s_tcdsDone   = 0U;
+    s_doneCycles = 0U;
+
+    startCycles = HOST_DmaGetCycles();
+    startIrqs   = HOST_CoreGetIRQCount();
+    startIrqNs  = HOST_CoreGetIRQTimeNs();
+    startTraps  = HOST_MmioGetTrapCount();
+    startNs     = HOST_CoreGetTimeNs();
+    for (i = 0U; i < depth; i++)
+    {
+        if (mode == kBench_Template)
+        {
+            (void)EDMA_SubmitTcdTemplate(&s_handle, &s_tcdTemplate, (uint32_t)(uintptr_t)&s_src[i],
+                                         (uint32_t)(uintptr_t)&s_dest[i], 1U);
+        }
+        else
+        {
+            EDMA_PrepareTransfer(&s_configs[i], &s_src[i], sizeof(s_src[0]), &s_dest[i], sizeof(s_dest[0]),
+                                 sizeof(s_src[0]), sizeof(s_src[0]), kEDMA_MemoryToMemory);
+            if (mode != kBench_Batch)
+            {
+                (void)EDMA_SubmitTransfer(&s_handle, &s_configs[i]);
+            }
+        }
+        if ((i == 0U) && (mode != kBench_Batch))
+        {
+            EDMA_StartTransfer(&s_handle);
+        }
+    }
+    if (mode == kBench_Batch)
+    {
+        (void)EDMA_SubmitTransferBatch(&s_handle, s_configs, depth);
+        EDMA_StartTransfer(&s_handle);
+    }
+    traps            = HOST_MmioGetTrapCount() - startTraps;
+    result->submitNs = BENCH_ExcludeTraps(HOST_CoreGetTimeNs() - startNs, traps);
+
+    /* The CPU waits while the engine runs, the callback is taken between two minor loops. */
+    startTraps = HOST_MmioGetTrapCount();
+    while ((s_tcdsDone < depth) && ((HOST_DmaGetCycles() - startCycles) < BENCH_TIMEOUT_CYCLES))
+    {
+        if (HOST_DmaRun(BENCH_TIMEOUT_CYCLES) == 0U)
+        {
+            break;
+        }
+    }
+    result->traps = traps + (HOST_MmioGetTrapCount() - startTraps);
+    result->irqs  = (uint32_t)(HOST_CoreGetIRQCount() - startIrqs);
+    result->irqNs =
+        BENCH_ExcludeTraps(HOST_CoreGetIRQTimeNs() - startIrqNs, HOST_MmioGetTrapCount() - startTraps);
+    result->cycles = (uint32_t)(s_doneCycles - startCycles);
+
+    if (s_tcdsDone != depth)
+    {
+        (void)printf("%u\tstalled after %u of %u TCDs\n", depth, s_tcdsDone, depth);
+        return false;
+    }
+    if ((memcmp(s_dest, s_src, depth * sizeof(s_src[0])) != 0) || (s_handle.tcdUsed != 0))
+    {
+        (void)printf("%u\twrong destination data or %d TCDs left in use\n", depth, (int)s_handle.tcdUsed);
+        return false;
+    }
+
+    return true;
+}
+
+/* Sweeps the queue depth in one queue mode. */
+static bool BENCH_Sweep(bench_mode_t mode, uint32_t iterations)
+{
+    bench_result_t result;
+    uint64_t bestNs;
+    uint32_t depth;
+    uint32_t run;
+
+    (void)printf("\n%s queue\n", s_modeName[mode]);
+    (void)printf("depth\tcycles\tcyc/TCD\tIRQs\tns\tns/TCD\ttraps\n");
+    for (depth = 1U; depth <= BENCH_MAX_DEPTH; depth++)
+    {
+        /* The engine is deterministic, the host time is the least disturbed run. */
+        bestNs = UINT64_MAX;
+        for (run = 0U; run < iterations; run++)
+        {
+            if (!BENCH_Run(depth, mode, &result))
+            {
+                return false;
+            }
+            if ((result.submitNs + result.irqNs) < bestNs)
+            {
+                bestNs = result.submitNs + result.irqNs;
+            }
+        }
+        (void)printf("%u\t%u\t%u\t%u\t%u\t%u\t%u\n", depth, result.cycles, result.cycles / depth, result.irqs,
+                     (uint32_t)bestNs, (uint32_t)(bestNs / depth), (uint32_t)result.traps);
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    edma_config_t config;
+    uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_ITERATIONS;
+    uint32_t mode;
+    uint32_t i;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+
+    for (i = 0U; i < BENCH_MAX_DEPTH; i++)
+    {
+        s_src[i] = 0xC0DE0000U + i;
+    }
+    DMAMUX_Init(BENCH_DMAMUX);
+    DMAMUX_EnableAlwaysOn(BENCH_DMAMUX, BENCH_CHANNEL, true);
+    DMAMUX_EnableChannel(BENCH_DMAMUX, BENCH_CHANNEL);
+    EDMA_GetDefaultConfig(&config);
+    EDMA_Init(BENCH_DMA, &config);
+    EDMA_CreateHandle(&s_handle, BENCH_DMA, BENCH_CHANNEL);
+    EDMA_SetCallback(&s_handle, BENCH_Callback, NULL);
+
+    (void)printf("EDMA submit-to-callback on the DMA0 model, %u runs per depth\n", iterations);
+    (void)printf("cycles: engine cycles to the last callback, ns: best host ns of submit and IRQ, "
+                 "traps excluded at %u ns each\n",
+                 HOST_MmioGetTrapCost());
+    for (mode = (uint32_t)kBench_IrqMasking; mode <= (uint32_t)kBench_Template; mode++)
+    {
+        if (!BENCH_Sweep((bench_mode_t)mode, (iterations != 0U) ? iterations : 1U))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,344 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * CPU cost of the interrupt and the eDMA LPUART transfers per size, on the LPUART, DMA0 and DMAMUX models, to set
+ * RTE_USARTn_DMA_TX_MIN_SIZE and RTE_USARTn_DMA_RX_MIN_SIZE of the CMSIS driver from data. LPUART3 runs both paths
+ * of the transactional drivers for every size: LPUART_TransferSendNonBlocking/ReceiveNonBlocking and
+ * LPUART_SendEDMA/ReceiveEDMA. LPUART2 runs Driver_USART2, built with RTE_Device.h of cmsis_lpuart_edma_transfer,
+ * which must take the interrupt path below the minimum size of the direction and the eDMA path from it, and that
+ * size must be the measured crossover. Every transfer is checked on the line.
+ *
+ * The CPU cost is the trapped register accesses of the transfer start and of every interrupt handler up to the
+ * completion callback, and the interrupts taken. No time is reported: every access costs a host trap of tens of
+ * microseconds, host time would only measure the trap jitter. The receive bytes come one character time apart and
+ * each one is taken by the CPU before the next.
+ *
+ * Usage: lpuart_crossover_bench [runs per size], 16 by default, every run must cost the same.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "fsl_lpuart_cmsis.h"
+#include "fsl_lpuart_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_lpuart.h"
+#include "host_mmio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_ITERATIONS   16U
+#define BENCH_CLOCK_HZ     80000000U
+#define BENCH_BAUDRATE     115200U
+#define BENCH_INSTANCE     3U
+#define BENCH_LPUART       LPUART3
+#define BENCH_TX_CHANNEL   4U
+#define BENCH_RX_CHANNEL   5U
+#define BENCH_CMSIS        2U
+#define BENCH_MAX_SIZE     256U
+#define BENCH_BUDGET       100000U
+/* Character times after which a transfer that did not complete is reported as stalled. */
+#define BENCH_MAX_STEPS    (4U * BENCH_MAX_SIZE)
+
+#define BENCH_CHECK(cond)                                                          \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/* Transfer paths. */
+typedef enum _bench_path
+{
+    kBench_Interrupt = 0U, /* FIFO interrupt handler. */
+    kBench_Edma,           /* eDMA channel. */
+    kBench_Cmsis,          /* Driver_USART2, the path it picks. */
+} bench_path_t;
+
+/* Cost of one transfer. */
+typedef struct _bench_result
+{
+    uint64_t traps; /* Trapped register accesses of the CPU. */
+    uint32_t irqs;  /* Interrupts taken. */
+    bool edma;      /* The transfer ran on the eDMA. */
+} bench_result_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+extern ARM_DRIVER_USART Driver_USART2;
+
+static const uint32_t s_sizes[] = {1U, 2U, 3U, 4U, 6U, 7U, 8U, 12U, 16U, 32U, 64U, 128U, 256U};
+
+static lpuart_handle_t s_irqHandle;
+static lpuart_edma_handle_t s_edmaHandle;
+static edma_handle_t s_txEdmaHandle;
+static edma_handle_t s_rxEdmaHandle;
+/* The driver passes addresses as uint32_t, the buffers are static to stay below 4 GB. */
+SDK_ALIGN(static uint8_t s_txData[BENCH_MAX_SIZE], 32U);
+SDK_ALIGN(static uint8_t s_rxData[BENCH_MAX_SIZE], 32U);
+
+static uint8_t s_line[BENCH_MAX_SIZE];
+static volatile uint32_t s_lineCount;
+static volatile bool s_done;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* Clock and pins of the CMSIS instances, there is no CCM or IOMUXC model. */
+uint32_t LPUART1_GetFreq(void)
+{
+    return BENCH_CLOCK_HZ;
+}
+
+uint32_t LPUART2_GetFreq(void)
+{
+    return BENCH_CLOCK_HZ;
+}
+
+void LPUART1_InitPins(void)
+{
+}
+
+void LPUART1_DeinitPins(void)
+{
+}
+
+void LPUART2_InitPins(void)
+{
+}
+
+void LPUART2_DeinitPins(void)
+{
+}
+
+static void BENCH_Sink(uint32_t instance, uint8_t data, void *userData)
+{
+    (void)instance;
+    (void)userData;
+    BENCH_CHECK(s_lineCount < BENCH_MAX_SIZE);
+    s_line[s_lineCount++] = data;
+}
+
+static void BENCH_IrqCallback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+    s_done = s_done || (kStatus_LPUART_TxIdle == status) || (kStatus_LPUART_RxIdle == status);
+}
+
+static void BENCH_EdmaCallback(LPUART_Type *base, lpuart_edma_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+    s_done = s_done || (kStatus_LPUART_TxIdle == status) || (kStatus_LPUART_RxIdle == status);
+}
+
+/* With the send queue of RTE_USART2_DMA_TX_QUEUE_LEN, TX_COMPLETE ends both send paths. */
+static void BENCH_CmsisEvent(uint32_t event)
+{
+    s_done = s_done || (0U != (event & (ARM_USART_EVENT_TX_COMPLETE | ARM_USART_EVENT_RECEIVE_COMPLETE)));
+}
+
+static void BENCH_RunEngine(void)
+{
+    while (HOST_DmaRun(BENCH_BUDGET) != 0U)
+    {
+    }
+}
+
+/* Starts a transfer, returns true when it runs on the eDMA. */
+static bool BENCH_Start(bench_path_t path, bool send, uint32_t size)
+{
+    lpuart_transfer_t xfer;
+    uint32_t channel;
+
+    xfer.data     = send ? s_txData : s_rxData;
+    xfer.dataSize = size;
+    switch (path)
+    {
+        case kBench_Interrupt:
+            BENCH_CHECK(kStatus_Success == (send ? LPUART_TransferSendNonBlocking(BENCH_LPUART, &s_irqHandle, &xfer) :
+                                                   LPUART_TransferReceiveNonBlocking(BENCH_LPUART, &s_irqHandle,
+                                                                                     &xfer, NULL)));
+            return false;
+        case kBench_Edma:
+            BENCH_CHECK(kStatus_Success == (send ? LPUART_SendEDMA(BENCH_LPUART, &s_edmaHandle, &xfer) :
+                                                   LPUART_ReceiveEDMA(BENCH_LPUART, &s_edmaHandle, &xfer)));
+            return true;
+        default:
+            BENCH_CHECK(ARM_DRIVER_OK == (send ? Driver_USART2.Send(s_txData, size) :
+                                                 Driver_USART2.Receive(s_rxData, size)));
+            /* The engine did not run yet, an eDMA transfer still has its request enabled. */
+            channel = send ? RTE_USART2_DMA_TX_CH : RTE_USART2_DMA_RX_CH;
+            return (0U != (DMA0->ERQ & (1UL << channel)));
+    }
+}
+
+/* Runs one transfer, the line one character time per step, the engine and the interrupts in between. */
+static void BENCH_Run(bench_path_t path, bool send, uint32_t size, bench_result_t *result)
+{
+    uint32_t instance = (path == kBench_Cmsis) ? BENCH_CMSIS : BENCH_INSTANCE;
+    uint32_t steps    = 0U;
+    uint64_t startIrqs;
+    uint64_t startTraps;
+    uint64_t traps;
+    uint32_t i;
+
+    (void)memset(s_rxData, 0, sizeof(s_rxData));
+    s_lineCount = 0U;
+    s_done      = false;
+
+    startIrqs  = HOST_CoreGetIRQCount();
+    startTraps = HOST_MmioGetTrapCount();
+    /* The CMSIS path check reads one register after the start, it is not counted. */
+    result->edma = BENCH_Start(path, send, size);
+    traps        = HOST_MmioGetTrapCount() - startTraps - ((path == kBench_Cmsis) ? 1U : 0U);
+
+    startTraps = HOST_MmioGetTrapCount();
+    for (i = 0U; !s_done; i++)
+    {
+        BENCH_CHECK(++steps < BENCH_MAX_STEPS);
+        BENCH_RunEngine();
+        if (send)
+        {
+            (void)HOST_LpuartRun(instance, 1U);
+        }
+        else if (i < size)
+        {
+            BENCH_CHECK(HOST_LpuartReceive(instance, s_txData[i]));
+        }
+        else
+        {
+        }
+    }
+    traps += HOST_MmioGetTrapCount() - startTraps;
+
+    result->traps = traps;
+    result->irqs  = (uint32_t)(HOST_CoreGetIRQCount() - startIrqs);
+
+    if (send)
+    {
+        BENCH_CHECK((size == s_lineCount) && (0 == memcmp(s_line, s_txData, size)));
+        BENCH_CHECK(0U == HOST_LpuartGetTxPending(instance));
+    }
+    else
+    {
+        BENCH_CHECK(0 == memcmp(s_rxData, s_txData, size));
+    }
+}
+
+/* A few runs of a transfer, the cost does not depend on the run. */
+static void BENCH_Measure(bench_path_t path, bool send, uint32_t size, uint32_t iterations, bench_result_t *first)
+{
+    bench_result_t result;
+    uint32_t run;
+
+    BENCH_Run(path, send, size, first);
+    for (run = 1U; run < iterations; run++)
+    {
+        BENCH_Run(path, send, size, &result);
+        BENCH_CHECK((result.traps == first->traps) && (result.irqs == first->irqs) && (result.edma == first->edma));
+    }
+}
+
+/*
+ * Both paths for every size, the crossover is the first size from which the eDMA path costs the CPU no more register
+ * accesses than the interrupt path. It must be the minimum eDMA size of the direction in RTE_Device.h.
+ */
+static void BENCH_Sweep(bool send, uint32_t iterations)
+{
+    bench_result_t results[3];
+    uint32_t minSize   = send ? RTE_USART2_DMA_TX_MIN_SIZE : RTE_USART2_DMA_RX_MIN_SIZE;
+    uint32_t crossover = 0U;
+    uint32_t size;
+    uint32_t i;
+
+    (void)printf("\n%s\nbytes\tIRQ:traps\ttraps/B\tIRQs\teDMA:traps\ttraps/B\tIRQs\tCMSIS\ttraps\n",
+                 send ? "Send" : "Receive");
+    for (i = 0U; i < ARRAY_SIZE(s_sizes); i++)
+    {
+        size = s_sizes[i];
+        LPUART_TransferCreateHandle(BENCH_LPUART, &s_irqHandle, BENCH_IrqCallback, NULL);
+        BENCH_Measure(kBench_Interrupt, send, size, iterations, &results[kBench_Interrupt]);
+        LPUART_TransferCreateHandleEDMA(BENCH_LPUART, &s_edmaHandle, BENCH_EdmaCallback, NULL, &s_txEdmaHandle,
+                                        &s_rxEdmaHandle);
+        BENCH_Measure(kBench_Edma, send, size, iterations, &results[kBench_Edma]);
+        BENCH_Measure(kBench_Cmsis, send, size, iterations, &results[kBench_Cmsis]);
+
+        /* Driver_USART2 takes the FIFO interrupts below the minimum size of the direction. */
+        BENCH_CHECK(results[kBench_Cmsis].edma == (size >= minSize));
+        if ((0U == crossover) && (results[kBench_Edma].traps <= results[kBench_Interrupt].traps))
+        {
+            crossover = size;
+        }
+
+        (void)printf("%u\t%u\t%.1f\t%u\t%u\t%.1f\t%u\t%s\t%u\n", size, (uint32_t)results[0].traps,
+                     (double)results[0].traps / (double)size, results[0].irqs, (uint32_t)results[1].traps,
+                     (double)results[1].traps / (double)size, results[1].irqs,
+                     results[kBench_Cmsis].edma ? "eDMA" : "IRQ", (uint32_t)results[kBench_Cmsis].traps);
+    }
+    (void)printf("eDMA costs no more register accesses from %u bytes, RTE_USART2_DMA_%s_MIN_SIZE is %u\n", crossover,
+                 send ? "TX" : "RX", minSize);
+    BENCH_CHECK(crossover == minSize);
+}
+
+int main(int argc, char **argv)
+{
+    edma_config_t edmaConfig;
+    lpuart_config_t config;
+    uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : BENCH_ITERATIONS;
+    uint32_t i;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    HOST_LpuartInit();
+    HOST_LpuartSetSink(BENCH_INSTANCE, BENCH_Sink, NULL);
+    HOST_LpuartSetSink(BENCH_CMSIS, BENCH_Sink, NULL);
+    for (i = 0U; i < BENCH_MAX_SIZE; i++)
+    {
+        s_txData[i] = (uint8_t)((i * 13U) + 1U);
+    }
+
+    DMAMUX_Init(DMAMUX);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+
+    DMAMUX_SetSource(DMAMUX, BENCH_TX_CHANNEL, (int32_t)kDmaRequestMuxLPUART3Tx);
+    DMAMUX_EnableChannel(DMAMUX, BENCH_TX_CHANNEL);
+    DMAMUX_SetSource(DMAMUX, BENCH_RX_CHANNEL, (int32_t)kDmaRequestMuxLPUART3Rx);
+    DMAMUX_EnableChannel(DMAMUX, BENCH_RX_CHANNEL);
+    EDMA_CreateHandle(&s_txEdmaHandle, DMA0, BENCH_TX_CHANNEL);
+    EDMA_CreateHandle(&s_rxEdmaHandle, DMA0, BENCH_RX_CHANNEL);
+    LPUART_GetDefaultConfig(&config);
+    config.baudRate_Bps = BENCH_BAUDRATE;
+    config.enableTx     = true;
+    config.enableRx     = true;
+    BENCH_CHECK(kStatus_Success == LPUART_Init(BENCH_LPUART, &config, BENCH_CLOCK_HZ));
+
+    BENCH_CHECK(ARM_DRIVER_OK == Driver_USART2.Initialize(BENCH_CmsisEvent));
+    BENCH_CHECK(ARM_DRIVER_OK == Driver_USART2.PowerControl(ARM_POWER_FULL));
+    BENCH_CHECK(ARM_DRIVER_OK == Driver_USART2.Control(ARM_USART_MODE_ASYNCHRONOUS, BENCH_BAUDRATE));
+
+    (void)printf("LPUART interrupt/eDMA crossover on the LPUART and DMA0 models, %u runs per size\n", iterations);
+    (void)printf("traps: register accesses of the CPU in the start and the interrupt handlers; IRQs: interrupts "
+                 "taken\n");
+    BENCH_Sweep(true, (iterations != 0U) ? iterations : 1U);
+    BENCH_Sweep(false, (iterations != 0U) ? iterations : 1U);
+
+    return EXIT_SUCCESS;
+}
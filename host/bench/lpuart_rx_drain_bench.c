@@ -0,0 +1,366 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Receive interrupt of the transactional LPUART driver per RX FIFO count, every count of the 4-deep FIFO: the bulk
+ * drain into the ring buffer, into a full ring buffer and into the user buffer, for 8-bit and 7-bit data.
+ *
+ * The cycles come first, from the LPUART3 registers as plain memory: before HOST_LpuartInit traps them, the program
+ * sets RDRF and WATER.RXCOUNT and calls LPUART3_DriverIRQHandler, so the handler runs without a register trap. Every
+ * figure is the best of a number of batches of 64 interrupts, in host TSC cycles per data.
+ *
+ * Then the data is checked on the LPUART3 model: the characters come from the line with PRIMASK set, so they pile up
+ * in the FIFO, and the interrupt drains them all when PRIMASK is cleared. The ring buffer must hold them in order
+ * across its wrap, a full ring buffer must keep the newest ones and report one overrun per part of the FIFO that
+ * does not fit, and the user buffers must be filled in order and reported once.
+ *
+ * Usage: lpuart_rx_drain_bench [batches], 1001 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "fsl_lpuart.h"
+#include "host_core.h"
+#include "host_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_BATCHES     1001U
+#define BENCH_BATCH       64U
+#define BENCH_CLOCK_HZ    80000000U
+#define BENCH_BAUDRATE    115200U
+#define BENCH_INSTANCE    3U
+#define BENCH_LPUART      LPUART3
+/* The RX FIFO of the RT1042 is 4 deep, the interrupt never finds more data. */
+#define BENCH_MAX_COUNT   HOST_LPUART_FIFO_DEPTH
+#define BENCH_RING_SIZE   1024U
+/* Ring buffer of the overrun runs, it holds BENCH_FULL_SIZE - 1 data. */
+#define BENCH_FULL_SIZE   16U
+/* Characters received per check run. */
+#define BENCH_CHARACTERS  3000U
+
+#define BENCH_CHECK(cond)                                                          \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/* Where the interrupt stores the received data. */
+typedef enum _bench_mode
+{
+    kBench_Ring = 0U, /* Ring buffer with room. */
+    kBench_Overrun,   /* Full ring buffer, the oldest data is overridden. */
+    kBench_User,      /* Buffer of LPUART_TransferReceiveNonBlocking, no ring buffer. */
+    kBench_Modes,
+} bench_mode_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const char *const s_modeName[] = {"ring buffer", "ring overrun", "user buffer"};
+static const uint32_t s_counts[]      = {1U, 2U, 3U, BENCH_MAX_COUNT};
+
+static lpuart_handle_t s_handle;
+static uint8_t s_ring[BENCH_RING_SIZE];
+static uint8_t s_user[BENCH_BATCH * BENCH_MAX_COUNT];
+static uint8_t s_line[BENCH_CHARACTERS];
+static uint32_t s_seed = 1U;
+
+static volatile uint32_t s_overruns;
+static volatile uint32_t s_rxIdle;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void LPUART3_DriverIRQHandler(void);
+
+static uint32_t BENCH_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    return s_seed >> 8U;
+}
+
+static void BENCH_Callback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+    if (kStatus_LPUART_RxRingBufferOverrun == status)
+    {
+        s_overruns++;
+    }
+    else if (kStatus_LPUART_RxIdle == status)
+    {
+        s_rxIdle++;
+    }
+    else
+    {
+    }
+}
+
+static void BENCH_Init(bool sevenBits)
+{
+    lpuart_config_t config;
+
+    LPUART_GetDefaultConfig(&config);
+    config.baudRate_Bps  = BENCH_BAUDRATE;
+    config.dataBitsCount = sevenBits ? kLPUART_SevenDataBits : kLPUART_EightDataBits;
+    config.enableRx      = true;
+    BENCH_CHECK(kStatus_Success == LPUART_Init(BENCH_LPUART, &config, BENCH_CLOCK_HZ));
+    LPUART_TransferCreateHandle(BENCH_LPUART, &s_handle, BENCH_Callback, NULL);
+}
+
+/* Arms the receive of one batch of interrupts, outside of the measured time. */
+static void BENCH_Arm(bench_mode_t mode, uint32_t count)
+{
+    lpuart_transfer_t xfer;
+
+    switch (mode)
+    {
+        case kBench_Ring:
+            LPUART_TransferStartRingBuffer(BENCH_LPUART, &s_handle, s_ring, BENCH_RING_SIZE);
+            break;
+        case kBench_Overrun:
+            /* Filled by the first interrupts of the first batch, full from then on. */
+            if (NULL == s_handle.rxRingBuffer)
+            {
+                LPUART_TransferStartRingBuffer(BENCH_LPUART, &s_handle, s_ring, BENCH_FULL_SIZE);
+            }
+            break;
+        default:
+            xfer.data     = s_user;
+            xfer.dataSize = BENCH_BATCH * count;
+            BENCH_CHECK(kStatus_Success == LPUART_TransferReceiveNonBlocking(BENCH_LPUART, &s_handle, &xfer, NULL));
+            break;
+    }
+}
+
+/* TSC cycles per data of the receive interrupt, the LPUART3 registers are plain memory. */
+static double BENCH_Cycles(bool sevenBits, bench_mode_t mode, uint32_t count, uint32_t batches)
+{
+    uint64_t best = UINT64_MAX;
+    uint64_t start;
+    uint32_t batch;
+    uint32_t i;
+
+    BENCH_Init(sevenBits);
+    for (batch = 0U; batch < batches; batch++)
+    {
+        BENCH_Arm(mode, count);
+        start = __rdtsc();
+        for (i = 0U; i < BENCH_BATCH; i++)
+        {
+            /* The status of a FIFO holding count data, the DATA reads do not pop it. */
+            BENCH_LPUART->STAT  = LPUART_STAT_RDRF_MASK;
+            BENCH_LPUART->WATER = LPUART_WATER_RXCOUNT(count);
+            LPUART3_DriverIRQHandler();
+        }
+        start = __rdtsc() - start;
+        best  = (start < best) ? start : best;
+    }
+    /* Not LPUART_Deinit, it waits for TC. */
+    LPUART_TransferStopRingBuffer(BENCH_LPUART, &s_handle);
+
+    return (double)best / (double)(BENCH_BATCH * count);
+}
+
+/* Receives count characters with the interrupts masked, the interrupt drains them when PRIMASK is cleared. */
+static void BENCH_Receive(uint32_t *received, uint32_t count)
+{
+    uint32_t irqMask = DisableGlobalIRQ();
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        BENCH_CHECK(HOST_LpuartReceive(BENCH_INSTANCE, s_line[*received + i]));
+    }
+    *received += count;
+    EnableGlobalIRQ(irqMask);
+}
+
+/* The data of the ring buffer, the line masked to the data bits. */
+static void BENCH_CheckRing(uint32_t first, uint32_t length, uint8_t mask)
+{
+    uint32_t tail = s_handle.rxRingBufferTail;
+    uint32_t i;
+
+    BENCH_CHECK(length == LPUART_TransferGetRxRingBufferLength(BENCH_LPUART, &s_handle));
+    for (i = 0U; i < length; i++)
+    {
+        BENCH_CHECK(s_ring[(tail + i) % s_handle.rxRingBufferSize] == (s_line[first + i] & mask));
+    }
+}
+
+/* Random FIFO counts from the line into the ring buffer, taken out by LPUART_TransferReceiveNonBlocking. */
+static void BENCH_CheckRingBuffer(uint8_t mask)
+{
+    lpuart_transfer_t xfer;
+    uint32_t received = 0U;
+    uint32_t taken    = 0U;
+    size_t length;
+    size_t got;
+    uint32_t i;
+
+    LPUART_TransferStartRingBuffer(BENCH_LPUART, &s_handle, s_ring, BENCH_RING_SIZE);
+    s_overruns = 0U;
+    while (received < (BENCH_CHARACTERS - HOST_LPUART_FIFO_DEPTH))
+    {
+        BENCH_Receive(&received, 1U + (BENCH_Random() % HOST_LPUART_FIFO_DEPTH));
+        BENCH_CheckRing(taken, received - taken, mask);
+        length = LPUART_TransferGetRxRingBufferLength(BENCH_LPUART, &s_handle);
+        /* Taken out before the next FIFO count could overflow the ring buffer, so the data wraps at any index. */
+        if ((length + HOST_LPUART_FIFO_DEPTH) >= BENCH_RING_SIZE)
+        {
+            length        = 1U + (BENCH_Random() % MIN(length, sizeof(s_user)));
+            xfer.data     = s_user;
+            xfer.dataSize = length;
+            BENCH_CHECK(kStatus_Success == LPUART_TransferReceiveNonBlocking(BENCH_LPUART, &s_handle, &xfer, &got));
+            BENCH_CHECK(got == length);
+            for (i = 0U; i < length; i++)
+            {
+                BENCH_CHECK(s_user[i] == (s_line[taken + i] & mask));
+            }
+            taken += (uint32_t)length;
+        }
+    }
+    BENCH_CHECK(0U == s_overruns);
+    LPUART_TransferStopRingBuffer(BENCH_LPUART, &s_handle);
+}
+
+/*
+ * A ring buffer never emptied keeps the newest data. The interrupt reads the FIFO in parts of at most the ring
+ * buffer room, every part that does not fit reports one overrun.
+ */
+static void BENCH_CheckOverrun(uint8_t mask, uint32_t ringSize)
+{
+    uint32_t received = 0U;
+    uint32_t expected = 0U;
+    uint32_t length   = 0U;
+    uint32_t count;
+    uint32_t part;
+
+    LPUART_TransferStartRingBuffer(BENCH_LPUART, &s_handle, s_ring, ringSize);
+    s_overruns = 0U;
+    while (received < (BENCH_CHARACTERS - HOST_LPUART_FIFO_DEPTH))
+    {
+        count = 1U + (BENCH_Random() % HOST_LPUART_FIFO_DEPTH);
+        BENCH_Receive(&received, count);
+        for (; count != 0U; count -= part)
+        {
+            part = MIN(count, ringSize - 1U);
+            expected += ((length + part) > (ringSize - 1U)) ? 1U : 0U;
+            length = MIN(length + part, ringSize - 1U);
+        }
+        BENCH_CheckRing(received - length, length, mask);
+    }
+    BENCH_CHECK(expected == s_overruns);
+    LPUART_TransferStopRingBuffer(BENCH_LPUART, &s_handle);
+}
+
+/*
+ * User buffers of random lengths filled from random FIFO counts. The interrupt stops with the buffer full, the rest
+ * of the FIFO goes to the next buffer.
+ */
+static void BENCH_CheckUser(uint8_t mask)
+{
+    lpuart_transfer_t xfer;
+    uint32_t received = 0U;
+    uint32_t taken    = 0U;
+    uint32_t pending;
+    uint32_t i;
+
+    while (received < (BENCH_CHARACTERS - sizeof(s_user) - HOST_LPUART_FIFO_DEPTH))
+    {
+        xfer.data     = s_user;
+        xfer.dataSize = 1U + (BENCH_Random() % (uint32_t)sizeof(s_user));
+        s_rxIdle      = 0U;
+        BENCH_CHECK(kStatus_Success == LPUART_TransferReceiveNonBlocking(BENCH_LPUART, &s_handle, &xfer, NULL));
+        while (0U == s_rxIdle)
+        {
+            /* Characters in the FIFO, never more than it holds. */
+            pending = received - taken - ((uint32_t)xfer.dataSize - (uint32_t)s_handle.rxDataSize);
+            BENCH_Receive(&received, 1U + (BENCH_Random() % (HOST_LPUART_FIFO_DEPTH - pending)));
+        }
+        BENCH_CHECK(1U == s_rxIdle);
+        for (i = 0U; i < xfer.dataSize; i++)
+        {
+            BENCH_CHECK(s_user[i] == (s_line[taken + i] & mask));
+        }
+        taken += (uint32_t)xfer.dataSize;
+        BENCH_CHECK((received - taken) < HOST_LPUART_FIFO_DEPTH);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    double cycles[2][kBench_Modes][ARRAY_SIZE(s_counts)];
+    uint32_t batches = BENCH_BATCHES;
+    uint8_t mask;
+    uint32_t width;
+    uint32_t mode;
+    uint32_t i;
+
+    if (argc > 1)
+    {
+        batches = (uint32_t)strtoul(argv[1], NULL, 0);
+        BENCH_CHECK(batches != 0U);
+    }
+
+    /* The LPUART registers are trapped from HOST_LpuartInit on, the cycles are measured before. */
+    HOST_CoreInit();
+    for (width = 0U; width < 2U; width++)
+    {
+        for (mode = 0U; mode < (uint32_t)kBench_Modes; mode++)
+        {
+            for (i = 0U; i < ARRAY_SIZE(s_counts); i++)
+            {
+                cycles[width][mode][i] = BENCH_Cycles(width != 0U, (bench_mode_t)mode, s_counts[i], batches);
+            }
+        }
+    }
+
+    HOST_LpuartInit();
+    for (i = 0U; i < BENCH_CHARACTERS; i++)
+    {
+        s_line[i] = (uint8_t)BENCH_Random();
+    }
+    for (width = 0U; width < 2U; width++)
+    {
+        mask = (width != 0U) ? 0x7FU : 0xFFU;
+        BENCH_Init(width != 0U);
+        BENCH_CheckRingBuffer(mask);
+        BENCH_CheckOverrun(mask, BENCH_FULL_SIZE);
+        /* A ring buffer smaller than the FIFO is filled in parts. */
+        BENCH_CheckOverrun(mask, 3U);
+        BENCH_CheckUser(mask);
+        LPUART_Deinit(BENCH_LPUART);
+    }
+
+    (void)printf("LPUART receive interrupt, best of %u batches of %u interrupts, host TSC cycles per data\n", batches,
+                 BENCH_BATCH);
+    (void)printf("FIFO count\t%-16s%-16s%s\n", s_modeName[kBench_Ring], s_modeName[kBench_Overrun],
+                 s_modeName[kBench_User]);
+    for (width = 0U; width < 2U; width++)
+    {
+        for (i = 0U; i < ARRAY_SIZE(s_counts); i++)
+        {
+            (void)printf("%u-bit %u\t%-16.1f%-16.1f%.1f\n", (width != 0U) ? 7U : 8U, s_counts[i],
+                         cycles[width][kBench_Ring][i], cycles[width][kBench_Overrun][i],
+                         cycles[width][kBench_User][i]);
+        }
+    }
+    (void)printf("Data checked on the LPUART3 model: %u characters per mode and data width\n", BENCH_CHARACTERS);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_ARM_ACLE_H_
+#define _HOST_ARM_ACLE_H_
+
+#include <stdint.h>
+
+/*
+ * Arm C Language Extensions of the host builds. The CMSIS headers map their saturation and SIMD intrinsics to
+ * these functions, they are computed in C with the results of the Cortex-M7 instructions.
+ */
+
+static inline int32_t __ssat(int32_t value, uint32_t sat)
+{
+    const int32_t max = (int32_t)((1UL << (sat - 1U)) - 1U);
+    const int32_t min = -max - 1;
+
+    return (value > max) ? max : ((value < min) ? min : value);
+}
+
+static inline uint32_t __usat(int32_t value, uint32_t sat)
+{
+    const uint32_t max = (uint32_t)((1ULL << sat) - 1U);
+
+    return (value < 0) ? 0U : (((uint32_t)value > max) ? max : (uint32_t)value);
+}
+
+/* Packed pairs of 16-bit halves. */
+typedef int32_t int16x2_t;
+typedef uint32_t uint16x2_t;
+typedef uint32_t uint8x4_t;
+
+/* APSR.GE flags of the translation unit, one bit per byte, set by the SIMD subtractions and read by SEL. */
+static uint32_t s_hostApsrGe __attribute__((unused));
+
+static inline int64_t __smlald(int16x2_t a, int16x2_t b, int64_t acc)
+{
+    /* The products of the halves are added to the 64-bit accumulator, the sum wraps like the instruction. */
+    return (int64_t)((uint64_t)acc + (uint64_t)((int64_t)(int16_t)a * (int16_t)b) +
+                     (uint64_t)((int64_t)(int16_t)((uint32_t)a >> 16U) * (int16_t)((uint32_t)b >> 16U)));
+}
+
+static inline uint16x2_t __usub16(uint16x2_t a, uint16x2_t b)
+{
+    /* A half sets both GE flags of its bytes when it does not borrow, that is a >= b. */
+    s_hostApsrGe = (((a & 0xFFFFU) >= (b & 0xFFFFU)) ? 0x3U : 0U) | (((a >> 16U) >= (b >> 16U)) ? 0xCU : 0U);
+
+    return ((a - b) & 0xFFFFU) | (((a >> 16U) - (b >> 16U)) << 16U);
+}
+
+static inline uint8x4_t __sel(uint8x4_t a, uint8x4_t b)
+{
+    uint32_t mask = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < 4U; i++)
+    {
+        mask |= ((s_hostApsrGe >> i) & 1U) * (0xFFUL << (8U * i));
+    }
+
+    return (a & mask) | (b & ~mask);
+}
+
+#endif /* _HOST_ARM_ACLE_H_ */
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_CMSIS_H_
+#define _HOST_CMSIS_H_
+
+/*
+ * Included ahead of every source of the host builds. The CMSIS compiler header of the project is pulled in
+ * first, its include guard keeps it out afterwards. Then the core intrinsics used by the drivers are replaced by
+ * the core model, the others keep their Arm inline assembly and do not assemble if a source uses them.
+ */
+#include "cmsis_compiler.h"
+#include "host_core.h"
+
+#define __get_PRIMASK()  HOST_CoreGetPrimask()
+#define __set_PRIMASK(x) HOST_CoreSetPrimask(x)
+#define __disable_irq()  HOST_CoreSetPrimask(1U)
+#define __enable_irq()   HOST_CoreSetPrimask(0U)
+#define __get_IPSR()     HOST_CoreGetIPSR()
+
+#undef __NOP
+#undef __WFI
+#undef __WFE
+
+#define __DSB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB() __asm volatile("" ::: "memory")
+#define __NOP() __asm volatile("nop")
+#define __WFI() __asm volatile("pause" ::: "memory")
+#define __WFE() __asm volatile("pause" ::: "memory")
+
+#define __LDREXB(addr)         HOST_CoreLoadExclusive8(addr)
+#define __LDREXH(addr)         HOST_CoreLoadExclusive16(addr)
+#define __LDREXW(addr)         HOST_CoreLoadExclusive32(addr)
+#define __STREXB(value, addr)  HOST_CoreStoreExclusive8((value), (addr))
+#define __STREXH(value, addr)  HOST_CoreStoreExclusive16((value), (addr))
+#define __STREXW(value, addr)  HOST_CoreStoreExclusive32((value), (addr))
+#define __CLREX()              (g_hostExclusiveOpen = 0U)
+
+#endif /* _HOST_CMSIS_H_ */
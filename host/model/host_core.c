@@ -0,0 +1,403 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include "fsl_device_registers.h"
+#include "host_core.h"
+#include "host_mmio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_CORE_IRQ_WORDS         ((HOST_CORE_IRQ_COUNT + 31U) / 32U)
+/* Execution priority of the thread mode, lower than any interrupt. */
+#define HOST_CORE_THREAD_PRIORITY   0x100U
+/* No interrupt can be taken. */
+#define HOST_CORE_NO_IRQ            (-2)
+/* Offsets of the NVIC registers in the system control space page. */
+#define HOST_CORE_NVIC_OFFSET(reg)  ((NVIC_BASE - SCS_BASE) + offsetof(NVIC_Type, reg))
+#define HOST_CORE_NVIC_WORDS_SIZE   (8U * sizeof(uint32_t))
+
+typedef void (*host_core_handler_t)(void);
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/* Handlers of the vector table, the drivers that are linked in provide them. */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void DMA0_DMA16_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA1_DMA17_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA2_DMA18_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA3_DMA19_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA4_DMA20_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA5_DMA21_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA6_DMA22_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA7_DMA23_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA8_DMA24_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA9_DMA25_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA10_DMA26_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA11_DMA27_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA12_DMA28_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA13_DMA29_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA14_DMA30_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA15_DMA31_DriverIRQHandler(void) __attribute__((weak));
+extern void DMA_ERROR_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART1_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART2_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART3_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART4_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART5_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART6_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART7_DriverIRQHandler(void) __attribute__((weak));
+extern void LPUART8_DriverIRQHandler(void) __attribute__((weak));
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+volatile uint32_t g_hostPrimask;
+volatile uint32_t g_hostExclusiveValue;
+volatile uint32_t g_hostExclusiveOpen;
+
+static host_core_handler_t const s_vectors[HOST_CORE_IRQ_COUNT] = {
+    [DMA0_DMA16_IRQn] = DMA0_DMA16_DriverIRQHandler,   [DMA1_DMA17_IRQn] = DMA1_DMA17_DriverIRQHandler,
+    [DMA2_DMA18_IRQn] = DMA2_DMA18_DriverIRQHandler,   [DMA3_DMA19_IRQn] = DMA3_DMA19_DriverIRQHandler,
+    [DMA4_DMA20_IRQn] = DMA4_DMA20_DriverIRQHandler,   [DMA5_DMA21_IRQn] = DMA5_DMA21_DriverIRQHandler,
+    [DMA6_DMA22_IRQn] = DMA6_DMA22_DriverIRQHandler,   [DMA7_DMA23_IRQn] = DMA7_DMA23_DriverIRQHandler,
+    [DMA8_DMA24_IRQn] = DMA8_DMA24_DriverIRQHandler,   [DMA9_DMA25_IRQn] = DMA9_DMA25_DriverIRQHandler,
+    [DMA10_DMA26_IRQn] = DMA10_DMA26_DriverIRQHandler, [DMA11_DMA27_IRQn] = DMA11_DMA27_DriverIRQHandler,
+    [DMA12_DMA28_IRQn] = DMA12_DMA28_DriverIRQHandler, [DMA13_DMA29_IRQn] = DMA13_DMA29_DriverIRQHandler,
+    [DMA14_DMA30_IRQn] = DMA14_DMA30_DriverIRQHandler, [DMA15_DMA31_IRQn] = DMA15_DMA31_DriverIRQHandler,
+    [DMA_ERROR_IRQn] = DMA_ERROR_DriverIRQHandler,     [LPUART1_IRQn] = LPUART1_DriverIRQHandler,
+    [LPUART2_IRQn] = LPUART2_DriverIRQHandler,         [LPUART3_IRQn] = LPUART3_DriverIRQHandler,
+    [LPUART4_IRQn] = LPUART4_DriverIRQHandler,         [LPUART5_IRQn] = LPUART5_DriverIRQHandler,
+    [LPUART6_IRQn] = LPUART6_DriverIRQHandler,         [LPUART7_IRQn] = LPUART7_DriverIRQHandler,
+    [LPUART8_IRQn] = LPUART8_DriverIRQHandler,
+};
+
+/* Pending interrupts, set by the models from any context and claimed atomically by HOST_CoreDispatch. */
+static volatile uint32_t s_irqPending[HOST_CORE_IRQ_WORDS];
+static volatile uint32_t s_sysTickPending;
+/* Enabled interrupts, the value the NVIC set enable and clear enable registers read. */
+static volatile uint32_t s_irqEnabled[HOST_CORE_IRQ_WORDS];
+/* Priority of the running handler, HOST_CORE_THREAD_PRIORITY in thread mode. */
+static volatile uint32_t s_executionPriority = HOST_CORE_THREAD_PRIORITY;
+/* Exception number of the running handler, 0 in thread mode. */
+static volatile uint32_t s_activeException;
+/* Interrupts taken and host time spent in the handlers, nested handlers are counted in the preempted one. */
+static volatile uint64_t s_irqCount;
+static volatile uint64_t s_irqTimeNs;
+/* Masked sections of PRIMASK: count, start of the running one, total and longest host time. */
+static volatile uint64_t s_maskCount;
+static volatile uint64_t s_maskStartNs;
+static volatile uint64_t s_maskedTimeNs;
+static volatile uint64_t s_maxMaskedNs;
+/* Model work of the asynchronous tick, NULL when the tick is stopped. */
+static volatile host_core_tick_t s_tick;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t *HOST_CoreNvicWord(uint32_t offset)
+{
+    return (uint32_t *)HOST_MmioAlias(SCS_BASE + (offset & ~3U));
+}
+
+/* The set and clear registers of one kind read the same state. */
+static void HOST_CoreNvicRead(uint32_t offset, void *userData)
+{
+    uint32_t index = (offset & (HOST_CORE_NVIC_WORDS_SIZE - 1U)) / sizeof(uint32_t);
+
+    (void)userData;
+    if ((offset >= HOST_CORE_NVIC_OFFSET(ISER)) && (offset < HOST_CORE_NVIC_OFFSET(ISPR)))
+    {
+        *HOST_CoreNvicWord(offset) = (index < HOST_CORE_IRQ_WORDS) ? s_irqEnabled[index] : 0U;
+    }
+    else if ((offset >= HOST_CORE_NVIC_OFFSET(ISPR)) && (offset < HOST_CORE_NVIC_OFFSET(IABR)))
+    {
+        *HOST_CoreNvicWord(offset) = (index < HOST_CORE_IRQ_WORDS) ? s_irqPending[index] : 0U;
+    }
+    else
+    {
+        /* Priorities, SysTick and SCB registers are plain storage. */
+    }
+}
+
+static void HOST_CoreNvicWrite(uint32_t offset, const uint8_t *previous, void *userData)
+{
+    uint32_t index = (offset & (HOST_CORE_NVIC_WORDS_SIZE - 1U)) / sizeof(uint32_t);
+    uint32_t value = *HOST_CoreNvicWord(offset);
+
+    (void)previous;
+    if ((offset < HOST_CORE_NVIC_OFFSET(ISER)) || (offset >= HOST_CORE_NVIC_OFFSET(IABR)) ||
+        (index >= HOST_CORE_IRQ_WORDS))
+    {
+        return;
+    }
+    if (offset < HOST_CORE_NVIC_OFFSET(ICER))
+    {
+        s_irqEnabled[index] |= value;
+    }
+    else if (offset < HOST_CORE_NVIC_OFFSET(ISPR))
+    {
+        s_irqEnabled[index] &= ~value;
+    }
+    else if (offset < HOST_CORE_NVIC_OFFSET(ICPR))
+    {
+        (void)__atomic_fetch_or(&s_irqPending[index], value, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        (void)__atomic_fetch_and(&s_irqPending[index], ~value, __ATOMIC_SEQ_CST);
+    }
+    HOST_CoreNvicRead(offset, userData);
+}
+
+static uint32_t HOST_CoreGetPriority(int32_t irq)
+{
+    if (irq == HOST_CORE_SYSTICK_IRQ)
+    {
+        return ((SCB_Type *)HOST_MmioAlias(SCB_BASE))->SHPR[((uint32_t)SysTick_IRQn & 0xFU) - 4U];
+    }
+
+    return ((NVIC_Type *)HOST_MmioAlias(NVIC_BASE))->IPR[irq];
+}
+
+/* Finds the pending interrupt with the highest priority that can preempt the running code. */
+static int32_t HOST_CoreGetNextIRQ(uint32_t *priority)
+{
+    int32_t next  = HOST_CORE_NO_IRQ;
+    uint32_t best = s_executionPriority;
+    uint32_t pending;
+    uint32_t current;
+    uint32_t index;
+    int32_t irq;
+
+    if (s_sysTickPending != 0U)
+    {
+        current = HOST_CoreGetPriority(HOST_CORE_SYSTICK_IRQ);
+        if (current < best)
+        {
+            next = HOST_CORE_SYSTICK_IRQ;
+            best = current;
+        }
+    }
+    for (index = 0U; index < HOST_CORE_IRQ_WORDS; index++)
+    {
+        pending = s_irqPending[index] & s_irqEnabled[index];
+        while (pending != 0U)
+        {
+            irq     = (int32_t)((index * 32U) + (uint32_t)__builtin_ctz(pending));
+            current = HOST_CoreGetPriority(irq);
+            if (current < best)
+            {
+                next = irq;
+                best = current;
+            }
+            pending &= pending - 1U;
+        }
+    }
+    *priority = best;
+
+    return next;
+}
+
+/* Clears the pending state, false when another context took the interrupt first. */
+static bool HOST_CoreClaimIRQ(int32_t irq)
+{
+    uint32_t mask;
+
+    if (irq == HOST_CORE_SYSTICK_IRQ)
+    {
+        return __atomic_exchange_n(&s_sysTickPending, 0U, __ATOMIC_SEQ_CST) != 0U;
+    }
+    mask = 1UL << ((uint32_t)irq & 0x1FU);
+
+    return (__atomic_fetch_and(&s_irqPending[(uint32_t)irq >> 5U], ~mask, __ATOMIC_SEQ_CST) & mask) != 0U;
+}
+
+static void HOST_CoreTakeIRQ(int32_t irq, uint32_t priority)
+{
+    host_core_handler_t handler = (irq == HOST_CORE_SYSTICK_IRQ) ? SysTick_Handler : s_vectors[irq];
+    uint32_t previousPriority   = s_executionPriority;
+    uint32_t previousException  = s_activeException;
+    uint32_t exclusiveValue     = g_hostExclusiveValue;
+    uint64_t start              = 0U;
+
+    if (handler == NULL)
+    {
+        (void)fprintf(stderr, "host_core: no handler for interrupt %d\n", (int)irq);
+        abort();
+    }
+
+    /* Exception entry and return clear the local monitor, the preempted exclusive store fails. */
+    if (previousPriority == HOST_CORE_THREAD_PRIORITY)
+    {
+        start = HOST_CoreGetTimeNs();
+    }
+    s_executionPriority = priority;
+    s_activeException   = (uint32_t)(irq + 16);
+    g_hostExclusiveOpen = 0U;
+    handler();
+    s_irqCount++;
+    if (previousPriority == HOST_CORE_THREAD_PRIORITY)
+    {
+        s_irqTimeNs += HOST_CoreGetTimeNs() - start;
+    }
+    s_executionPriority  = previousPriority;
+    s_activeException    = previousException;
+    g_hostExclusiveValue = exclusiveValue;
+    g_hostExclusiveOpen  = 0U;
+}
+
+void HOST_CoreInit(void)
+{
+    HOST_MmioInit();
+    HOST_MmioTrap(SCS_BASE, HOST_MMIO_PAGE_SIZE, HOST_CoreNvicRead, HOST_CoreNvicWrite, NULL);
+}
+
+void HOST_CoreSetPendingIRQ(int32_t irq)
+{
+    assert((irq == HOST_CORE_SYSTICK_IRQ) || ((irq >= 0) && ((uint32_t)irq < HOST_CORE_IRQ_COUNT)));
+
+    if (irq == HOST_CORE_SYSTICK_IRQ)
+    {
+        s_sysTickPending = 1U;
+    }
+    else
+    {
+        (void)__atomic_fetch_or(&s_irqPending[(uint32_t)irq >> 5U], 1UL << ((uint32_t)irq & 0x1FU),
+                                __ATOMIC_SEQ_CST);
+    }
+}
+
+void HOST_CoreDispatch(void)
+{
+    uint32_t priority;
+    int32_t irq;
+
+    while (g_hostPrimask == 0U)
+    {
+        irq = HOST_CoreGetNextIRQ(&priority);
+        if (irq == HOST_CORE_NO_IRQ)
+        {
+            break;
+        }
+        if (HOST_CoreClaimIRQ(irq))
+        {
+            HOST_CoreTakeIRQ(irq, priority);
+        }
+    }
+}
+
+/* The tick interrupts the running code at any instruction, except inside a trapped register access. */
+static void HOST_CoreTickSignal(int signal)
+{
+    host_core_tick_t tick = s_tick;
+
+    (void)signal;
+    if (tick != NULL)
+    {
+        tick();
+        HOST_CoreDispatch();
+    }
+}
+
+void HOST_CoreStartTick(uint32_t periodUs, host_core_tick_t tick)
+{
+    struct itimerval timer;
+    struct sigaction action;
+
+    assert((periodUs != 0U) && (tick != NULL));
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = HOST_CoreTickSignal;
+    action.sa_flags   = SA_RESTART;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaction(SIGALRM, &action, NULL);
+
+    s_tick                    = tick;
+    timer.it_interval.tv_sec  = (time_t)(periodUs / 1000000U);
+    timer.it_interval.tv_usec = (suseconds_t)(periodUs % 1000000U);
+    timer.it_value            = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+void HOST_CoreStopTick(void)
+{
+    struct itimerval timer;
+
+    (void)memset(&timer, 0, sizeof(timer));
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+    s_tick = NULL;
+}
+
+uint64_t HOST_CoreGetTimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+uint32_t HOST_CoreGetIPSR(void)
+{
+    return s_activeException;
+}
+
+uint64_t HOST_CoreGetIRQCount(void)
+{
+    return s_irqCount;
+}
+
+uint64_t HOST_CoreGetIRQTimeNs(void)
+{
+    return s_irqTimeNs;
+}
+
+void HOST_CoreRecordPrimask(uint32_t primask)
+{
+    uint64_t now = HOST_CoreGetTimeNs();
+    uint64_t elapsed;
+
+    if (primask != 0U)
+    {
+        s_maskCount++;
+        s_maskStartNs = now;
+    }
+    else
+    {
+        elapsed = now - s_maskStartNs;
+        s_maskedTimeNs += elapsed;
+        if (elapsed > s_maxMaskedNs)
+        {
+            s_maxMaskedNs = elapsed;
+        }
+    }
+}
+
+uint64_t HOST_CoreGetMaskCount(void)
+{
+    return s_maskCount;
+}
+
+uint64_t HOST_CoreGetMaskedTimeNs(void)
+{
+    return s_maskedTimeNs;
+}
+
+uint64_t HOST_CoreGetMaxMaskedNs(void)
+{
+    return s_maxMaskedNs;
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_CORE_H_
+#define _HOST_CORE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup host_core
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Number of device interrupts of the NVIC model. */
+#define HOST_CORE_IRQ_COUNT 160U
+/*! @brief Interrupt number of the SysTick exception, the only core exception the model raises. */
+#define HOST_CORE_SYSTICK_IRQ (-1)
+
+/*!
+ * @brief Model work of the asynchronous tick, for example running the eDMA engine or raising a timer interrupt.
+ *
+ * It runs in the context the tick interrupted, at any instruction of the running code.
+ */
+typedef void (*host_core_tick_t)(void);
+
+/*! @brief PRIMASK of the model core, 1 when the interrupts are masked. */
+extern volatile uint32_t g_hostPrimask;
+/*! @brief Value loaded by the last exclusive load of the model core. */
+extern volatile uint32_t g_hostExclusiveValue;
+/*! @brief 1 while the local exclusive monitor is open, exception entry and return close it. */
+extern volatile uint32_t g_hostExclusiveOpen;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Maps the peripheral windows and traps the NVIC registers.
+ */
+void HOST_CoreInit(void);
+
+/*!
+ * @brief Sets an interrupt pending, as a peripheral raising its interrupt line does.
+ *
+ * The interrupt is taken by the next HOST_CoreDispatch call that finds it enabled, unmasked and of higher priority
+ * than the running code.
+ *
+ * @param irq Device interrupt number, or HOST_CORE_SYSTICK_IRQ.
+ */
+void HOST_CoreSetPendingIRQ(int32_t irq);
+
+/*!
+ * @brief Takes the pending interrupts that can preempt the running code.
+ *
+ * The handlers run on the calling context, in priority order, until no pending interrupt can preempt.
+ * PRIMASK writes and the peripheral models call this function after every change that could make an interrupt
+ * taken.
+ */
+void HOST_CoreDispatch(void);
+
+/*!
+ * @brief Starts the asynchronous tick.
+ *
+ * Every period a host timer signal interrupts the running code, thread or handler, calls the tick function and
+ * takes the interrupts it raised that can preempt the interrupted code. The peripherals then progress and
+ * interrupt the drivers at any instruction, as on the device, instead of between the steps the program makes.
+ * The tick is held off during a trapped register access, which stays one access.
+ *
+ * @param periodUs Tick period in us of host time.
+ * @param tick Model work of every tick, it must not call functions that are unsafe in a signal handler.
+ */
+void HOST_CoreStartTick(uint32_t periodUs, host_core_tick_t tick);
+
+/*!
+ * @brief Stops the asynchronous tick.
+ */
+void HOST_CoreStopTick(void);
+
+/*!
+ * @brief Gets the host monotonic time in ns.
+ */
+uint64_t HOST_CoreGetTimeNs(void);
+
+/*!
+ * @brief Gets the number of interrupts taken since HOST_CoreInit.
+ */
+uint64_t HOST_CoreGetIRQCount(void);
+
+/*!
+ * @brief Gets the host time in ns spent in the interrupt handlers since HOST_CoreInit.
+ *
+ * The time of the register traps taken by the handlers is included, see HOST_MmioGetTrapCost.
+ */
+uint64_t HOST_CoreGetIRQTimeNs(void);
+
+/*!
+ * @brief Gets the exception number of the running handler, the value of IPSR.
+ *
+ * @return 0 in thread mode, 15 in the SysTick handler, the interrupt number plus 16 in a device interrupt handler.
+ */
+uint32_t HOST_CoreGetIPSR(void);
+
+/*! @brief Reads PRIMASK, with the compiler barrier of the intrinsic. */
+static inline uint32_t HOST_CoreGetPrimask(void)
+{
+    __asm volatile("" ::: "memory");
+    return g_hostPrimask;
+}
+
+/*!
+ * @brief Records a PRIMASK change for HOST_CoreGetMaskCount and HOST_CoreGetMaskedTimeNs.
+ *
+ * Called by HOST_CoreSetPrimask before the change.
+ *
+ * @param primask New PRIMASK value.
+ */
+void HOST_CoreRecordPrimask(uint32_t primask);
+
+/*!
+ * @brief Gets the number of times PRIMASK was set since HOST_CoreInit, every masked section counts once.
+ */
+uint64_t HOST_CoreGetMaskCount(void);
+
+/*!
+ * @brief Gets the host time in ns spent with PRIMASK set since HOST_CoreInit.
+ *
+ * It is the interrupt latency the masked sections add, the time of the register traps taken meanwhile is
+ * included.
+ */
+uint64_t HOST_CoreGetMaskedTimeNs(void);
+
+/*!
+ * @brief Gets the longest masked section since HOST_CoreInit in host ns, the worst latency it added.
+ */
+uint64_t HOST_CoreGetMaxMaskedNs(void);
+
+/*! @brief Writes PRIMASK, pending interrupts are taken as soon as it is cleared. */
+static inline void HOST_CoreSetPrimask(uint32_t primask)
+{
+    __asm volatile("" ::: "memory");
+    if ((primask & 1U) != g_hostPrimask)
+    {
+        HOST_CoreRecordPrimask(primask & 1U);
+    }
+    g_hostPrimask = primask & 1U;
+    __asm volatile("" ::: "memory");
+    if (g_hostPrimask == 0U)
+    {
+        HOST_CoreDispatch();
+    }
+}
+
+/*
+ * Exclusive accesses: a store succeeds when the monitor is still open and the location still holds the loaded
+ * value. The compare and swap keeps the store atomic against a model interrupt taken in the middle of it.
+ */
+static inline uint8_t HOST_CoreLoadExclusive8(volatile uint8_t *addr)
+{
+    uint8_t value = *addr;
+
+    g_hostExclusiveValue = value;
+    g_hostExclusiveOpen  = 1U;
+    return value;
+}
+
+static inline uint16_t HOST_CoreLoadExclusive16(volatile uint16_t *addr)
+{
+    uint16_t value = *addr;
+
+    g_hostExclusiveValue = value;
+    g_hostExclusiveOpen  = 1U;
+    return value;
+}
+
+static inline uint32_t HOST_CoreLoadExclusive32(volatile uint32_t *addr)
+{
+    uint32_t value = *addr;
+
+    g_hostExclusiveValue = value;
+    g_hostExclusiveOpen  = 1U;
+    return value;
+}
+
+static inline uint32_t HOST_CoreStoreExclusive8(uint8_t value, volatile uint8_t *addr)
+{
+    uint8_t expected = (uint8_t)g_hostExclusiveValue;
+
+    if (g_hostExclusiveOpen == 0U)
+    {
+        return 1U;
+    }
+    g_hostExclusiveOpen = 0U;
+    return __atomic_compare_exchange_n((uint8_t *)addr, &expected, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ?
+               0U :
+               1U;
+}
+
+static inline uint32_t HOST_CoreStoreExclusive16(uint16_t value, volatile uint16_t *addr)
+{
+    uint16_t expected = (uint16_t)g_hostExclusiveValue;
+
+    if (g_hostExclusiveOpen == 0U)
+    {
+        return 1U;
+    }
+    g_hostExclusiveOpen = 0U;
+    return __atomic_compare_exchange_n((uint16_t *)addr, &expected, value, false, __ATOMIC_SEQ_CST,
+                                       __ATOMIC_SEQ_CST) ?
+               0U :
+               1U;
+}
+
+static inline uint32_t HOST_CoreStoreExclusive32(uint32_t value, volatile uint32_t *addr)
+{
+    uint32_t expected = g_hostExclusiveValue;
+
+    if (g_hostExclusiveOpen == 0U)
+    {
+        return 1U;
+    }
+    g_hostExclusiveOpen = 0U;
+    return __atomic_compare_exchange_n((uint32_t *)addr, &expected, value, false, __ATOMIC_SEQ_CST,
+                                       __ATOMIC_SEQ_CST) ?
+               0U :
+               1U;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _HOST_CORE_H_ */
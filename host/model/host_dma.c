@@ -0,0 +1,607 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include "fsl_device_registers.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_mmio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_DMA_CHANNELS      FSL_FEATURE_EDMA_MODULE_CHANNEL
+#define HOST_DMA_SOURCES       (DMAMUX_CHCFG_SOURCE_MASK + 1U)
+#define HOST_DMA_NO_CHANNEL    (-1)
+/* Control registers page and TCD page of DMA0. */
+#define HOST_DMA_CONTROL_SIZE  (offsetof(DMA_Type, DCHPRI3) + HOST_DMA_CHANNELS)
+#define HOST_DMA_TCD_BASE      (DMA0_BASE + offsetof(DMA_Type, TCD))
+#define HOST_DMA_TCD_SIZE      (sizeof(((DMA_Type *)0)->TCD))
+#define HOST_DMA_REG(reg)      offsetof(DMA_Type, reg)
+/* ES is read-only for the CPU only. */
+#define HOST_DMA_ES            (*(volatile uint32_t *)(uintptr_t)&s_dma->ES)
+/* Channel priority registers are byte-reversed in each word, DCHPRI3 comes first. */
+#define HOST_DMA_DCHPRI(ch)    (offsetof(DMA_Type, DCHPRI3) + ((ch) ^ 3U))
+/* Command registers: bit 7 no-op, bit 6 all channels, bits 0-4 channel. */
+#define HOST_DMA_CMD_NOP_MASK  0x80U
+#define HOST_DMA_CMD_ALL_MASK  0x40U
+#define HOST_DMA_CMD_CH_MASK   0x1FU
+/* Element of the transfer is at most a 32-byte burst, the packing buffer holds a read and a partial write. */
+#define HOST_DMA_MAX_ELEMENT   32U
+
+/*! @brief TCD as laid out in the registers and in the scatter/gather memory. */
+typedef struct _host_dma_tcd
+{
+    uint32_t saddr;
+    uint16_t soff;
+    uint16_t attr;
+    uint32_t nbytes;
+    int32_t slast;
+    uint32_t daddr;
+    uint16_t doff;
+    uint16_t citer;
+    int32_t dlastSga;
+    uint16_t csr;
+    uint16_t biter;
+} host_dma_tcd_t;
+
+_Static_assert(sizeof(host_dma_tcd_t) == 32U, "TCD layout");
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Bounds of the image, the static buffers the eDMA can reach. */
+extern char __executable_start[];
+extern char end[];
+
+static DMA_Type *s_dma;
+static host_dma_tcd_t *s_tcd;
+static DMAMUX_Type *s_dmamux;
+static volatile uint8_t s_requests[HOST_DMA_SOURCES];
+static volatile uint64_t s_cycles;
+static volatile uint32_t s_running;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static bool HOST_DmaIsImage(uint32_t address, uint32_t size)
+{
+    return (address >= (uintptr_t)__executable_start) && ((uintptr_t)address + size <= (uintptr_t)end);
+}
+
+static bool HOST_DmaIsRegister(uint32_t address, uint32_t size)
+{
+    return (HOST_MmioAlias(address) != NULL) && (HOST_MmioAlias(address + size - 1U) != NULL);
+}
+
+static bool HOST_DmaRead(uint32_t address, void *data, uint32_t size)
+{
+    if (HOST_DmaIsImage(address, size))
+    {
+        (void)memcpy(data, (const void *)(uintptr_t)address, size);
+        return true;
+    }
+    if (HOST_DmaIsRegister(address, size))
+    {
+        HOST_MmioBusRead(address, data, size);
+        return true;
+    }
+
+    return false;
+}
+
+static bool HOST_DmaWrite(uint32_t address, const void *data, uint32_t size)
+{
+    if (HOST_DmaIsImage(address, size))
+    {
+        (void)memcpy((void *)(uintptr_t)address, data, size);
+        return true;
+    }
+    if (HOST_DmaIsRegister(address, size))
+    {
+        HOST_MmioBusWrite(address, data, size);
+        return true;
+    }
+
+    return false;
+}
+
+/* Transfer size in bytes of an ATTR SSIZE or DSIZE code, 0 for the reserved codes. */
+static uint32_t HOST_DmaGetSize(uint32_t code)
+{
+    static const uint8_t s_sizes[8] = {1U, 2U, 4U, 8U, 0U, 32U, 0U, 0U};
+
+    return s_sizes[code & 7U];
+}
+
+/* Next element address, the modulo keeps the upper address bits. */
+static uint32_t HOST_DmaAdvance(uint32_t address, uint16_t offset, uint32_t modulo)
+{
+    uint32_t next = address + (uint32_t)(int32_t)(int16_t)offset;
+    uint32_t mask;
+
+    if (modulo != 0U)
+    {
+        mask = (1UL << modulo) - 1U;
+        next = (address & ~mask) | (next & mask);
+    }
+
+    return next;
+}
+
+static uint32_t HOST_DmaGetCount(uint16_t iter)
+{
+    return ((iter & DMA_CITER_ELINKYES_ELINK_MASK) != 0U) ? (iter & DMA_CITER_ELINKYES_CITER_MASK) :
+                                                            (iter & DMA_CITER_ELINKNO_CITER_MASK);
+}
+
+static void HOST_DmaRaiseIRQ(uint32_t channel)
+{
+    s_dma->INT |= 1UL << channel;
+    HOST_CoreSetPendingIRQ((int32_t)DMA0_DMA16_IRQn + (int32_t)(channel % 16U));
+}
+
+static void HOST_DmaLink(uint32_t channel)
+{
+    s_tcd[channel].csr |= DMA_CSR_START_MASK;
+}
+
+/* Retires the channel with an error, the request is disabled until the software restarts it. */
+static void HOST_DmaError(uint32_t channel, uint32_t flags)
+{
+    s_tcd[channel].csr &= (uint16_t)~(DMA_CSR_START_MASK | DMA_CSR_ACTIVE_MASK);
+    HOST_DMA_ES = DMA_ES_VLD_MASK | DMA_ES_ERRCHN(channel) | flags;
+    s_dma->ERR |= 1UL << channel;
+    s_dma->ERQ &= ~(1UL << channel);
+    if ((s_dma->CR & DMA_CR_HOE_MASK) != 0U)
+    {
+        s_dma->CR |= DMA_CR_HALT_MASK;
+    }
+    if ((s_dma->EEI & (1UL << channel)) != 0U)
+    {
+        HOST_CoreSetPendingIRQ((int32_t)DMA_ERROR_IRQn);
+    }
+}
+
+/* Configuration checks done when the channel is activated. */
+static uint32_t HOST_DmaCheck(const host_dma_tcd_t *tcd, uint32_t ssize, uint32_t dsize, uint32_t nbytes)
+{
+    uint32_t flags = 0U;
+
+    if ((ssize == 0U) || ((tcd->saddr % ssize) != 0U))
+    {
+        flags |= DMA_ES_SAE_MASK;
+    }
+    else if (((uint32_t)(int32_t)(int16_t)tcd->soff % ssize) != 0U)
+    {
+        flags |= DMA_ES_SOE_MASK;
+    }
+    else
+    {
+        /* Source is valid. */
+    }
+    if ((dsize == 0U) || ((tcd->daddr % dsize) != 0U))
+    {
+        flags |= DMA_ES_DAE_MASK;
+    }
+    else if (((uint32_t)(int32_t)(int16_t)tcd->doff % dsize) != 0U)
+    {
+        flags |= DMA_ES_DOE_MASK;
+    }
+    else
+    {
+        /* Destination is valid. */
+    }
+    if ((flags == 0U) && ((nbytes == 0U) || ((nbytes % ssize) != 0U) || ((nbytes % dsize) != 0U) ||
+                          (HOST_DmaGetCount(tcd->citer) == 0U) ||
+                          ((tcd->citer & DMA_CITER_ELINKYES_ELINK_MASK) !=
+                           (tcd->biter & DMA_BITER_ELINKYES_ELINK_MASK))))
+    {
+        flags |= DMA_ES_NCE_MASK;
+    }
+
+    return flags;
+}
+
+/* Services one request of the channel: one minor loop, then the major loop completion if it was the last. */
+static uint32_t HOST_DmaService(uint32_t channel)
+{
+    host_dma_tcd_t *regs = &s_tcd[channel];
+    host_dma_tcd_t tcd;
+    host_dma_tcd_t next;
+    uint8_t buffer[2U * HOST_DMA_MAX_ELEMENT];
+    uint32_t cycles = HOST_DMA_CYCLES_ACTIVATE;
+    uint32_t ssize;
+    uint32_t dsize;
+    uint32_t nbytes;
+    uint32_t filled  = 0U;
+    uint32_t written = 0U;
+    uint32_t count;
+    uint32_t flags;
+    int32_t mloff = 0;
+
+    /* Activation clears START and DONE. */
+    regs->csr &= (uint16_t)~(DMA_CSR_START_MASK | DMA_CSR_DONE_MASK);
+    (void)memcpy(&tcd, regs, sizeof(tcd));
+
+    ssize  = HOST_DmaGetSize((tcd.attr & DMA_ATTR_SSIZE_MASK) >> DMA_ATTR_SSIZE_SHIFT);
+    dsize  = HOST_DmaGetSize((tcd.attr & DMA_ATTR_DSIZE_MASK) >> DMA_ATTR_DSIZE_SHIFT);
+    nbytes = tcd.nbytes;
+    if ((s_dma->CR & DMA_CR_EMLM_MASK) != 0U)
+    {
+        if ((nbytes & (DMA_NBYTES_MLOFFYES_SMLOE_MASK | DMA_NBYTES_MLOFFYES_DMLOE_MASK)) != 0U)
+        {
+            /* 20-bit signed offset in bits 10-29. */
+            mloff  = (int32_t)(nbytes << 2U) >> 12U;
+            nbytes = nbytes & DMA_NBYTES_MLOFFYES_NBYTES_MASK;
+        }
+        else
+        {
+            nbytes = nbytes & DMA_NBYTES_MLOFFNO_NBYTES_MASK;
+        }
+    }
+    flags = HOST_DmaCheck(&tcd, ssize, dsize, nbytes);
+    if (flags != 0U)
+    {
+        HOST_DmaError(channel, flags);
+        return cycles;
+    }
+
+    /* Reads of SSIZE and writes of DSIZE, packed through the buffer. */
+    while (written < nbytes)
+    {
+        if (filled < dsize)
+        {
+            if (!HOST_DmaRead(tcd.saddr, &buffer[filled], ssize))
+            {
+                HOST_DmaError(channel, DMA_ES_SBE_MASK);
+                return cycles;
+            }
+            filled += ssize;
+            tcd.saddr = HOST_DmaAdvance(tcd.saddr, tcd.soff, (tcd.attr & DMA_ATTR_SMOD_MASK) >> DMA_ATTR_SMOD_SHIFT);
+        }
+        else
+        {
+            if (!HOST_DmaWrite(tcd.daddr, buffer, dsize))
+            {
+                HOST_DmaError(channel, DMA_ES_DBE_MASK);
+                return cycles;
+            }
+            filled -= dsize;
+            (void)memmove(buffer, &buffer[dsize], filled);
+            written += dsize;
+            tcd.daddr = HOST_DmaAdvance(tcd.daddr, tcd.doff, (tcd.attr & DMA_ATTR_DMOD_MASK) >> DMA_ATTR_DMOD_SHIFT);
+        }
+        cycles += HOST_DMA_CYCLES_BEAT;
+    }
+
+    /* The minor loop offset is applied after every minor loop, the last one included. */
+    if ((tcd.nbytes & DMA_NBYTES_MLOFFYES_SMLOE_MASK) != 0U)
+    {
+        tcd.saddr += (uint32_t)mloff;
+    }
+    if ((tcd.nbytes & DMA_NBYTES_MLOFFYES_DMLOE_MASK) != 0U)
+    {
+        tcd.daddr += (uint32_t)mloff;
+    }
+
+    count = HOST_DmaGetCount(tcd.citer) - 1U;
+    if ((tcd.citer & DMA_CITER_ELINKYES_ELINK_MASK) != 0U)
+    {
+        tcd.citer = (uint16_t)((tcd.citer & (uint16_t)~DMA_CITER_ELINKYES_CITER_MASK) | count);
+    }
+    else
+    {
+        tcd.citer = (uint16_t)count;
+    }
+    if (((tcd.csr & DMA_CSR_INTHALF_MASK) != 0U) && (count == (HOST_DmaGetCount(tcd.biter) / 2U)))
+    {
+        HOST_DmaRaiseIRQ(channel);
+    }
+
+    if (count != 0U)
+    {
+        regs->saddr = tcd.saddr;
+        regs->daddr = tcd.daddr;
+        regs->citer = tcd.citer;
+        if ((tcd.citer & DMA_CITER_ELINKYES_ELINK_MASK) != 0U)
+        {
+            HOST_DmaLink((tcd.citer & DMA_CITER_ELINKYES_LINKCH_MASK) >> DMA_CITER_ELINKYES_LINKCH_SHIFT);
+        }
+        return cycles;
+    }
+
+    /* Major loop completion. */
+    cycles += HOST_DMA_CYCLES_MAJOR;
+    if ((tcd.csr & DMA_CSR_ESG_MASK) != 0U)
+    {
+        if (((uint32_t)tcd.dlastSga % sizeof(host_dma_tcd_t)) != 0U)
+        {
+            HOST_DmaError(channel, DMA_ES_SGE_MASK);
+            return cycles;
+        }
+        if (!HOST_DmaRead((uint32_t)tcd.dlastSga, &next, sizeof(next)))
+        {
+            HOST_DmaError(channel, DMA_ES_SBE_MASK);
+            return cycles;
+        }
+        cycles += HOST_DMA_CYCLES_SG_LOAD;
+        /* The loaded TCD reports the completion of the previous one. */
+        next.csr = (uint16_t)((next.csr & (uint16_t)~DMA_CSR_ACTIVE_MASK) | DMA_CSR_DONE_MASK);
+        (void)memcpy(regs, &next, sizeof(next));
+    }
+    else
+    {
+        regs->saddr = tcd.saddr + (uint32_t)tcd.slast;
+        regs->daddr = tcd.daddr + (uint32_t)tcd.dlastSga;
+        regs->citer = tcd.biter;
+        regs->csr |= DMA_CSR_DONE_MASK;
+    }
+    if ((tcd.csr & DMA_CSR_INTMAJOR_MASK) != 0U)
+    {
+        HOST_DmaRaiseIRQ(channel);
+    }
+    if ((tcd.csr & DMA_CSR_DREQ_MASK) != 0U)
+    {
+        s_dma->ERQ &= ~(1UL << channel);
+    }
+    if ((tcd.csr & DMA_CSR_MAJORELINK_MASK) != 0U)
+    {
+        HOST_DmaLink((tcd.csr & DMA_CSR_MAJORLINKCH_MASK) >> DMA_CSR_MAJORLINKCH_SHIFT);
+    }
+
+    return cycles;
+}
+
+static bool HOST_DmaIsRequested(uint32_t channel)
+{
+    uint32_t chcfg = s_dmamux->CHCFG[channel];
+
+    if ((s_tcd[channel].csr & DMA_CSR_START_MASK) != 0U)
+    {
+        return true;
+    }
+    if (((s_dma->ERQ & (1UL << channel)) == 0U) || ((chcfg & DMAMUX_CHCFG_ENBL_MASK) == 0U))
+    {
+        return false;
+    }
+
+    return ((chcfg & DMAMUX_CHCFG_A_ON_MASK) != 0U) || (s_requests[chcfg & DMAMUX_CHCFG_SOURCE_MASK] != 0U);
+}
+
+/* Fixed priority arbitration, group priority first. */
+static int32_t HOST_DmaArbitrate(void)
+{
+    const uint8_t *regs = (const uint8_t *)s_dma;
+    int32_t selected    = HOST_DMA_NO_CHANNEL;
+    uint32_t best       = 0U;
+    uint32_t priority;
+    uint32_t group;
+    uint32_t channel;
+
+    if ((s_dma->CR & DMA_CR_HALT_MASK) != 0U)
+    {
+        return HOST_DMA_NO_CHANNEL;
+    }
+    for (channel = 0U; channel < HOST_DMA_CHANNELS; channel++)
+    {
+        if (!HOST_DmaIsRequested(channel))
+        {
+            continue;
+        }
+        group    = (channel < 16U) ? ((s_dma->CR & DMA_CR_GRP0PRI_MASK) >> DMA_CR_GRP0PRI_SHIFT) :
+                                     ((s_dma->CR & DMA_CR_GRP1PRI_MASK) >> DMA_CR_GRP1PRI_SHIFT);
+        priority = ((group << 4U) | (regs[HOST_DMA_DCHPRI(channel)] & DMA_DCHPRI0_CHPRI_MASK)) + 1U;
+        if (priority > best)
+        {
+            best     = priority;
+            selected = (int32_t)channel;
+        }
+    }
+
+    return selected;
+}
+
+/* Applies a set/clear command to one channel or, with the all bit, to every channel. */
+static uint32_t HOST_DmaCommandMask(uint8_t command)
+{
+    if ((command & HOST_DMA_CMD_ALL_MASK) != 0U)
+    {
+        return 0xFFFFFFFFU;
+    }
+
+    return 1UL << (command & HOST_DMA_CMD_CH_MASK);
+}
+
+static void HOST_DmaCommand(uint32_t offset, uint8_t command)
+{
+    uint32_t mask = HOST_DmaCommandMask(command);
+    uint32_t channel;
+
+    if ((command & HOST_DMA_CMD_NOP_MASK) != 0U)
+    {
+        return;
+    }
+    switch (offset)
+    {
+        case HOST_DMA_REG(CEEI):
+            s_dma->EEI &= ~mask;
+            break;
+        case HOST_DMA_REG(SEEI):
+            s_dma->EEI |= mask;
+            break;
+        case HOST_DMA_REG(CERQ):
+            s_dma->ERQ &= ~mask;
+            break;
+        case HOST_DMA_REG(SERQ):
+            s_dma->ERQ |= mask;
+            break;
+        case HOST_DMA_REG(CERR):
+            s_dma->ERR &= ~mask;
+            break;
+        case HOST_DMA_REG(CINT):
+            s_dma->INT &= ~mask;
+            break;
+        default:
+            /* CDNE and SSRT act on the TCDs. */
+            for (channel = 0U; channel < HOST_DMA_CHANNELS; channel++)
+            {
+                if ((mask & (1UL << channel)) == 0U)
+                {
+                    continue;
+                }
+                if (offset == HOST_DMA_REG(CDNE))
+                {
+                    s_tcd[channel].csr &= (uint16_t)~DMA_CSR_DONE_MASK;
+                }
+                else
+                {
+                    s_tcd[channel].csr |= DMA_CSR_START_MASK;
+                }
+            }
+            break;
+    }
+}
+
+static uint32_t HOST_DmaPrevious32(const uint8_t *previous, uint32_t offset)
+{
+    uint32_t value;
+
+    (void)memcpy(&value, &previous[offset], sizeof(value));
+
+    return value;
+}
+
+static void HOST_DmaControlWrite(uint32_t offset, const uint8_t *previous, void *userData)
+{
+    uint8_t *regs = (uint8_t *)s_dma;
+    uint32_t index;
+
+    (void)userData;
+
+    /* Read-only registers keep their value. */
+    (void)memcpy(&regs[HOST_DMA_REG(ES)], &previous[HOST_DMA_REG(ES)], sizeof(uint32_t));
+    (void)memcpy(&regs[HOST_DMA_REG(HRS)], &previous[HOST_DMA_REG(HRS)], sizeof(uint32_t));
+    s_dma->CR = (s_dma->CR & ~(DMA_CR_ACTIVE_MASK | DMA_CR_CX_MASK | DMA_CR_ECX_MASK)) |
+                (HOST_DmaPrevious32(previous, HOST_DMA_REG(CR)) & DMA_CR_ACTIVE_MASK);
+
+    /* Command registers act on the written byte and read as 0. */
+    for (index = HOST_DMA_REG(CEEI); index <= HOST_DMA_REG(CINT); index++)
+    {
+        if ((index == offset) || (regs[index] != 0U))
+        {
+            HOST_DmaCommand(index, regs[index]);
+        }
+        regs[index] = 0U;
+    }
+
+    /* Status registers are write 1 to clear. */
+    if ((offset & ~3U) == HOST_DMA_REG(INT))
+    {
+        s_dma->INT = HOST_DmaPrevious32(previous, HOST_DMA_REG(INT)) & ~s_dma->INT;
+    }
+    if ((offset & ~3U) == HOST_DMA_REG(ERR))
+    {
+        s_dma->ERR = HOST_DmaPrevious32(previous, HOST_DMA_REG(ERR)) & ~s_dma->ERR;
+    }
+    if (s_dma->ERR == 0U)
+    {
+        HOST_DMA_ES &= ~DMA_ES_VLD_MASK;
+    }
+}
+
+static void HOST_DmaTcdWrite(uint32_t offset, const uint8_t *previous, void *userData)
+{
+    uint32_t channel        = offset / sizeof(host_dma_tcd_t);
+    const host_dma_tcd_t *p = (const host_dma_tcd_t *)(const void *)&previous[channel * sizeof(host_dma_tcd_t)];
+    uint16_t csr            = s_tcd[channel].csr;
+
+    (void)userData;
+    if (csr == p->csr)
+    {
+        return;
+    }
+
+    /* ACTIVE is read-only, DONE can only be cleared by the software. */
+    csr = (uint16_t)((csr & (uint16_t)~DMA_CSR_ACTIVE_MASK) | (p->csr & DMA_CSR_ACTIVE_MASK));
+    csr = (uint16_t)(csr & (p->csr | (uint16_t)~DMA_CSR_DONE_MASK));
+    /* ESG and MAJORELINK can not be changed while DONE stays set. */
+    if ((csr & DMA_CSR_DONE_MASK) != 0U)
+    {
+        csr = (uint16_t)((csr & (uint16_t)~(DMA_CSR_ESG_MASK | DMA_CSR_MAJORELINK_MASK)) |
+                         (p->csr & (DMA_CSR_ESG_MASK | DMA_CSR_MAJORELINK_MASK)));
+    }
+    s_tcd[channel].csr = csr;
+}
+
+void HOST_DmaInit(void)
+{
+    uint8_t *regs;
+    uint32_t channel;
+
+    s_dma    = (DMA_Type *)HOST_MmioAlias(DMA0_BASE);
+    s_tcd    = (host_dma_tcd_t *)HOST_MmioAlias(HOST_DMA_TCD_BASE);
+    s_dmamux = (DMAMUX_Type *)HOST_MmioAlias(DMAMUX_BASE);
+    assert((s_dma != NULL) && (s_dmamux != NULL));
+
+    /* Reset values: group 1 above group 0, channel n at priority n of its group. */
+    (void)memset(s_dma, 0, sizeof(*s_dma));
+    (void)memset(s_dmamux, 0, sizeof(*s_dmamux));
+    (void)memset((void *)s_requests, 0, sizeof(s_requests));
+    regs      = (uint8_t *)s_dma;
+    s_dma->CR = DMA_CR_GRP1PRI_MASK;
+    for (channel = 0U; channel < HOST_DMA_CHANNELS; channel++)
+    {
+        regs[HOST_DMA_DCHPRI(channel)] = (uint8_t)(channel % 16U);
+    }
+    s_cycles = 0U;
+
+    HOST_MmioTrap(DMA0_BASE, HOST_DMA_CONTROL_SIZE, NULL, HOST_DmaControlWrite, NULL);
+    HOST_MmioTrap(HOST_DMA_TCD_BASE, HOST_DMA_TCD_SIZE, NULL, HOST_DmaTcdWrite, NULL);
+}
+
+uint32_t HOST_DmaRun(uint32_t maxCycles)
+{
+    uint32_t spent = 0U;
+    uint32_t cycles;
+    int32_t channel;
+
+    /* An interrupt handler polling the engine does not reenter it. */
+    if (__atomic_exchange_n(&s_running, 1U, __ATOMIC_ACQUIRE) != 0U)
+    {
+        return 0U;
+    }
+    while (spent < maxCycles)
+    {
+        channel = HOST_DmaArbitrate();
+        if (channel == HOST_DMA_NO_CHANNEL)
+        {
+            break;
+        }
+        cycles = HOST_DmaService((uint32_t)channel);
+        spent += cycles;
+        s_cycles += cycles;
+        HOST_CoreDispatch();
+    }
+    __atomic_store_n(&s_running, 0U, __ATOMIC_RELEASE);
+
+    return spent;
+}
+
+uint64_t HOST_DmaGetCycles(void)
+{
+    return s_cycles;
+}
+
+void HOST_DmaSetRequest(uint32_t source, bool asserted)
+{
+    assert(source < HOST_DMA_SOURCES);
+
+    s_requests[source] = asserted ? 1U : 0U;
+}
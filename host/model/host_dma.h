@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_DMA_H_
+#define _HOST_DMA_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup host_dma
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @name Model cycle costs of the eDMA engine */
+/*@{*/
+#define HOST_DMA_CYCLES_ACTIVATE 4U /*!< Arbitration and TCD read of one channel service request. */
+#define HOST_DMA_CYCLES_BEAT     1U /*!< One read or one write beat of the element transfer. */
+#define HOST_DMA_CYCLES_MAJOR    2U /*!< Major loop completion, address adjustment or status write back. */
+#define HOST_DMA_CYCLES_SG_LOAD  8U /*!< Scatter/gather reload of the 32-byte TCD. */
+/*@}*/
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Resets the DMA0 and DMAMUX model and traps the DMA0 registers.
+ *
+ * HOST_CoreInit must be called first. The model implements:
+ * - the set/clear command registers (CEEI, SEEI, CERQ, SERQ, CDNE, SSRT, CERR, CINT), read as 0,
+ * - INT and ERR as write 1 to clear, ES and HRS as read-only, CR.EMLM minor loop mapping,
+ * - the TCD CSR rules: ESG and MAJORELINK can not be set while DONE is set, ACTIVE is read-only,
+ *   START requests a service,
+ * - minor loops with SSIZE/DSIZE, SOFF/DOFF, SMOD/DMOD and the minor loop offset, the major loop completion
+ *   with SLAST/DLAST or the scatter/gather reload from DLAST_SGA, DONE, INTMAJOR/INTHALF, DREQ and the channel
+ *   links,
+ * - the channel requests routed by DMAMUX CHCFG, always-on or driven by HOST_DmaSetRequest.
+ * The channel interrupt goes to the NVIC model, DMA_ERROR when EEI is set.
+ */
+void HOST_DmaInit(void);
+
+/*!
+ * @brief Runs the eDMA engine.
+ *
+ * The engine services one minor loop at a time, highest channel priority first, and lets the core model take the
+ * raised interrupts between two minor loops.
+ *
+ * @param maxCycles Cycle budget, the engine stops at the first minor loop boundary past it.
+ * @return Model cycles spent, 0 when no channel requests service.
+ */
+uint32_t HOST_DmaRun(uint32_t maxCycles);
+
+/*!
+ * @brief Gets the model cycles spent by the engine since HOST_DmaInit.
+ */
+uint64_t HOST_DmaGetCycles(void);
+
+/*!
+ * @brief Drives a DMAMUX request source.
+ *
+ * @param source DMAMUX source number, see dma_request_source_t.
+ * @param asserted true while the peripheral requests service.
+ */
+void HOST_DmaSetRequest(uint32_t source, bool asserted);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _HOST_DMA_H_ */
@@ -0,0 +1,367 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include "fsl_device_registers.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_lpuart.h"
+#include "host_mmio.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_LPUART_REG(reg) offsetof(LPUART_Type, reg)
+/* VERID and PARAM are read-only for the CPU only. */
+#define HOST_LPUART_VERID(regs) (*(volatile uint32_t *)(uintptr_t)&(regs)->VERID)
+#define HOST_LPUART_PARAM(regs) (*(volatile uint32_t *)(uintptr_t)&(regs)->PARAM)
+/* Reset values: version 4.1.3, FIFOs of 4 characters, transmitter idle, receive FIFO empty. */
+#define HOST_LPUART_VERID_RESET 0x04010003U
+#define HOST_LPUART_PARAM_RESET (LPUART_PARAM_TXFIFO(2U) | LPUART_PARAM_RXFIFO(2U))
+#define HOST_LPUART_FIFO_SIZES  (LPUART_FIFO_TXFIFOSIZE(1U) | LPUART_FIFO_RXFIFOSIZE(1U))
+/* STAT bits set by the model from its state, and the ones the software clears by writing 1. */
+#define HOST_LPUART_STAT_STATUS \
+    (LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK | LPUART_STAT_RDRF_MASK | LPUART_STAT_RAF_MASK)
+#define HOST_LPUART_STAT_W1C                                                                                       \
+    (LPUART_STAT_LBKDIF_MASK | LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_IDLE_MASK | LPUART_STAT_OR_MASK |            \
+     LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK | LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK)
+/* FIFO bits of the same kinds, the flush commands read as 0. */
+#define HOST_LPUART_FIFO_STATUS (LPUART_FIFO_TXEMPT_MASK | LPUART_FIFO_RXEMPT_MASK | HOST_LPUART_FIFO_SIZES)
+#define HOST_LPUART_FIFO_W1C    (LPUART_FIFO_TXOF_MASK | LPUART_FIFO_RXUF_MASK)
+
+/*! @brief State of one LPUART behind its registers. */
+typedef struct _host_lpuart
+{
+    LPUART_Type *regs;
+    int32_t irq;
+    uint32_t txSource;
+    uint32_t rxSource;
+    uint8_t txFifo[HOST_LPUART_FIFO_DEPTH];
+    uint32_t txHead;
+    uint32_t txCount;
+    bool shifting;
+    uint8_t shifter;
+    uint8_t rxFifo[HOST_LPUART_FIFO_DEPTH];
+    uint32_t rxHead;
+    uint32_t rxCount;
+    bool idleArmed;
+    host_lpuart_sink_t sink;
+    void *sinkData;
+} host_lpuart_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static host_lpuart_t s_lpuart[HOST_LPUART_INSTANCES + 1U];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static host_lpuart_t *HOST_LpuartGet(uint32_t instance)
+{
+    assert((instance != 0U) && (instance <= HOST_LPUART_INSTANCES));
+
+    return &s_lpuart[instance];
+}
+
+static uint32_t HOST_LpuartPrevious32(const uint8_t *previous, uint32_t offset)
+{
+    uint32_t value;
+
+    (void)memcpy(&value, &previous[offset], sizeof(value));
+
+    return value;
+}
+
+/* Depth of a FIFO as seen by the software, 1 while the FIFO is disabled. */
+static uint32_t HOST_LpuartDepth(const host_lpuart_t *port, uint32_t enableMask)
+{
+    return ((port->regs->FIFO & enableMask) != 0U) ? HOST_LPUART_FIFO_DEPTH : 1U;
+}
+
+/* Rebuilds the status bits from the state, then drives the interrupt line and the DMA requests. */
+static void HOST_LpuartUpdate(host_lpuart_t *port)
+{
+    LPUART_Type *regs = port->regs;
+    uint32_t txWater  = (regs->WATER & LPUART_WATER_TXWATER_MASK) >> LPUART_WATER_TXWATER_SHIFT;
+    uint32_t rxWater  = (regs->WATER & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT;
+    uint32_t stat     = regs->STAT & ~HOST_LPUART_STAT_STATUS;
+    uint32_t fifo     = regs->FIFO & ~HOST_LPUART_FIFO_STATUS;
+    uint32_t enabled;
+    bool tdre;
+    bool rdrf;
+
+    /* Without the FIFOs the watermarks are 0, one character fills the buffer. */
+    if ((regs->FIFO & LPUART_FIFO_TXFE_MASK) == 0U)
+    {
+        txWater = 0U;
+    }
+    if ((regs->FIFO & LPUART_FIFO_RXFE_MASK) == 0U)
+    {
+        rxWater = 0U;
+    }
+    tdre = (port->txCount <= txWater);
+    rdrf = (port->rxCount > rxWater);
+
+    stat |= tdre ? LPUART_STAT_TDRE_MASK : 0U;
+    stat |= ((port->txCount == 0U) && !port->shifting) ? LPUART_STAT_TC_MASK : 0U;
+    stat |= rdrf ? LPUART_STAT_RDRF_MASK : 0U;
+    regs->STAT = stat;
+
+    fifo |= HOST_LPUART_FIFO_SIZES;
+    fifo |= (port->txCount == 0U) ? LPUART_FIFO_TXEMPT_MASK : 0U;
+    fifo |= (port->rxCount == 0U) ? LPUART_FIFO_RXEMPT_MASK : 0U;
+    regs->FIFO = fifo;
+
+    regs->WATER = (regs->WATER & (LPUART_WATER_TXWATER_MASK | LPUART_WATER_RXWATER_MASK)) |
+                  LPUART_WATER_TXCOUNT(port->txCount) | LPUART_WATER_RXCOUNT(port->rxCount);
+    regs->DATA  = (port->rxCount != 0U) ? port->rxFifo[port->rxHead] : LPUART_DATA_RXEMPT_MASK;
+
+    HOST_DmaSetRequest(port->txSource, ((regs->BAUD & LPUART_BAUD_TDMAE_MASK) != 0U) && tdre);
+    HOST_DmaSetRequest(port->rxSource, ((regs->BAUD & LPUART_BAUD_RDMAE_MASK) != 0U) && rdrf);
+
+    /* The line is a level, it pends the interrupt again as long as a handler leaves it asserted. */
+    enabled = 0U;
+    enabled |= ((regs->CTRL & LPUART_CTRL_TIE_MASK) != 0U) ? LPUART_STAT_TDRE_MASK : 0U;
+    enabled |= ((regs->CTRL & LPUART_CTRL_TCIE_MASK) != 0U) ? LPUART_STAT_TC_MASK : 0U;
+    enabled |= ((regs->CTRL & LPUART_CTRL_RIE_MASK) != 0U) ? LPUART_STAT_RDRF_MASK : 0U;
+    enabled |= ((regs->CTRL & LPUART_CTRL_ILIE_MASK) != 0U) ? LPUART_STAT_IDLE_MASK : 0U;
+    enabled |= ((regs->CTRL & LPUART_CTRL_ORIE_MASK) != 0U) ? LPUART_STAT_OR_MASK : 0U;
+    if (((stat & enabled) != 0U) || (((regs->FIFO & LPUART_FIFO_TXOFE_MASK) != 0U) &&
+                                     ((regs->FIFO & LPUART_FIFO_TXOF_MASK) != 0U)))
+    {
+        HOST_CoreSetPendingIRQ(port->irq);
+    }
+}
+
+static void HOST_LpuartReset(host_lpuart_t *port)
+{
+    LPUART_Type *regs = port->regs;
+    uint32_t global   = regs->GLOBAL;
+
+    (void)memset(regs, 0, sizeof(*regs));
+    regs->GLOBAL            = global;
+    HOST_LPUART_VERID(regs) = HOST_LPUART_VERID_RESET;
+    HOST_LPUART_PARAM(regs) = HOST_LPUART_PARAM_RESET;
+    regs->BAUD              = LPUART_BAUD_OSR(15U) | LPUART_BAUD_SBR(4U);
+    port->txHead            = 0U;
+    port->txCount           = 0U;
+    port->shifting          = false;
+    port->rxHead            = 0U;
+    port->rxCount           = 0U;
+    port->idleArmed         = false;
+    HOST_LpuartUpdate(port);
+}
+
+/* Moves the next character of the FIFO to the idle shift register. */
+static void HOST_LpuartLoadShifter(host_lpuart_t *port)
+{
+    if (port->shifting || (port->txCount == 0U) || ((port->regs->CTRL & LPUART_CTRL_TE_MASK) == 0U))
+    {
+        return;
+    }
+    port->shifter  = port->txFifo[port->txHead];
+    port->shifting = true;
+    port->txHead   = (port->txHead + 1U) % HOST_LPUART_FIFO_DEPTH;
+    port->txCount--;
+}
+
+static void HOST_LpuartTransmit(host_lpuart_t *port, uint8_t data)
+{
+    if (port->txCount == HOST_LpuartDepth(port, LPUART_FIFO_TXFE_MASK))
+    {
+        port->regs->FIFO |= LPUART_FIFO_TXOF_MASK;
+        return;
+    }
+    port->txFifo[(port->txHead + port->txCount) % HOST_LPUART_FIFO_DEPTH] = data;
+    port->txCount++;
+    HOST_LpuartLoadShifter(port);
+}
+
+/* A DATA read pops the receive FIFO, the access returns the popped character. */
+static void HOST_LpuartRead(uint32_t offset, void *userData)
+{
+    host_lpuart_t *port = (host_lpuart_t *)userData;
+    uint32_t data;
+
+    if ((offset & ~3U) != HOST_LPUART_REG(DATA))
+    {
+        return;
+    }
+    data = (port->rxCount != 0U) ? port->rxFifo[port->rxHead] : LPUART_DATA_RXEMPT_MASK;
+    if (port->rxCount != 0U)
+    {
+        port->rxHead = (port->rxHead + 1U) % HOST_LPUART_FIFO_DEPTH;
+        port->rxCount--;
+    }
+    /* The status moves on to the next character, this access still returns the popped one. */
+    HOST_LpuartUpdate(port);
+    port->regs->DATA = data;
+}
+
+static void HOST_LpuartWrite(uint32_t offset, const uint8_t *previous, void *userData)
+{
+    host_lpuart_t *port = (host_lpuart_t *)userData;
+    LPUART_Type *regs   = port->regs;
+    uint32_t value;
+
+    /* Read-only registers keep their value. */
+    HOST_LPUART_VERID(regs) = HOST_LpuartPrevious32(previous, HOST_LPUART_REG(VERID));
+    HOST_LPUART_PARAM(regs) = HOST_LpuartPrevious32(previous, HOST_LPUART_REG(PARAM));
+
+    switch (offset & ~3U)
+    {
+        case HOST_LPUART_REG(GLOBAL):
+            if ((regs->GLOBAL & LPUART_GLOBAL_RST_MASK) != 0U)
+            {
+                HOST_LpuartReset(port);
+            }
+            break;
+        case HOST_LPUART_REG(STAT):
+            value      = HOST_LpuartPrevious32(previous, HOST_LPUART_REG(STAT));
+            regs->STAT = (regs->STAT & ~(HOST_LPUART_STAT_STATUS | HOST_LPUART_STAT_W1C)) |
+                         (value & HOST_LPUART_STAT_W1C & ~regs->STAT);
+            break;
+        case HOST_LPUART_REG(DATA):
+            value = regs->DATA;
+            HOST_LpuartTransmit(port, (uint8_t)value);
+            break;
+        case HOST_LPUART_REG(FIFO):
+            value = regs->FIFO;
+            if ((value & LPUART_FIFO_TXFLUSH_MASK) != 0U)
+            {
+                port->txCount = 0U;
+            }
+            if ((value & LPUART_FIFO_RXFLUSH_MASK) != 0U)
+            {
+                port->rxCount = 0U;
+            }
+            regs->FIFO = (value & ~(LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK | HOST_LPUART_FIFO_W1C)) |
+                         (HOST_LpuartPrevious32(previous, HOST_LPUART_REG(FIFO)) & HOST_LPUART_FIFO_W1C & ~value);
+            break;
+        case HOST_LPUART_REG(CTRL):
+            HOST_LpuartLoadShifter(port);
+            break;
+        default:
+            /* BAUD, WATER, MATCH, MODIR and PINCFG are plain storage, the counts are rebuilt below. */
+            break;
+    }
+    HOST_LpuartUpdate(port);
+}
+
+void HOST_LpuartInit(void)
+{
+    static LPUART_Type *const s_bases[] = LPUART_BASE_PTRS;
+    static const IRQn_Type s_irqs[]     = LPUART_RX_TX_IRQS;
+    static const uint32_t s_txSources[] = {
+        0U,
+        (uint32_t)kDmaRequestMuxLPUART1Tx,
+        (uint32_t)kDmaRequestMuxLPUART2Tx,
+        (uint32_t)kDmaRequestMuxLPUART3Tx,
+        (uint32_t)kDmaRequestMuxLPUART4Tx,
+        (uint32_t)kDmaRequestMuxLPUART5Tx,
+        (uint32_t)kDmaRequestMuxLPUART6Tx,
+        (uint32_t)kDmaRequestMuxLPUART7Tx,
+        (uint32_t)kDmaRequestMuxLPUART8Tx,
+    };
+    host_lpuart_t *port;
+    uint32_t instance;
+
+    for (instance = 1U; instance <= HOST_LPUART_INSTANCES; instance++)
+    {
+        port = &s_lpuart[instance];
+        (void)memset(port, 0, sizeof(*port));
+        port->regs = (LPUART_Type *)HOST_MmioAlias((uint32_t)(uintptr_t)s_bases[instance]);
+        assert(port->regs != NULL);
+        port->irq = (int32_t)s_irqs[instance];
+        /* The receive request of every LPUART follows its transmit request. */
+        port->txSource     = s_txSources[instance] & DMAMUX_CHCFG_SOURCE_MASK;
+        port->rxSource     = port->txSource + 1U;
+        port->regs->GLOBAL = 0U;
+        HOST_LpuartReset(port);
+        HOST_MmioTrap((uint32_t)(uintptr_t)s_bases[instance], sizeof(LPUART_Type), HOST_LpuartRead, HOST_LpuartWrite,
+                      port);
+    }
+}
+
+void HOST_LpuartSetSink(uint32_t instance, host_lpuart_sink_t sink, void *userData)
+{
+    host_lpuart_t *port = HOST_LpuartGet(instance);
+
+    port->sink     = sink;
+    port->sinkData = userData;
+}
+
+uint32_t HOST_LpuartRun(uint32_t instance, uint32_t characters)
+{
+    host_lpuart_t *port = HOST_LpuartGet(instance);
+    uint32_t sent       = 0U;
+
+    while ((sent < characters) && port->shifting)
+    {
+        port->shifting = false;
+        if (port->sink != NULL)
+        {
+            port->sink(instance, port->shifter, port->sinkData);
+        }
+        sent++;
+        HOST_LpuartLoadShifter(port);
+        HOST_LpuartUpdate(port);
+        HOST_CoreDispatch();
+    }
+
+    return sent;
+}
+
+bool HOST_LpuartReceive(uint32_t instance, uint8_t data)
+{
+    host_lpuart_t *port = HOST_LpuartGet(instance);
+    bool received       = false;
+
+    if ((port->regs->CTRL & LPUART_CTRL_RE_MASK) != 0U)
+    {
+        port->idleArmed = true;
+        /* While OR is set the received characters are discarded. */
+        if ((port->rxCount == HOST_LpuartDepth(port, LPUART_FIFO_RXFE_MASK)) ||
+            ((port->regs->STAT & LPUART_STAT_OR_MASK) != 0U))
+        {
+            port->regs->STAT |= LPUART_STAT_OR_MASK;
+        }
+        else
+        {
+            port->rxFifo[(port->rxHead + port->rxCount) % HOST_LPUART_FIFO_DEPTH] = data;
+            port->rxCount++;
+            received = true;
+        }
+        HOST_LpuartUpdate(port);
+        HOST_CoreDispatch();
+    }
+
+    return received;
+}
+
+void HOST_LpuartSetLineIdle(uint32_t instance)
+{
+    host_lpuart_t *port = HOST_LpuartGet(instance);
+
+    if (port->idleArmed)
+    {
+        port->idleArmed = false;
+        port->regs->STAT |= LPUART_STAT_IDLE_MASK;
+        HOST_LpuartUpdate(port);
+        HOST_CoreDispatch();
+    }
+}
+
+uint32_t HOST_LpuartGetTxPending(uint32_t instance)
+{
+    host_lpuart_t *port = HOST_LpuartGet(instance);
+
+    return port->txCount + (port->shifting ? 1U : 0U);
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_LPUART_H_
+#define _HOST_LPUART_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup host_lpuart
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Number of LPUART instances, LPUART1 to LPUART8, the instance number is the one of LPUART_GetInstance. */
+#define HOST_LPUART_INSTANCES 8U
+/*! @brief Depth of the transmit and receive FIFOs. */
+#define HOST_LPUART_FIFO_DEPTH 4U
+
+/*!
+ * @brief Called for every character that leaves the transmitter.
+ *
+ * @param instance LPUART instance, 1 to HOST_LPUART_INSTANCES.
+ * @param data Character.
+ * @param userData Parameter passed to HOST_LpuartSetSink.
+ */
+typedef void (*host_lpuart_sink_t)(uint32_t instance, uint8_t data, void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Resets the LPUART models and traps their registers.
+ *
+ * HOST_CoreInit must be called first. The model implements, for 8-bit characters:
+ * - GLOBAL.RST, the transmit and receive FIFOs with their watermarks, counts, flush commands and TXOF,
+ * - STAT TDRE/TC/RDRF as read-only status, IDLE and OR as write 1 to clear,
+ * - DATA reads popping the receive FIFO, RXEMPT when it is empty,
+ * - the TIE/TCIE/RIE/ILIE/ORIE interrupts to the NVIC model and the TDMAE/RDMAE requests to the DMAMUX model.
+ * An interrupt raised by a CPU register write is taken at the next HOST_CoreDispatch, for example the next engine
+ * step or character time.
+ */
+void HOST_LpuartInit(void);
+
+/*!
+ * @brief Sets the receiver of the transmitted characters.
+ *
+ * @param instance LPUART instance.
+ * @param sink Called for every transmitted character, NULL to discard them.
+ * @param userData Parameter of the sink.
+ */
+void HOST_LpuartSetSink(uint32_t instance, host_lpuart_sink_t sink, void *userData);
+
+/*!
+ * @brief Runs the transmitter for a number of character times.
+ *
+ * Every character time shifts out the character in the shift register and loads the next one from the FIFO. The
+ * core model takes the raised interrupts after each character.
+ *
+ * @param instance LPUART instance.
+ * @param characters Number of character times.
+ * @return Number of characters sent, lower when the transmitter ran out of data.
+ */
+uint32_t HOST_LpuartRun(uint32_t instance, uint32_t characters);
+
+/*!
+ * @brief Receives one character from the line.
+ *
+ * @param instance LPUART instance.
+ * @param data Character.
+ * @return false when the character is lost: the receiver is disabled or the FIFO is full, which sets OR.
+ */
+bool HOST_LpuartReceive(uint32_t instance, uint8_t data);
+
+/*!
+ * @brief Keeps the receive line idle for a frame time, IDLE is set once after the last received character.
+ *
+ * @param instance LPUART instance.
+ */
+void HOST_LpuartSetLineIdle(uint32_t instance);
+
+/*!
+ * @brief Gets the number of characters the transmitter still holds, in the FIFO and the shift register.
+ *
+ * @param instance LPUART instance.
+ */
+uint32_t HOST_LpuartGetTxPending(uint32_t instance);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _HOST_LPUART_H_ */
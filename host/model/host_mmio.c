@@ -0,0 +1,310 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "host_mmio.h"
+
+#if !(defined(__linux__) && defined(__x86_64__))
+#error "The register model traps the accesses with x86-64 Linux page faults and single steps."
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_MMIO_MAX_REGIONS 16U
+/* EFLAGS trap flag, the CPU stops after the next instruction. */
+#define HOST_MMIO_TRAP_FLAG 0x100
+/* Page fault error code bit set by write accesses. */
+#define HOST_MMIO_WRITE_FAULT 0x2
+/* Unused private peripheral bus page, trapped without hooks to measure the trap cost. */
+#define HOST_MMIO_CALIBRATION_PAGE (HOST_MMIO_PPB_BASE + 0xF000U)
+#define HOST_MMIO_CALIBRATION_ACCESSES 100U
+#define HOST_MMIO_CALIBRATION_ROUNDS   64U
+
+typedef struct _host_mmio_region
+{
+    uint32_t base;           /* Region base address. */
+    uint32_t size;           /* Region size in bytes. */
+    host_mmio_read_t read;   /* Read hook. */
+    host_mmio_write_t write; /* Write hook. */
+    void *userData;          /* Parameter of the hooks. */
+} host_mmio_region_t;
+
+/* The access being single stepped, there is at most one as the model tick signal is blocked meanwhile. */
+typedef struct _host_mmio_step
+{
+    const host_mmio_region_t *region; /* Region of the access, NULL when no access is stepped. */
+    uint32_t offset;                  /* Offset of the access in the region. */
+    bool write;                       /* The fault was raised by a write. */
+    sigset_t mask;                    /* Signal mask of the interrupted code. */
+} host_mmio_step_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static host_mmio_region_t s_regions[HOST_MMIO_MAX_REGIONS];
+static uint32_t s_regionCount;
+static uint8_t *s_alias;
+static host_mmio_step_t s_step;
+static uint8_t s_previous[HOST_MMIO_PAGE_SIZE];
+static volatile uint64_t s_trapCount;
+static uint32_t s_trapCost;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static const host_mmio_region_t *HOST_MmioFindRegion(uintptr_t address)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_regionCount; i++)
+    {
+        if ((address >= s_regions[i].base) && (address < (s_regions[i].base + HOST_MMIO_PAGE_SIZE)))
+        {
+            return &s_regions[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Regions without read hook are only trapped on writes. */
+static int HOST_MmioGetProtection(const host_mmio_region_t *region)
+{
+    return (region->read == NULL) ? PROT_READ : PROT_NONE;
+}
+
+static void HOST_MmioFault(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc    = (ucontext_t *)context;
+    uintptr_t address = (uintptr_t)info->si_addr;
+    const host_mmio_region_t *region;
+    char message[64];
+
+    (void)signal;
+    region = HOST_MmioFindRegion(address);
+    if ((region == NULL) || (s_step.region != NULL))
+    {
+        /* Not a register access, let the fault kill the process where it happened. */
+        (void)snprintf(message, sizeof(message), "host_mmio: fault at %p\n", info->si_addr);
+        (void)write(STDERR_FILENO, message, strlen(message));
+        (void)sigaction(SIGSEGV, &(struct sigaction){.sa_handler = SIG_DFL}, NULL);
+        return;
+    }
+
+    s_step.region = region;
+    s_step.offset = (uint32_t)(address - region->base);
+    s_step.write  = (uc->uc_mcontext.gregs[REG_ERR] & HOST_MMIO_WRITE_FAULT) != 0;
+    if ((!s_step.write) && (region->read != NULL) && (s_step.offset < region->size))
+    {
+        region->read(s_step.offset, region->userData);
+    }
+    (void)memcpy(s_previous, HOST_MmioAlias(region->base), region->size);
+
+    /* Let the access through, then stop right after it. The model tick stays blocked until then. */
+    (void)mprotect((void *)(uintptr_t)region->base, HOST_MMIO_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    s_step.mask = uc->uc_sigmask;
+    (void)sigaddset(&uc->uc_sigmask, SIGALRM);
+    uc->uc_mcontext.gregs[REG_EFL] |= HOST_MMIO_TRAP_FLAG;
+}
+
+static void HOST_MmioStep(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc                   = (ucontext_t *)context;
+    const host_mmio_region_t *region = s_step.region;
+
+    (void)signal;
+    (void)info;
+    if (region == NULL)
+    {
+        /* Not a stepped access, a breakpoint of a debugger for example. */
+        (void)sigaction(SIGTRAP, &(struct sigaction){.sa_handler = SIG_DFL}, NULL);
+        return;
+    }
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)HOST_MMIO_TRAP_FLAG;
+    uc->uc_sigmask = s_step.mask;
+    (void)mprotect((void *)(uintptr_t)region->base, HOST_MMIO_PAGE_SIZE, HOST_MmioGetProtection(region));
+    s_step.region = NULL;
+    s_trapCount++;
+
+    /* A read-modify-write instruction faults as a read, it is recognized by the changed storage. */
+    if ((region->write != NULL) && (s_step.offset < region->size) &&
+        (s_step.write || (memcmp(s_previous, HOST_MmioAlias(region->base), region->size) != 0)))
+    {
+        region->write(s_step.offset, s_previous, region->userData);
+    }
+}
+
+static uint64_t HOST_MmioGetTimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t HOST_MmioCalibrate(void)
+{
+    volatile uint32_t *reg = (volatile uint32_t *)(uintptr_t)HOST_MMIO_CALIBRATION_PAGE;
+    uint64_t best          = UINT64_MAX;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t round;
+    uint32_t i;
+
+    HOST_MmioTrap(HOST_MMIO_CALIBRATION_PAGE, sizeof(uint32_t), NULL, NULL, NULL);
+    /* The fastest round is the one least disturbed by the rest of the system, so the cost is a lower bound. */
+    for (round = 0U; round < HOST_MMIO_CALIBRATION_ROUNDS; round++)
+    {
+        start = HOST_MmioGetTimeNs();
+        for (i = 0U; i < HOST_MMIO_CALIBRATION_ACCESSES; i++)
+        {
+            *reg = i;
+        }
+        elapsed = HOST_MmioGetTimeNs() - start;
+        best    = (elapsed < best) ? elapsed : best;
+    }
+    s_trapCount = 0U;
+
+    return (uint32_t)(best / HOST_MMIO_CALIBRATION_ACCESSES);
+}
+
+void HOST_MmioInit(void)
+{
+    struct sigaction action;
+    void *window;
+    int fd;
+
+    assert(s_alias == NULL);
+
+    /* One memory file holds both windows, mapped at the device addresses and once more for the models. */
+    fd = memfd_create("host_mmio", 0);
+    if ((fd < 0) || (ftruncate(fd, (off_t)HOST_MMIO_PERIPHERAL_SIZE + HOST_MMIO_PPB_SIZE) != 0))
+    {
+        perror("host_mmio: register storage");
+        exit(EXIT_FAILURE);
+    }
+    window = mmap((void *)(uintptr_t)HOST_MMIO_PERIPHERAL_BASE, HOST_MMIO_PERIPHERAL_SIZE, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+    if (window != (void *)(uintptr_t)HOST_MMIO_PERIPHERAL_BASE)
+    {
+        perror("host_mmio: peripheral window");
+        exit(EXIT_FAILURE);
+    }
+    window = mmap((void *)(uintptr_t)HOST_MMIO_PPB_BASE, HOST_MMIO_PPB_SIZE, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_FIXED_NOREPLACE, fd, HOST_MMIO_PERIPHERAL_SIZE);
+    if (window != (void *)(uintptr_t)HOST_MMIO_PPB_BASE)
+    {
+        perror("host_mmio: private peripheral bus window");
+        exit(EXIT_FAILURE);
+    }
+    s_alias = mmap(NULL, HOST_MMIO_PERIPHERAL_SIZE + HOST_MMIO_PPB_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (s_alias == MAP_FAILED)
+    {
+        perror("host_mmio: register alias");
+        exit(EXIT_FAILURE);
+    }
+    (void)close(fd);
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaddset(&action.sa_mask, SIGALRM);
+    action.sa_sigaction = HOST_MmioFault;
+    (void)sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = HOST_MmioStep;
+    (void)sigaction(SIGTRAP, &action, NULL);
+
+    s_trapCost = HOST_MmioCalibrate();
+}
+
+void HOST_MmioTrap(uint32_t base, uint32_t size, host_mmio_read_t read, host_mmio_write_t write, void *userData)
+{
+    host_mmio_region_t *region;
+
+    assert(s_alias != NULL);
+    assert((base & (HOST_MMIO_PAGE_SIZE - 1U)) == 0U);
+    assert((size != 0U) && (size <= HOST_MMIO_PAGE_SIZE));
+    assert(HOST_MmioAlias(base) != NULL);
+    assert(HOST_MmioFindRegion(base) == NULL);
+    assert(s_regionCount < HOST_MMIO_MAX_REGIONS);
+
+    region  = &s_regions[s_regionCount];
+    *region = (host_mmio_region_t){base, size, read, write, userData};
+    s_regionCount++;
+    if (mprotect((void *)(uintptr_t)base, HOST_MMIO_PAGE_SIZE, HOST_MmioGetProtection(region)) != 0)
+    {
+        perror("host_mmio: trap");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void *HOST_MmioAlias(uint32_t address)
+{
+    if ((address >= HOST_MMIO_PERIPHERAL_BASE) && (address - HOST_MMIO_PERIPHERAL_BASE < HOST_MMIO_PERIPHERAL_SIZE))
+    {
+        return &s_alias[address - HOST_MMIO_PERIPHERAL_BASE];
+    }
+    if ((address >= HOST_MMIO_PPB_BASE) && (address - HOST_MMIO_PPB_BASE < HOST_MMIO_PPB_SIZE))
+    {
+        return &s_alias[HOST_MMIO_PERIPHERAL_SIZE + (address - HOST_MMIO_PPB_BASE)];
+    }
+
+    return NULL;
+}
+
+void HOST_MmioBusRead(uint32_t address, void *data, uint32_t size)
+{
+    const host_mmio_region_t *region = HOST_MmioFindRegion(address);
+
+    assert(HOST_MmioAlias(address) != NULL);
+
+    if ((region != NULL) && (region->read != NULL) && ((address - region->base) < region->size))
+    {
+        region->read(address - region->base, region->userData);
+    }
+    (void)memcpy(data, HOST_MmioAlias(address), size);
+}
+
+void HOST_MmioBusWrite(uint32_t address, const void *data, uint32_t size)
+{
+    const host_mmio_region_t *region = HOST_MmioFindRegion(address);
+    uint8_t previous[HOST_MMIO_PAGE_SIZE];
+
+    assert(HOST_MmioAlias(address) != NULL);
+
+    if ((region != NULL) && (region->write != NULL) && ((address - region->base) < region->size))
+    {
+        (void)memcpy(previous, HOST_MmioAlias(region->base), region->size);
+        (void)memcpy(HOST_MmioAlias(address), data, size);
+        region->write(address - region->base, previous, region->userData);
+    }
+    else
+    {
+        (void)memcpy(HOST_MmioAlias(address), data, size);
+    }
+}
+
+uint64_t HOST_MmioGetTrapCount(void)
+{
+    return s_trapCount;
+}
+
+uint32_t HOST_MmioGetTrapCost(void)
+{
+    return s_trapCost;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOST_MMIO_H_
+#define _HOST_MMIO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup host_mmio
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/*! @brief Peripheral window mapped at its device address, AIPS-1 to AIPS-4. */
+#define HOST_MMIO_PERIPHERAL_BASE 0x40000000U
+#define HOST_MMIO_PERIPHERAL_SIZE 0x00400000U
+/*! @brief Private peripheral bus window mapped at its device address: DWT, SysTick, NVIC and SCB. */
+#define HOST_MMIO_PPB_BASE 0xE0000000U
+#define HOST_MMIO_PPB_SIZE 0x00010000U
+/*! @brief Granularity of the trapped registers, one host page. */
+#define HOST_MMIO_PAGE_SIZE 0x1000U
+
+/*!
+ * @brief Called before a trapped register is read.
+ *
+ * The hook updates the register storage with the value the access returns, for example a FIFO pop.
+ *
+ * @param offset Offset of the accessed byte in the trapped region.
+ * @param userData Parameter passed to HOST_MmioTrap.
+ */
+typedef void (*host_mmio_read_t)(uint32_t offset, void *userData);
+
+/*!
+ * @brief Called after a trapped register is written.
+ *
+ * The storage already holds the written value, the hook applies the register semantics (write 1 to clear,
+ * commands, read-only bits) and leaves the value the next read returns in the storage.
+ *
+ * @param offset Offset of the accessed byte in the trapped region.
+ * @param previous Content of the whole region before the write, indexed by region offset.
+ * @param userData Parameter passed to HOST_MmioTrap.
+ */
+typedef void (*host_mmio_write_t)(uint32_t offset, const uint8_t *previous, void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Maps the peripheral windows at their device addresses.
+ *
+ * The windows are plain read/write memory until a region is trapped. The function also measures the cost of one
+ * trapped access, see HOST_MmioGetTrapCost.
+ */
+void HOST_MmioInit(void);
+
+/*!
+ * @brief Traps the accesses to a register region.
+ *
+ * Every CPU access to the region faults, the read hook runs before the access and the write hook after it. When
+ * there is no read hook, only the writes fault. The accesses of the models through HOST_MmioAlias do not fault.
+ *
+ * @param base Region base address, aligned to HOST_MMIO_PAGE_SIZE.
+ * @param size Region size, HOST_MMIO_PAGE_SIZE at most.
+ * @param read Read hook, NULL when reads have no side effect.
+ * @param write Write hook, NULL when the region is plain storage.
+ * @param userData Parameter of the hooks.
+ */
+void HOST_MmioTrap(uint32_t base, uint32_t size, host_mmio_read_t read, host_mmio_write_t write, void *userData);
+
+/*!
+ * @brief Gets the register storage behind a device address.
+ *
+ * @param address Device address in one of the windows.
+ * @return Pointer to the storage, NULL when the address is outside of the windows.
+ */
+void *HOST_MmioAlias(uint32_t address);
+
+/*!
+ * @brief Reads registers the way a bus master does, with the side effects of a CPU read.
+ *
+ * @param address Device address in one of the windows.
+ * @param data Buffer of size bytes.
+ * @param size Access size in bytes, the access does not cross a region.
+ */
+void HOST_MmioBusRead(uint32_t address, void *data, uint32_t size);
+
+/*!
+ * @brief Writes registers the way a bus master does, with the side effects of a CPU write.
+ *
+ * @param address Device address in one of the windows.
+ * @param data Buffer of size bytes.
+ * @param size Access size in bytes, the access does not cross a region.
+ */
+void HOST_MmioBusWrite(uint32_t address, const void *data, uint32_t size);
+
+/*!
+ * @brief Gets the number of trapped CPU accesses since HOST_MmioInit.
+ */
+uint64_t HOST_MmioGetTrapCount(void);
+
+/*!
+ * @brief Gets the host time of one trapped CPU access in ns.
+ *
+ * A trapped access costs two signals and two page protection changes, so timings of code that accesses registers
+ * subtract the trap count multiplied by this cost. The cost is the fastest one measured, the remaining time still
+ * includes the trap jitter.
+ */
+uint32_t HOST_MmioGetTrapCost(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*! @} */
+
+#endif /* _HOST_MMIO_H_ */
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * ADC_DecimatorProcess against a direct FIR computed on the whole input: random taps (1 to 37) with the extreme
+ * coefficients, decimation factors 1 to 7, every resolution and random block splits, so the results saturate and
+ * the phase and the history carry over between blocks. The outputs must match bit for bit. The program is built
+ * with the SMLALD kernel (the host computes the instruction in C) and with the portable kernel.
+ *
+ * Usage: adc_decimator_test [cases], 2000 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "adc_decimator.h"
+#include "host_core.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CASES        2000U
+#define TEST_MAX_TAPS     37U
+#define TEST_MAX_FACTOR   7U
+#define TEST_MAX_BLOCK    96U
+#define TEST_INPUTS       1024U
+/* Inputs of the throughput figure, 32 taps decimating by 4 as in the header figure. */
+#define TEST_BENCH_TAPS   32U
+#define TEST_BENCH_FACTOR 4U
+#define TEST_BENCH_BLOCK  512U
+#define TEST_BENCH_INPUTS (1024U * 1024U)
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static int16_t s_coefficients[TEST_MAX_TAPS];
+static int16_t s_state[ADC_DECIMATOR_STATE_SAMPLES(TEST_BENCH_TAPS, TEST_BENCH_BLOCK)];
+static uint16_t s_input[TEST_BENCH_BLOCK];
+static int16_t s_output[TEST_INPUTS];
+static int16_t s_ref[TEST_INPUTS];
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Q15 value of a result, the history before the first input is the mid-scale 0. */
+static int32_t TEST_Sample(const uint16_t *input, int32_t n, uint32_t resolution)
+{
+    return (n < 0) ? 0 : (int32_t)(int16_t)(uint16_t)(((uint32_t)input[n] << (16U - resolution)) ^ 0x8000U);
+}
+
+/* Direct FIR of the whole input, the output of input n is kept when n + 1 is a multiple of the factor. */
+static uint32_t TEST_Reference(const uint16_t *input, uint32_t count, uint32_t taps, uint32_t factor,
+                               uint32_t resolution)
+{
+    uint32_t outputs = 0U;
+    int64_t acc;
+    uint32_t n;
+    uint32_t k;
+
+    for (n = factor - 1U; n < count; n += factor)
+    {
+        acc = 0;
+        for (k = 0U; k < taps; k++)
+        {
+            acc += (int64_t)s_coefficients[k] * TEST_Sample(input, (int32_t)n - (int32_t)(taps - 1U - k), resolution);
+        }
+        acc >>= 15;
+        s_ref[outputs++] = (int16_t)((acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc));
+    }
+
+    return outputs;
+}
+
+static void TEST_Case(uint32_t index)
+{
+    static uint16_t input[TEST_INPUTS];
+    adc_decimator_config_t config;
+    adc_decimator_t decimator;
+    uint32_t taps       = 1U + (TEST_Random() % TEST_MAX_TAPS);
+    uint32_t factor     = 1U + (TEST_Random() % TEST_MAX_FACTOR);
+    uint32_t resolution = 8U + (TEST_Random() % 9U);
+    uint32_t expected;
+    uint32_t outputs = 0U;
+    uint32_t offset  = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    for (i = 0U; i < taps; i++)
+    {
+        /* One case in four takes only the extremes, the sums saturate on both sides. */
+        s_coefficients[i] = ((index % 4U) == 0U) ? (((TEST_Random() & 1U) != 0U) ? INT16_MAX : INT16_MIN) :
+                                                   (int16_t)TEST_Random();
+    }
+    for (i = 0U; i < TEST_INPUTS; i++)
+    {
+        input[i] = (uint16_t)(TEST_Random() & ((1UL << resolution) - 1U));
+    }
+    expected = TEST_Reference(input, TEST_INPUTS, taps, factor, resolution);
+
+    ADC_DecimatorGetDefaultConfig(&config);
+    config.coefficients = s_coefficients;
+    config.taps         = taps;
+    config.factor       = factor;
+    config.resolution   = resolution;
+    config.state        = s_state;
+    config.maxBlock     = TEST_MAX_BLOCK;
+    ADC_DecimatorInit(&decimator, &config);
+
+    /* Blocks of 0 to TEST_MAX_BLOCK inputs, as the DMA halves of any length. */
+    while (offset < TEST_INPUTS)
+    {
+        block = TEST_Random() % (TEST_MAX_BLOCK + 1U);
+        if (block > (TEST_INPUTS - offset))
+        {
+            block = TEST_INPUTS - offset;
+        }
+        TEST_CHECK(outputs + ADC_DECIMATOR_OUTPUT_SAMPLES(block, factor) <= TEST_INPUTS);
+        outputs += ADC_DecimatorProcess(&decimator, &input[offset], block, &s_output[outputs]);
+        offset += block;
+    }
+
+    TEST_CHECK(expected == outputs);
+    for (i = 0U; i < outputs; i++)
+    {
+        if (s_output[i] != s_ref[i])
+        {
+            (void)printf("case %u, %u taps, factor %u, %u bits: output %u is %d, the direct FIR gives %d\n", index,
+                         taps, factor, resolution, i, s_output[i], s_ref[i]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    /* After a reset the filter starts over as on the first block. */
+    ADC_DecimatorReset(&decimator);
+    block   = (TEST_MAX_BLOCK < TEST_INPUTS) ? TEST_MAX_BLOCK : TEST_INPUTS;
+    outputs = ADC_DecimatorProcess(&decimator, input, block, s_output);
+    TEST_CHECK(outputs == TEST_Reference(input, block, taps, factor, resolution));
+    for (i = 0U; i < outputs; i++)
+    {
+        TEST_CHECK(s_output[i] == s_ref[i]);
+    }
+}
+
+/* Host ns per input of the kernel that was built, a relative figure: the host runs the SMLALD in C. */
+static double TEST_Bench(void)
+{
+    adc_decimator_config_t config;
+    adc_decimator_t decimator;
+    uint64_t start;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BENCH_TAPS; i++)
+    {
+        s_coefficients[i] = (int16_t)(1024 + (int32_t)(TEST_Random() % 1024U));
+    }
+    for (i = 0U; i < TEST_BENCH_BLOCK; i++)
+    {
+        s_input[i] = (uint16_t)(TEST_Random() & 0xFFFU);
+    }
+
+    ADC_DecimatorGetDefaultConfig(&config);
+    config.coefficients = s_coefficients;
+    config.taps         = TEST_BENCH_TAPS;
+    config.factor       = TEST_BENCH_FACTOR;
+    config.state        = s_state;
+    config.maxBlock     = TEST_BENCH_BLOCK;
+    ADC_DecimatorInit(&decimator, &config);
+
+    start = HOST_CoreGetTimeNs();
+    for (i = 0U; i < (TEST_BENCH_INPUTS / TEST_BENCH_BLOCK); i++)
+    {
+        (void)ADC_DecimatorProcess(&decimator, s_input, TEST_BENCH_BLOCK, s_output);
+    }
+
+    return (double)(HOST_CoreGetTimeNs() - start) / (double)TEST_BENCH_INPUTS;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t cases = TEST_CASES;
+    uint32_t i;
+
+    if (argc > 1)
+    {
+        cases = (uint32_t)strtoul(argv[1], NULL, 0);
+        TEST_CHECK(cases != 0U);
+    }
+
+    for (i = 0U; i < cases; i++)
+    {
+        TEST_Case(i);
+    }
+
+    (void)printf("ADC decimator, %s kernel: %u cases bit exact with the direct FIR\n",
+                 (ADC_DECIMATOR_USE_DSP != 0) ? "SMLALD" : "portable", cases);
+    (void)printf("%u taps, factor %u: %.2f host ns per input\n", TEST_BENCH_TAPS, TEST_BENCH_FACTOR, TEST_Bench());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,359 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * The interleaved capture of adc_with_dma on the DMA0 model. ADC_InterleaveCreate runs unmodified, the PWM, XBARA,
+ * ADC and ADC_ETC registers are plain memory: the test writes the ADC results and raises the ADC DMA requests
+ * itself, one conversion at a time. ADC1 converts the even samples of a ramp and ADC2 the odd ones, so the merged
+ * stream must be the ramp again, half after half, also when ADC2 completes its half before ADC1. With ADC2 off by
+ * a 0.97 gain and 12 LSB, the correction computed from two levels must bring the stream back within 1 LSB.
+ *
+ * ADC_InterleaveComputeCorrection and ADC_InterleaveMerge are also checked alone: random gain and offset mismatches
+ * corrected within 1 LSB over the whole range, the clamping at 0 and the largest sample, the rejected levels.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "adc_interleave.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CLOCK_HZ     150000000U
+#define TEST_RATE_HZ      1000000U
+#define TEST_FRAMES       24U
+#define TEST_HALVES       16U
+#define TEST_RESOLUTION   12U
+#define TEST_MAX_VALUE    ((1U << TEST_RESOLUTION) - 1U)
+/* First sample of the ramp, the mismatched ADC2 results stay in range. */
+#define TEST_RAMP_START   1000U
+/* Mismatch of ADC2 in the capture runs. */
+#define TEST_GAIN         0.97
+#define TEST_OFFSET       12.0
+/* Calibration levels and number of conversions of each sum. */
+#define TEST_LEVEL_LOW    512U
+#define TEST_LEVEL_HIGH   3584U
+#define TEST_LEVEL_COUNT  256U
+#define TEST_MATCH_CASES  200U
+#define TEST_CLAMP_FRAMES 1024U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static adc_interleave_handle_t s_handle;
+/* The driver passes addresses as uint32_t, the buffers are static to stay below 4 GB. */
+SDK_ALIGN(static uint16_t s_capture1[ADC_INTERLEAVE_CAPTURE_SAMPLES(TEST_FRAMES)], 32U);
+SDK_ALIGN(static uint16_t s_capture2[ADC_INTERLEAVE_CAPTURE_SAMPLES(TEST_FRAMES)], 32U);
+static uint16_t s_output[ADC_INTERLEAVE_OUTPUT_SAMPLES(TEST_FRAMES)];
+
+static uint16_t s_first[TEST_MAX_VALUE + 1U];
+static uint16_t s_second[TEST_MAX_VALUE + 1U];
+static uint16_t s_merged[2U * (TEST_MAX_VALUE + 1U)];
+
+/* Merged halves checked by the callback and the largest ADC2 error it found. */
+static uint32_t s_halves;
+static uint32_t s_tolerance;
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* The CCM is not modelled, the IPG clock is fixed. */
+uint32_t CLOCK_GetFreq(clock_name_t name)
+{
+    (void)name;
+
+    return TEST_CLOCK_HZ;
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Result of an ADC with the given gain and offset for the input x, in the range of the results. */
+static uint16_t TEST_Mismatch(uint32_t x, double gain, double offset)
+{
+    double value = floor((gain * (double)x) + offset + 0.5);
+
+    return (uint16_t)((value < 0.0) ? 0.0 : ((value > (double)TEST_MAX_VALUE) ? (double)TEST_MAX_VALUE : value));
+}
+
+/* Correction of an ADC with the given mismatch, from the noisy sums of two levels: the mean has sub-LSB detail. */
+static status_t TEST_Calibrate(
+    uint32_t low, uint32_t high, double gain, double offset, adc_interleave_correction_t *correction)
+{
+    uint32_t reference[2] = {low * TEST_LEVEL_COUNT, high * TEST_LEVEL_COUNT};
+    uint32_t measured[2];
+
+    measured[0] = (uint32_t)floor((((gain * (double)low) + offset) * (double)TEST_LEVEL_COUNT) + 0.5);
+    measured[1] = (uint32_t)floor((((gain * (double)high) + offset) * (double)TEST_LEVEL_COUNT) + 0.5);
+
+    return ADC_InterleaveComputeCorrection(reference, measured, TEST_LEVEL_COUNT, correction);
+}
+
+static void TEST_Callback(adc_interleave_handle_t *handle, const uint16_t *samples, uint32_t count, void *userData)
+{
+    uint32_t expected;
+    uint32_t error;
+    uint32_t i;
+
+    (void)userData;
+    TEST_CHECK(handle == &s_handle);
+    TEST_CHECK(count == (ADC_INTERLEAVE_ADC_COUNT * TEST_FRAMES));
+    TEST_CHECK(samples == &s_output[(s_halves % 2U) * count]);
+    for (i = 0U; i < count; i++)
+    {
+        /* ADC1 has no correction, its samples are exact. */
+        expected = TEST_RAMP_START + (s_halves * count) + i;
+        error    = (samples[i] > expected) ? (samples[i] - expected) : (expected - samples[i]);
+        if ((error > 1U) || (((i % 2U) == 0U) && (error != 0U)))
+        {
+            (void)printf("half %u: merged sample %u is %u, the ramp is at %u\n", s_halves, i, samples[i], expected);
+            exit(EXIT_FAILURE);
+        }
+        s_tolerance = (error > s_tolerance) ? error : s_tolerance;
+    }
+    s_halves++;
+}
+
+/* One conversion: the result register, then the DMA request until the channel moved it. */
+static void TEST_Convert(uint32_t adc, uint16_t result)
+{
+    ADC_Type *const bases[ADC_INTERLEAVE_ADC_COUNT] = {ADC1, ADC2};
+    /* The request sources carry a flag above the DMAMUX source field. */
+    const uint32_t sources[ADC_INTERLEAVE_ADC_COUNT] = {(uint32_t)kDmaRequestMuxADC1 & DMAMUX_CHCFG_SOURCE_MASK,
+                                                        (uint32_t)kDmaRequestMuxADC2 & DMAMUX_CHCFG_SOURCE_MASK};
+
+    *(volatile uint32_t *)&bases[adc]->R[0] = result;
+    HOST_DmaSetRequest(sources[adc], true);
+    TEST_CHECK(HOST_DmaRun(1U) != 0U);
+    HOST_DmaSetRequest(sources[adc], false);
+}
+
+/* Captures TEST_HALVES halves of the ramp, ADC2 with the given mismatch and correction. */
+static void TEST_Capture(double gain, double offset, const adc_interleave_correction_t *correction)
+{
+    adc_interleave_config_t config;
+    uint32_t frame;
+    uint32_t half;
+    uint32_t x;
+
+    ADC_InterleaveGetDefaultConfig(&config);
+    config.channel       = 0U;
+    config.rateHz        = TEST_RATE_HZ;
+    config.frames        = TEST_FRAMES;
+    config.captures[0]   = s_capture1;
+    config.captures[1]   = s_capture2;
+    config.output        = s_output;
+    config.resolution    = TEST_RESOLUTION;
+    config.correction[1] = *correction;
+    config.callback      = TEST_Callback;
+    TEST_CHECK(kStatus_Success == ADC_InterleaveCreate(&s_handle, DMA0, &config));
+    TEST_CHECK(TEST_RATE_HZ == ADC_InterleaveGetRate(&s_handle));
+
+    s_halves    = 0U;
+    s_tolerance = 0U;
+    ADC_InterleaveStart(&s_handle);
+    for (half = 0U; half < TEST_HALVES; half++)
+    {
+        x = TEST_RAMP_START + (half * ADC_INTERLEAVE_ADC_COUNT * TEST_FRAMES);
+        if ((half % 2U) == 0U)
+        {
+            /* In conversion order, ADC1 completes the half first. */
+            for (frame = 0U; frame < TEST_FRAMES; frame++)
+            {
+                TEST_Convert(0U, (uint16_t)(x + (2U * frame)));
+                TEST_Convert(1U, TEST_Mismatch(x + (2U * frame) + 1U, gain, offset));
+            }
+        }
+        else
+        {
+            /* The ADC2 interrupt first, the merge waits for ADC1. */
+            for (frame = 0U; frame < TEST_FRAMES; frame++)
+            {
+                TEST_Convert(1U, TEST_Mismatch(x + (2U * frame) + 1U, gain, offset));
+            }
+            TEST_CHECK(half == s_halves);
+            for (frame = 0U; frame < TEST_FRAMES; frame++)
+            {
+                TEST_Convert(0U, (uint16_t)(x + (2U * frame)));
+            }
+        }
+        TEST_CHECK((half + 1U) == s_halves);
+    }
+
+    TEST_CHECK(TEST_HALVES == s_handle.halves);
+    TEST_CHECK(0U == ADC_InterleaveGetOverruns(&s_handle));
+    ADC_InterleaveDestroy(&s_handle);
+}
+
+/* Random mismatches of ADC2 corrected over the whole range, where its results are not clipped. */
+static uint32_t TEST_Matching(void)
+{
+    adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT] = {{ADC_INTERLEAVE_UNITY_GAIN, 0}};
+    uint32_t worst = 0U;
+    uint32_t error;
+    uint32_t low;
+    uint32_t high;
+    uint32_t i;
+    uint32_t x;
+    double gain;
+    double offset;
+    double raw;
+
+    for (i = 0U; i < TEST_MATCH_CASES; i++)
+    {
+        gain   = 0.8 + ((double)(TEST_Random() % 4501U) / 10000.0);
+        offset = (double)((int32_t)(TEST_Random() % 20001U) - 10000) / 100.0;
+        low    = 100U + (TEST_Random() % 1000U);
+        high   = 3000U + (TEST_Random() % 1000U);
+        TEST_CHECK(kStatus_Success == TEST_Calibrate(low, high, gain, offset, &correction[1]));
+
+        for (x = 0U; x <= TEST_MAX_VALUE; x++)
+        {
+            s_first[x]  = (uint16_t)x;
+            s_second[x] = TEST_Mismatch(x, gain, offset);
+        }
+        ADC_InterleaveMerge(s_first, s_second, TEST_MAX_VALUE + 1U, correction, TEST_MAX_VALUE, s_merged);
+
+        for (x = 0U; x <= TEST_MAX_VALUE; x++)
+        {
+            TEST_CHECK(s_merged[2U * x] == x);
+            raw = (gain * (double)x) + offset;
+            if ((raw < 0.0) || (raw > (double)TEST_MAX_VALUE))
+            {
+                continue;
+            }
+            error = (s_merged[(2U * x) + 1U] > x) ? (s_merged[(2U * x) + 1U] - x) : (x - s_merged[(2U * x) + 1U]);
+            if (error > 1U)
+            {
+                (void)printf("gain %.4f offset %.2f: input %u corrected to %u, gain 0x%X offset %d\n", gain, offset,
+                             x, s_merged[(2U * x) + 1U], correction[1].gain, correction[1].offset);
+                exit(EXIT_FAILURE);
+            }
+            worst = (error > worst) ? error : worst;
+        }
+    }
+
+    return worst;
+}
+
+/* Corrections that push the samples out of range, 10-bit results. */
+static void TEST_Clamping(void)
+{
+    adc_interleave_correction_t correction[ADC_INTERLEAVE_ADC_COUNT];
+    const uint32_t maxValue = 1023U;
+    int64_t expected;
+    uint32_t adc;
+    uint32_t i;
+
+    correction[0].gain   = 2U * ADC_INTERLEAVE_UNITY_GAIN;
+    correction[0].offset = 5;
+    correction[1].gain   = ADC_INTERLEAVE_UNITY_GAIN / 2U;
+    correction[1].offset = -300;
+    for (i = 0U; i < TEST_CLAMP_FRAMES; i++)
+    {
+        s_first[i]  = (uint16_t)(TEST_Random() & maxValue);
+        s_second[i] = (uint16_t)(TEST_Random() & maxValue);
+    }
+    ADC_InterleaveMerge(s_first, s_second, TEST_CLAMP_FRAMES, correction, maxValue, s_merged);
+
+    for (i = 0U; i < (2U * TEST_CLAMP_FRAMES); i++)
+    {
+        adc      = i % 2U;
+        expected = ((((int64_t)((adc == 0U) ? s_first[i / 2U] : s_second[i / 2U]) * correction[adc].gain) + 0x4000) >>
+                    15) +
+                   correction[adc].offset;
+        expected = (expected < 0) ? 0 : ((expected > (int64_t)maxValue) ? (int64_t)maxValue : expected);
+        TEST_CHECK((int64_t)s_merged[i] == expected);
+    }
+}
+
+static void TEST_InvalidLevels(void)
+{
+    adc_interleave_correction_t correction = {ADC_INTERLEAVE_UNITY_GAIN, 0};
+    uint32_t reference[2]                  = {1000U, 3000U};
+    uint32_t measured[2];
+
+    measured[0] = 1000U;
+    measured[1] = 3000U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 0U, &correction));
+    /* Equal or swapped levels. */
+    measured[1] = 1000U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    measured[0] = 3000U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    reference[1] = 1000U;
+    measured[0]  = 1000U;
+    measured[1]  = 3000U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    /* A gain above 2 and one rounded to 0. */
+    reference[1] = 6001U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    reference[1] = 1001U;
+    measured[1]  = 1000U + 200000U;
+    TEST_CHECK(kStatus_InvalidArgument == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    /* A rejected level leaves the correction as it was. */
+    TEST_CHECK((ADC_INTERLEAVE_UNITY_GAIN == correction.gain) && (0 == correction.offset));
+
+    /* Gain 2 is the largest one. */
+    reference[1] = 3000U;
+    measured[1]  = 2000U;
+    TEST_CHECK(kStatus_Success == ADC_InterleaveComputeCorrection(reference, measured, 1U, &correction));
+    TEST_CHECK((2U * ADC_INTERLEAVE_UNITY_GAIN) == correction.gain);
+}
+
+int main(void)
+{
+    adc_interleave_correction_t unity = {ADC_INTERLEAVE_UNITY_GAIN, 0};
+    adc_interleave_correction_t correction;
+    edma_config_t edmaConfig;
+    uint32_t worst;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+    DMAMGR_Init(DMA0, DMAMUX);
+
+    TEST_Capture(1.0, 0.0, &unity);
+    TEST_CHECK(0U == s_tolerance);
+
+    TEST_CHECK(kStatus_Success == TEST_Calibrate(TEST_LEVEL_LOW, TEST_LEVEL_HIGH, TEST_GAIN, TEST_OFFSET, &correction));
+    TEST_Capture(TEST_GAIN, TEST_OFFSET, &correction);
+    (void)printf("ADC interleave: %u halves of %u frames in order, ADC1 or ADC2 completing first\n", TEST_HALVES,
+                 TEST_FRAMES);
+    (void)printf("ADC2 at %.2fx %+.0f LSB: gain 0x%X offset %d, merged stream within %u LSB of the ramp\n", TEST_GAIN,
+                 TEST_OFFSET, correction.gain, correction.offset, s_tolerance);
+
+    worst = TEST_Matching();
+    TEST_Clamping();
+    TEST_InvalidLevels();
+    (void)printf("%u random mismatches corrected within %u LSB, clamping and rejected levels checked\n",
+                 TEST_MATCH_CASES, worst);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * ADC_PacerComputeTiming of adc_with_dma against a brute-force search. For every requested rate the search tries all
+ * the prescalers and all the periods from ADC_PACER_MIN_PERIOD to ADC_PACER_MAX_PERIOD and keeps the exact smallest
+ * relative error, the lowest prescaler and then the shortest period on a tie. The function must choose the same
+ * prescaler and period and report the achieved rate and its ppm error rounded the same way, for random rates over
+ * the whole range of several source clocks, rates dividing the clock exactly and the limits of the range.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "adc_pacer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_PRESCALE_COUNT 8U
+#define TEST_RANDOM_RATES   48U
+#define TEST_EXACT_RATES    8U
+/* Divisors of the source clocks below the slowest tick count. */
+#define TEST_MAX_DIVISORS   512U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* IPG clocks of the RT1042 and clocks that divide badly. */
+static const uint32_t s_clocks[] = {150000000U, 132000000U, 75000000U, 24000000U, 99999989U};
+
+static uint32_t s_seed = 1U;
+static uint32_t s_cases;
+static uint32_t s_exact;
+static int32_t s_worstPpm;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* adc_pacer.c sets up the clock only in ADC_PacerGetDefaultConfig, which is not used. */
+uint32_t CLOCK_GetFreq(clock_name_t name)
+{
+    (void)name;
+
+    return s_clocks[0];
+}
+
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* (a - b) * 1000000 / b rounded half away from zero, exactly. */
+static int32_t TEST_Ppm(uint64_t a, uint64_t b)
+{
+    __int128 num = ((__int128)a - (__int128)b) * 1000000;
+    __int128 half = (__int128)(b / 2U);
+
+    return (int32_t)((num + ((num < 0) ? -half : half)) / (__int128)b);
+}
+
+/* All the prescaler and period pairs, the smallest |clock - rate * ticks| / (rate * ticks) first. */
+static void TEST_Search(uint32_t sourceClockHz, uint32_t rateHz, adc_pacer_timing_t *timing)
+{
+    uint64_t bestDiff     = 0U;
+    uint64_t bestExpected = 0U;
+    uint64_t expected;
+    uint64_t diff;
+    uint64_t ticks;
+    uint32_t prescale;
+    uint32_t period;
+
+    for (prescale = 0U; prescale < TEST_PRESCALE_COUNT; prescale++)
+    {
+        for (period = ADC_PACER_MIN_PERIOD; period <= ADC_PACER_MAX_PERIOD; period++)
+        {
+            ticks    = (uint64_t)period << prescale;
+            expected = (uint64_t)rateHz * ticks;
+            diff     = (expected > sourceClockHz) ? (expected - sourceClockHz) : (sourceClockHz - expected);
+            if ((bestExpected == 0U) ||
+                (((unsigned __int128)diff * bestExpected) < ((unsigned __int128)bestDiff * expected)))
+            {
+                bestDiff         = diff;
+                bestExpected     = expected;
+                timing->prescale = (pwm_clock_prescale_t)prescale;
+                timing->period   = period;
+                timing->rateHz   = (uint32_t)((sourceClockHz + (ticks / 2U)) / ticks);
+                timing->errorPpm = TEST_Ppm(sourceClockHz, expected);
+            }
+        }
+    }
+}
+
+static void TEST_Rate(uint32_t sourceClockHz, uint32_t rateHz)
+{
+    adc_pacer_timing_t timing;
+    adc_pacer_timing_t expected;
+    status_t status = ADC_PacerComputeTiming(sourceClockHz, rateHz, &timing);
+    /* The slowest rate is one period of ADC_PACER_MAX_PERIOD at the highest prescaler, within half a period. */
+    uint64_t slowest = (uint64_t)rateHz * (2U * ADC_PACER_MAX_PERIOD + 1U) << (TEST_PRESCALE_COUNT - 2U);
+
+    if ((rateHz == 0U) || (rateHz > (sourceClockHz / ADC_PACER_MIN_PERIOD)))
+    {
+        TEST_CHECK(kStatus_InvalidArgument == status);
+        return;
+    }
+    if (slowest <= sourceClockHz)
+    {
+        TEST_CHECK(kStatus_OutOfRange == status);
+        return;
+    }
+    TEST_CHECK(kStatus_Success == status);
+
+    TEST_Search(sourceClockHz, rateHz, &expected);
+    if ((timing.prescale != expected.prescale) || (timing.period != expected.period) ||
+        (timing.rateHz != expected.rateHz) || (timing.errorPpm != expected.errorPpm))
+    {
+        (void)printf("%u Hz from %u Hz: prescale %u period %u %d ppm, search prescale %u period %u %d ppm\n", rateHz,
+                     sourceClockHz, (uint32_t)timing.prescale, timing.period, timing.errorPpm,
+                     (uint32_t)expected.prescale, expected.period, expected.errorPpm);
+        TEST_CHECK(false);
+    }
+    if (timing.errorPpm == 0)
+    {
+        s_exact++;
+    }
+    if (((timing.errorPpm < 0) ? -timing.errorPpm : timing.errorPpm) > s_worstPpm)
+    {
+        s_worstPpm = (timing.errorPpm < 0) ? -timing.errorPpm : timing.errorPpm;
+    }
+    s_cases++;
+}
+
+static void TEST_Clock(uint32_t sourceClockHz)
+{
+    uint32_t slowest = sourceClockHz / (ADC_PACER_MAX_PERIOD << (TEST_PRESCALE_COUNT - 1U));
+    uint32_t divisors[TEST_MAX_DIVISORS];
+    uint32_t count;
+    uint32_t rate;
+    uint32_t i;
+
+    /* The limits of the range and the rates next to them. */
+    for (rate = 0U; rate < 3U; rate++)
+    {
+        TEST_Rate(sourceClockHz, rate);
+        TEST_Rate(sourceClockHz, slowest - 1U + rate);
+        TEST_Rate(sourceClockHz, (sourceClockHz / ADC_PACER_MIN_PERIOD) - 1U + rate);
+    }
+
+    /* Log-uniform rates from the slowest to the fastest one. */
+    for (i = 0U; i < TEST_RANDOM_RATES; i++)
+    {
+        rate = slowest << (TEST_Random() % 22U);
+        rate = rate + (TEST_Random() % rate);
+        TEST_Rate(sourceClockHz, (rate < (sourceClockHz / ADC_PACER_MIN_PERIOD)) ? rate : (rate >> 8U));
+    }
+
+    /* Rates dividing the clock, exact when the quotient is a period of a prescaler. */
+    count = 0U;
+    for (i = ADC_PACER_MIN_PERIOD; (i * i) <= sourceClockHz; i++)
+    {
+        if ((sourceClockHz % i) == 0U)
+        {
+            divisors[count++] = i;
+            if ((sourceClockHz / i) <= (ADC_PACER_MAX_PERIOD << (TEST_PRESCALE_COUNT - 1U)))
+            {
+                divisors[count++] = sourceClockHz / i;
+            }
+        }
+    }
+    for (i = 0U; (count != 0U) && (i < TEST_EXACT_RATES); i++)
+    {
+        TEST_Rate(sourceClockHz, sourceClockHz / divisors[TEST_Random() % count]);
+    }
+    TEST_Rate(sourceClockHz, 1000000U);
+    TEST_Rate(sourceClockHz, 48000U);
+    TEST_Rate(sourceClockHz, 44100U);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(s_clocks) / sizeof(s_clocks[0])); i++)
+    {
+        TEST_Clock(s_clocks[i]);
+    }
+    (void)printf("ADC pacer: %u rates of %u source clocks matched the search, %u exact, worst error %d ppm\n",
+                 s_cases, (uint32_t)(sizeof(s_clocks) / sizeof(s_clocks[0])), s_exact, s_worstPpm);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * ADC_StatsUpdate against a plain loop over the whole stream: random window lengths, thresholds and block splits
+ * of 12-bit and 15-bit results, so the windows end inside the blocks and the threshold side carries over. Every
+ * window reported by the callback must match, and the mean and the RMS must be the rounded down values. The program
+ * is built with the SIMD kernel (the host computes USUB16, SEL and SMLALD in C) and with the portable kernel, and
+ * measures the host cycles per sample of its kernel.
+ *
+ * Usage: adc_stats_test [cases], 1000 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "adc_stats.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CASES         1000U
+#define TEST_SAMPLES       4096U
+#define TEST_MAX_BLOCK     300U
+#define TEST_MAX_WINDOW    700U
+#define TEST_MAX_WINDOWS   (TEST_SAMPLES + 1U)
+/* Benchmark: one DMA half of 12-bit results, passed again and again. */
+#define TEST_BENCH_BLOCK   1024U
+#define TEST_BENCH_SAMPLES (16U * 1024U * 1024U)
+#define TEST_BENCH_RUNS    5U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static uint16_t s_samples[TEST_SAMPLES];
+static adc_stats_result_t s_ref[TEST_MAX_WINDOWS];
+static uint32_t s_refWindows;
+static uint32_t s_windows;
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* Windows of the whole stream one sample at a time, the first sample only sets the side. */
+static void TEST_Reference(uint32_t windowSamples, uint16_t threshold)
+{
+    adc_stats_result_t window;
+    uint32_t above = (s_samples[0] >= threshold) ? 1U : 0U;
+    uint32_t side;
+    uint32_t i;
+
+    (void)memset(&window, 0, sizeof(window));
+    window.min   = UINT16_MAX;
+    s_refWindows = 0U;
+    for (i = 0U; i < TEST_SAMPLES; i++)
+    {
+        window.count++;
+        window.min = (s_samples[i] < window.min) ? s_samples[i] : window.min;
+        window.max = (s_samples[i] > window.max) ? s_samples[i] : window.max;
+        window.sum += s_samples[i];
+        window.sumSquares += (uint64_t)s_samples[i] * s_samples[i];
+        side = (s_samples[i] >= threshold) ? 1U : 0U;
+        window.crossings += above ^ side;
+        above = side;
+
+        if (window.count == windowSamples)
+        {
+            s_ref[s_refWindows++] = window;
+            (void)memset(&window, 0, sizeof(window));
+            window.min = UINT16_MAX;
+        }
+    }
+}
+
+static void TEST_Callback(adc_stats_handle_t *handle, const adc_stats_result_t *result, void *userData)
+{
+    const adc_stats_result_t *ref = &s_ref[s_windows];
+    uint64_t meanSquare;
+    uint64_t rms;
+
+    (void)userData;
+    TEST_CHECK(s_windows < s_refWindows);
+    if ((result->count != ref->count) || (result->min != ref->min) || (result->max != ref->max) ||
+        (result->sum != ref->sum) || (result->sumSquares != ref->sumSquares) || (result->crossings != ref->crossings))
+    {
+        (void)printf("window %u: count %u min %u max %u sum %llu squares %llu crossings %u, the loop gives %u %u %u "
+                     "%llu %llu %u\n",
+                     s_windows, result->count, result->min, result->max, (unsigned long long)result->sum,
+                     (unsigned long long)result->sumSquares, result->crossings, ref->count, ref->min, ref->max,
+                     (unsigned long long)ref->sum, (unsigned long long)ref->sumSquares, ref->crossings);
+        exit(EXIT_FAILURE);
+    }
+    TEST_CHECK(ADC_StatsGetMean(result) == (uint32_t)(ref->sum / ref->count));
+    meanSquare = ref->sumSquares / ref->count;
+    rms        = ADC_StatsGetRms(result);
+    TEST_CHECK(((rms * rms) <= meanSquare) && (((rms + 1U) * (rms + 1U)) > meanSquare));
+    TEST_CHECK(ADC_StatsGetLast(handle) == result);
+    s_windows++;
+}
+
+static void TEST_Case(uint32_t index)
+{
+    adc_stats_config_t config;
+    adc_stats_handle_t handle;
+    uint32_t bits   = ((index % 2U) == 0U) ? 12U : 15U;
+    uint32_t offset = 0U;
+    uint32_t block;
+    uint32_t i;
+
+    /* Slow ramps with noise, so the samples cross the threshold in runs and one by one. */
+    for (i = 0U; i < TEST_SAMPLES; i++)
+    {
+        s_samples[i] = (uint16_t)((((i * 37U) + (TEST_Random() % 64U)) << (bits - 12U)) & ((1UL << bits) - 1U));
+    }
+
+    ADC_StatsGetDefaultConfig(&config);
+    config.windowSamples = 1U + (TEST_Random() % TEST_MAX_WINDOW);
+    config.threshold     = (uint16_t)(TEST_Random() & ((1UL << bits) - 1U));
+    config.callback      = TEST_Callback;
+    ADC_StatsInit(&handle, &config);
+    TEST_Reference(config.windowSamples, config.threshold);
+
+    s_windows = 0U;
+    while (offset < TEST_SAMPLES)
+    {
+        /* Odd lengths and offsets leave the pairs unaligned and a scalar tail. */
+        block = TEST_Random() % (TEST_MAX_BLOCK + 1U);
+        block = (block > (TEST_SAMPLES - offset)) ? (TEST_SAMPLES - offset) : block;
+        ADC_StatsUpdate(&handle, &s_samples[offset], block);
+        offset += block;
+    }
+    TEST_CHECK(s_windows == s_refWindows);
+    TEST_CHECK(handle.window.count == (TEST_SAMPLES % config.windowSamples));
+}
+
+/* Best of a few runs of the TSC cycles per sample, the TSC counts at the nominal frequency of the host. */
+static double TEST_Bench(void)
+{
+    adc_stats_config_t config;
+    adc_stats_handle_t handle;
+    uint64_t best = UINT64_MAX;
+    uint64_t start;
+    uint32_t run;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BENCH_BLOCK; i++)
+    {
+        s_samples[i] = (uint16_t)(TEST_Random() & 0xFFFU);
+    }
+    ADC_StatsGetDefaultConfig(&config);
+    ADC_StatsInit(&handle, &config);
+
+    for (run = 0U; run < TEST_BENCH_RUNS; run++)
+    {
+        start = __rdtsc();
+        for (i = 0U; i < (TEST_BENCH_SAMPLES / TEST_BENCH_BLOCK); i++)
+        {
+            ADC_StatsUpdate(&handle, s_samples, TEST_BENCH_BLOCK);
+        }
+        start = __rdtsc() - start;
+        best  = (start < best) ? start : best;
+    }
+
+    return (double)best / (double)TEST_BENCH_SAMPLES;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t cases = TEST_CASES;
+    uint32_t i;
+
+    if (argc > 1)
+    {
+        cases = (uint32_t)strtoul(argv[1], NULL, 0);
+        TEST_CHECK(cases != 0U);
+    }
+
+    for (i = 0U; i < cases; i++)
+    {
+        TEST_Case(i);
+    }
+
+    (void)printf("ADC stats, %s kernel: %u cases match the plain loop\n",
+                 (ADC_STATS_USE_DSP != 0) ? "SIMD" : "portable", cases);
+    (void)printf("Blocks of %u samples: %.2f host cycles per sample\n", TEST_BENCH_BLOCK, TEST_Bench());
+
+    return EXIT_SUCCESS;
+}
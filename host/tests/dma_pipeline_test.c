@@ -0,0 +1,272 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * DMAPIPE pipelines on the DMA0 and DMAMUX models. The first stage is paced by a request the test raises one
+ * element at a time, the later stages run from the channel links. Every element must reach each stage in order,
+ * right after its request and never before: the stage buffers start poisoned. The last stage must call back once
+ * per major loop, a pipeline built once runs again from the addresses its last offsets left, a continuous one
+ * rewinds and runs without DMAPIPE_Start until it is stopped, and a stage with a bad offset must be reported by
+ * DMAPIPE_GetStatus until the next start, which also resumes the engine halted by the error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dma_pipeline.h"
+#include "fsl_dmamux.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_ELEMENTS 16U
+#define TEST_RUNS     3U
+#define TEST_STAGES   3U
+#define TEST_BUDGET   100000U
+#define TEST_POISON   0xDEADBEEFU
+/* Stage 0 request, nothing else drives it on the models. */
+#define TEST_SOURCE   kDmaRequestMuxLPUART1Tx
+/* Bytes of one stage buffer, the last offsets rewind the addresses by it. */
+#define TEST_BYTES    (TEST_ELEMENTS * sizeof(uint32_t))
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static dmapipe_handle_t s_pipeline;
+/* The driver passes addresses as uint32_t, the buffers are static to stay below 4 GB. */
+SDK_ALIGN(static uint32_t s_input[TEST_ELEMENTS], 32U);
+SDK_ALIGN(static uint32_t s_buffers[TEST_STAGES][TEST_ELEMENTS], 32U);
+
+static volatile uint32_t s_callbacks;
+/* Elements requested when the last callback came. */
+static volatile uint32_t s_callbackElement;
+static uint32_t s_element;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_Callback(dmapipe_handle_t *handle, void *userData)
+{
+    (void)userData;
+    TEST_CHECK(handle == &s_pipeline);
+    s_callbacks++;
+    s_callbackElement = s_element;
+}
+
+/* One request of the first stage, then the links run until the engine is idle. */
+static void TEST_Request(void)
+{
+    s_element++;
+    HOST_DmaSetRequest((uint32_t)TEST_SOURCE & DMAMUX_CHCFG_SOURCE_MASK, true);
+    (void)HOST_DmaRun(1U);
+    HOST_DmaSetRequest((uint32_t)TEST_SOURCE & DMAMUX_CHCFG_SOURCE_MASK, false);
+    while (HOST_DmaRun(TEST_BUDGET) != 0U)
+    {
+    }
+}
+
+static void TEST_Fill(uint32_t run)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_ELEMENTS; i++)
+    {
+        s_input[i] = (run << 16U) | i;
+    }
+    for (i = 0U; i < (TEST_STAGES * TEST_ELEMENTS); i++)
+    {
+        s_buffers[i / TEST_ELEMENTS][i % TEST_ELEMENTS] = TEST_POISON;
+    }
+}
+
+/* Stage n copies one word per minor loop into buffer n, from the input or the buffer of stage n - 1. */
+static void TEST_Stages(dmapipe_stage_config_t *stages, uint32_t count, bool rewind)
+{
+    uint32_t stage;
+
+    (void)memset(stages, 0, count * sizeof(*stages));
+    for (stage = 0U; stage < count; stage++)
+    {
+        EDMA_PrepareTransfer(&stages[stage].transfer, (stage == 0U) ? s_input : s_buffers[stage - 1U],
+                             sizeof(uint32_t), s_buffers[stage], sizeof(uint32_t), sizeof(uint32_t), TEST_BYTES,
+                             kEDMA_MemoryToMemory);
+        stages[stage].srcLastOffset  = rewind ? -(int32_t)TEST_BYTES : 0;
+        stages[stage].destLastOffset = rewind ? -(int32_t)TEST_BYTES : 0;
+        stages[stage].link           = kDMAPIPE_LinkMinor;
+    }
+}
+
+static void TEST_Create(const dmapipe_stage_config_t *stages, uint32_t count, bool continuous)
+{
+    dmapipe_config_t config;
+
+    DMAPIPE_GetDefaultConfig(&config);
+    config.stages     = stages;
+    config.stageCount = count;
+    config.source     = (int32_t)TEST_SOURCE;
+    config.continuous = continuous;
+    config.callback   = TEST_Callback;
+    TEST_CHECK(kStatus_Success == DMAPIPE_Create(&s_pipeline, DMA0, &config));
+}
+
+/* The elements of one run: each in every stage after its request, none ahead, one callback at the end. */
+static void TEST_Run(uint32_t run)
+{
+    uint32_t callbacks = s_callbacks;
+    uint32_t stage;
+    uint32_t i;
+
+    TEST_Fill(run);
+    for (i = 0U; i < TEST_ELEMENTS; i++)
+    {
+        TEST_Request();
+        for (stage = 0U; stage < TEST_STAGES; stage++)
+        {
+            TEST_CHECK(s_buffers[stage][i] == s_input[i]);
+            TEST_CHECK(((i + 1U) == TEST_ELEMENTS) || (s_buffers[stage][i + 1U] == TEST_POISON));
+        }
+        TEST_CHECK(s_callbacks == (callbacks + (((i + 1U) == TEST_ELEMENTS) ? 1U : 0U)));
+    }
+    TEST_CHECK(s_callbackElement == s_element);
+}
+
+static void TEST_Single(void)
+{
+    dmapipe_stage_config_t stages[TEST_STAGES];
+    dmapipe_status_t status;
+    uint32_t run;
+
+    TEST_Stages(stages, TEST_STAGES, true);
+    TEST_Create(stages, TEST_STAGES, false);
+    for (run = 0U; run < TEST_RUNS; run++)
+    {
+        DMAPIPE_Start(&s_pipeline);
+        DMAPIPE_GetStatus(&s_pipeline, &status);
+        TEST_CHECK(status.running && (0U == status.errorStages));
+        TEST_Run(run);
+        /* The first stage disabled its request at the end of its major loop. */
+        DMAPIPE_GetStatus(&s_pipeline, &status);
+        TEST_CHECK(!status.running && (status.completions == (run + 1U)));
+        TEST_Fill(run);
+        TEST_Request();
+        TEST_CHECK(s_buffers[0][0] == TEST_POISON);
+    }
+    DMAPIPE_Destroy(&s_pipeline);
+}
+
+static void TEST_Continuous(void)
+{
+    dmapipe_stage_config_t stages[TEST_STAGES];
+    dmapipe_status_t status;
+    uint32_t run;
+
+    TEST_Stages(stages, TEST_STAGES, true);
+    TEST_Create(stages, TEST_STAGES, true);
+    DMAPIPE_Start(&s_pipeline);
+    for (run = 0U; run < TEST_RUNS; run++)
+    {
+        TEST_Run(run);
+        DMAPIPE_GetStatus(&s_pipeline, &status);
+        TEST_CHECK(status.running && (status.completions == (run + 1U)));
+    }
+    DMAPIPE_Stop(&s_pipeline);
+    DMAPIPE_GetStatus(&s_pipeline, &status);
+    TEST_CHECK(!status.running);
+    TEST_Fill(run);
+    TEST_Request();
+    TEST_CHECK(s_buffers[0][0] == TEST_POISON);
+    DMAPIPE_Destroy(&s_pipeline);
+}
+
+/* A major link runs the next stage once per major loop: it moves the whole buffer in one minor loop. */
+static void TEST_MajorLink(void)
+{
+    dmapipe_stage_config_t stages[2];
+    uint32_t i;
+
+    TEST_Stages(stages, 2U, false);
+    stages[0].link = kDMAPIPE_LinkMajor;
+    EDMA_PrepareTransfer(&stages[1].transfer, s_buffers[0], sizeof(uint32_t), s_buffers[1], sizeof(uint32_t),
+                         TEST_BYTES, TEST_BYTES, kEDMA_MemoryToMemory);
+    TEST_Create(stages, 2U, false);
+    s_callbacks = 0U;
+    TEST_Fill(0U);
+    DMAPIPE_Start(&s_pipeline);
+    for (i = 0U; i < TEST_ELEMENTS; i++)
+    {
+        TEST_Request();
+        TEST_CHECK(s_buffers[0][i] == s_input[i]);
+        TEST_CHECK(((i + 1U) == TEST_ELEMENTS) || (s_buffers[1][TEST_ELEMENTS - 1U] == TEST_POISON));
+    }
+    TEST_CHECK(0 == memcmp(s_buffers[1], s_input, TEST_BYTES));
+    TEST_CHECK(1U == s_callbacks);
+    DMAPIPE_Destroy(&s_pipeline);
+}
+
+/* Stage 1 writes with an offset that is not a multiple of its width, the eDMA retires it with DOE. */
+static void TEST_Error(void)
+{
+    dmapipe_stage_config_t stages[TEST_STAGES];
+    dmapipe_status_t status;
+
+    TEST_Stages(stages, TEST_STAGES, false);
+    stages[1].transfer.destOffset = 2;
+    TEST_Create(stages, TEST_STAGES, false);
+    s_callbacks = 0U;
+    TEST_Fill(0U);
+    DMAPIPE_Start(&s_pipeline);
+    TEST_Request();
+    DMAPIPE_GetStatus(&s_pipeline, &status);
+    TEST_CHECK((1UL << 1U) == status.errorStages);
+    TEST_CHECK((s_buffers[0][0] == s_input[0]) && (s_buffers[2][0] == TEST_POISON));
+    TEST_CHECK(0U == s_callbacks);
+    /* The default configuration halts the engine on the error. */
+    TEST_CHECK(0U != (DMA0->CR & DMA_CR_HALT_MASK));
+
+    /* A start clears the errors and resumes the engine, the stage reports it again at its next service. */
+    DMAPIPE_Start(&s_pipeline);
+    DMAPIPE_GetStatus(&s_pipeline, &status);
+    TEST_CHECK(0U == status.errorStages);
+    TEST_Request();
+    DMAPIPE_GetStatus(&s_pipeline, &status);
+    TEST_CHECK((1UL << 1U) == status.errorStages);
+    DMAPIPE_Destroy(&s_pipeline);
+}
+
+int main(void)
+{
+    edma_config_t edmaConfig;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+    DMAMGR_Init(DMA0, DMAMUX);
+
+    TEST_Single();
+    TEST_Continuous();
+    TEST_MajorLink();
+    TEST_Error();
+    (void)printf("DMA pipeline: %u stages, %u elements per run, %u single and %u continuous runs in order, "
+                 "major link and error stage checked\n",
+                 TEST_STAGES, TEST_ELEMENTS, TEST_RUNS, TEST_RUNS);
+
+    return EXIT_SUCCESS;
+}
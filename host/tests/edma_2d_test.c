@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * EDMA_TcdSet2DTransferConfig on the DMA0 model: the moved elements against a CPU loop, and the addresses in the
+ * channel registers after the major loop, which SLAST and DLAST must bring back to the first element so that the
+ * same TCD can be started again.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHANNEL 2U
+#define TEST_SIDE    8U
+#define TEST_WORDS   (TEST_SIDE * TEST_SIDE * 4U)
+#define TEST_BUDGET  100000U
+#define TEST_PASSES  2U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/* One 2-D case, the strides are in elements of 4 bytes. */
+typedef struct _test_case
+{
+    const char *name;
+    uint32_t columns;
+    uint32_t rows;
+    int16_t srcElementStride;
+    int16_t destElementStride;
+    int32_t srcRowStride;
+    int32_t destRowStride;
+} test_case_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+SDK_ALIGN(static edma_tcd_t s_tcd, 32U);
+SDK_ALIGN(static uint32_t s_src[TEST_WORDS], 32U);
+SDK_ALIGN(static uint32_t s_dest[TEST_WORDS], 32U);
+static uint32_t s_ref[TEST_WORDS];
+
+static const test_case_t s_cases[] = {
+    /* Rows of the band are not contiguous on either side, the strides do not match. */
+    {"single row band", TEST_SIDE, 1U, 1, 1, 3 * TEST_SIDE, 5 * TEST_SIDE},
+    {"single row gather", TEST_SIDE, 1U, 2, 1, 2 * TEST_SIDE, 0},
+    {"transpose", TEST_SIDE, TEST_SIDE, TEST_SIDE, 1, 1, TEST_SIDE},
+    {"sub-matrix", TEST_SIDE / 2U, TEST_SIDE / 2U, 1, 1, 2 * TEST_SIDE, 2 * TEST_SIDE},
+    {"de-interleave", TEST_SIDE, 4U, 4, 1, 1, TEST_SIDE},
+    {"column", 1U, TEST_SIDE, 1, 1, TEST_SIDE, 1},
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_Reference(const test_case_t *test)
+{
+    uint32_t row;
+    uint32_t col;
+
+    for (row = 0U; row < test->rows; row++)
+    {
+        for (col = 0U; col < test->columns; col++)
+        {
+            s_ref[((int32_t)row * test->destRowStride) + ((int32_t)col * test->destElementStride)] =
+                s_src[((int32_t)row * test->srcRowStride) + ((int32_t)col * test->srcElementStride)];
+        }
+    }
+}
+
+static void TEST_Run(const test_case_t *test)
+{
+    edma_2d_transfer_config_t config;
+    uint32_t pass;
+
+    config.srcAddr           = (uint32_t)(uintptr_t)s_src;
+    config.destAddr          = (uint32_t)(uintptr_t)s_dest;
+    config.elementSize       = sizeof(uint32_t);
+    config.columns           = test->columns;
+    config.rows              = test->rows;
+    config.srcElementStride  = (int16_t)(test->srcElementStride * (int16_t)sizeof(uint32_t));
+    config.destElementStride = (int16_t)(test->destElementStride * (int16_t)sizeof(uint32_t));
+    config.srcRowStride      = test->srcRowStride * (int32_t)sizeof(uint32_t);
+    config.destRowStride     = test->destRowStride * (int32_t)sizeof(uint32_t);
+
+    (void)memset(s_ref, 0, sizeof(s_ref));
+    TEST_Reference(test);
+
+    EDMA_TcdReset(&s_tcd);
+    TEST_CHECK(kStatus_Success == EDMA_TcdSet2DTransferConfig(&s_tcd, &config, NULL));
+    EDMA_InstallTCD(DMA0, TEST_CHANNEL, &s_tcd);
+
+    /* The second pass runs from the addresses the first one left in the registers. */
+    for (pass = 0U; pass < TEST_PASSES; pass++)
+    {
+        (void)memset(s_dest, 0, sizeof(s_dest));
+        EDMA_ClearChannelStatusFlags(DMA0, TEST_CHANNEL, (uint32_t)kEDMA_DoneFlag);
+        EDMA_EnableChannelRequest(DMA0, TEST_CHANNEL);
+        while (HOST_DmaRun(TEST_BUDGET) != 0U)
+        {
+        }
+        if ((0U == (EDMA_GetChannelStatusFlags(DMA0, TEST_CHANNEL) & (uint32_t)kEDMA_DoneFlag)) ||
+            (memcmp(s_dest, s_ref, sizeof(s_ref)) != 0) || (DMA0->TCD[TEST_CHANNEL].SADDR != config.srcAddr) ||
+            (DMA0->TCD[TEST_CHANNEL].DADDR != config.destAddr))
+        {
+            (void)printf("%s, pass %u: wrong data or SADDR 0x%x DADDR 0x%x after the major loop\n", test->name,
+                         pass, DMA0->TCD[TEST_CHANNEL].SADDR, DMA0->TCD[TEST_CHANNEL].DADDR);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+int main(void)
+{
+    edma_config_t config;
+    uint32_t i;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_EnableAlwaysOn(DMAMUX, TEST_CHANNEL, true);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&config);
+    EDMA_Init(DMA0, &config);
+
+    for (i = 0U; i < TEST_WORDS; i++)
+    {
+        s_src[i] = 0x2D000000U + i;
+    }
+    for (i = 0U; i < ARRAY_SIZE(s_cases); i++)
+    {
+        TEST_Run(&s_cases[i]);
+        (void)printf("%s: ok\n", s_cases[i].name);
+    }
+
+    return EXIT_SUCCESS;
+}
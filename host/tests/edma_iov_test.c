@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * EDMA_SubmitIov on the DMA0 model: every TCD of a vector must be counted by the callback and released, so a
+ * vector that fills the whole pool can be submitted again once the previous one is done.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHANNEL   1U
+#define TEST_TCDS      3U
+#define TEST_SEGMENT   5U
+#define TEST_VECTORS   4U
+#define TEST_BUDGET    100000U
+#define TEST_PATTERN   0x5AU
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_handle_t s_handle;
+SDK_ALIGN(static edma_tcd_t s_tcdPool[TEST_TCDS], 32U);
+/* Segments with a gap in between, one TCD each. */
+static uint8_t s_memory[TEST_TCDS][TEST_SEGMENT + 1U];
+/* Stands for the peripheral data register. */
+static volatile uint8_t s_dataRegister;
+
+static volatile uint32_t s_tcdsDone;
+static volatile uint32_t s_callbacks;
+static volatile bool s_transferDone;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_Callback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    (void)handle;
+    (void)param;
+    s_tcdsDone += tcds;
+    s_callbacks++;
+    s_transferDone = transferDone;
+}
+
+static void TEST_SendVector(edma_transfer_type_t direction)
+{
+    edma_iovec_t iov[TEST_TCDS];
+    uint32_t i;
+
+    for (i = 0U; i < TEST_TCDS; i++)
+    {
+        iov[i].base   = s_memory[i];
+        iov[i].length = TEST_SEGMENT;
+    }
+    s_tcdsDone     = 0U;
+    s_callbacks    = 0U;
+    s_transferDone = false;
+
+    TEST_CHECK(kStatus_Success == EDMA_SubmitIov(&s_handle, (uint32_t)(uintptr_t)&s_dataRegister, sizeof(uint8_t),
+                                                 iov, TEST_TCDS, direction));
+    TEST_CHECK(TEST_TCDS == (uint32_t)s_handle.tcdUsed);
+    EDMA_StartTransfer(&s_handle);
+    while (HOST_DmaRun(TEST_BUDGET) != 0U)
+    {
+    }
+
+    /* One interrupt per TCD, all of them counted and released. */
+    TEST_CHECK(TEST_TCDS == s_tcdsDone);
+    TEST_CHECK(TEST_TCDS == s_callbacks);
+    TEST_CHECK(s_transferDone);
+    TEST_CHECK(0 == s_handle.tcdUsed);
+}
+
+int main(void)
+{
+    edma_config_t config;
+    uint32_t vector;
+    uint32_t i;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_EnableAlwaysOn(DMAMUX, TEST_CHANNEL, true);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&config);
+    EDMA_Init(DMA0, &config);
+    EDMA_CreateHandle(&s_handle, DMA0, TEST_CHANNEL);
+    EDMA_SetCallback(&s_handle, TEST_Callback, NULL);
+    EDMA_InstallTCDMemory(&s_handle, s_tcdPool, TEST_TCDS);
+
+    /* Vectors that fill the pool back to back, a leaked TCD makes the next submit fail. */
+    for (vector = 0U; vector < TEST_VECTORS; vector++)
+    {
+        (void)memset(s_memory, 0, sizeof(s_memory));
+        s_dataRegister = TEST_PATTERN;
+        TEST_SendVector(kEDMA_PeripheralToMemory);
+        for (i = 0U; i < TEST_TCDS; i++)
+        {
+            TEST_CHECK((s_memory[i][0] == TEST_PATTERN) && (s_memory[i][TEST_SEGMENT - 1U] == TEST_PATTERN));
+            TEST_CHECK(s_memory[i][TEST_SEGMENT] == 0U);
+        }
+
+        s_memory[TEST_TCDS - 1U][TEST_SEGMENT - 1U] = (uint8_t)vector;
+        TEST_SendVector(kEDMA_MemoryToPeripheral);
+        TEST_CHECK(s_dataRegister == (uint8_t)vector);
+    }
+
+    (void)printf("EDMA_SubmitIov: %u vectors of %u TCDs counted and released\n", 2U * TEST_VECTORS, TEST_TCDS);
+
+    return EXIT_SUCCESS;
+}
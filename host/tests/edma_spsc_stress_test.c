@@ -0,0 +1,243 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Single producer/single consumer stress of the eDMA TCD queue on the DMA0 model, in the interrupt masking and in
+ * the lock-free mode of EDMA_EnableLockFreeQueue. The thread submits one-word descriptors as fast as the queue
+ * takes them while the asynchronous core tick runs the engine, so the completion interrupt preempts the submission
+ * at any instruction. Every descriptor must be completed once, in order, with its own data, and the TCD accounting
+ * must never leak a slot.
+ *
+ * The interrupt latency the submission adds is the time it keeps PRIMASK set: the core model counts the masked
+ * sections and their host time, and the ticks that found the interrupts masked. These are the before/after figures,
+ * in the lock-free mode the submission must never mask the interrupts.
+ *
+ * Usage: edma_spsc_stress_test [descriptors per mode], 1000000 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHANNEL             0U
+#define TEST_TCDS                8U
+#define TEST_DESCRIPTORS         1000000U
+#define TEST_TICK_US             50U
+/* Engine cycles per tick, one descriptor costs 16 cycles: the completions come in bursts of 0 to 4. */
+#define TEST_BUDGET_MIN          4U
+#define TEST_BUDGET_RANGE        64U
+/* Host time without a completion after which the queue is reported as stalled. */
+#define TEST_STALL_NS            5000000000ULL
+#define TEST_POISON              0xFFFFFFFFU
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/* Figures of one queue mode. */
+typedef struct _test_result
+{
+    uint64_t ticks;    /* Ticks of the run. */
+    uint64_t deferred; /* Ticks that found PRIMASK set. */
+    uint64_t irqs;     /* Interrupts taken. */
+    uint64_t masks;    /* Masked sections. */
+    uint64_t maskedNs; /* Host time with PRIMASK set. */
+    uint64_t ns;       /* Host time of the run. */
+} test_result_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_handle_t s_handle;
+/* The driver passes addresses as uint32_t, the buffers are static to stay below 4 GB. */
+SDK_ALIGN(static edma_tcd_t s_tcdPool[TEST_TCDS], 32U);
+/* Descriptor n moves slot n % TEST_TCDS, the slot is free again once descriptor n - TEST_TCDS was checked. */
+SDK_ALIGN(static uint32_t s_src[TEST_TCDS], 32U);
+SDK_ALIGN(static uint32_t s_dest[TEST_TCDS], 32U);
+
+static volatile uint32_t s_submitted;
+static volatile uint32_t s_done;
+static volatile uint64_t s_ticks;
+static volatile uint64_t s_deferred;
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/*
+ * The engine only runs in the ticks that find the interrupts enabled: a completion interrupt is then taken before
+ * the next completion, as on the device where the masked sections are far shorter than a transfer.
+ */
+static void TEST_Tick(void)
+{
+    s_ticks++;
+    if (HOST_CoreGetPrimask() != 0U)
+    {
+        s_deferred++;
+        return;
+    }
+
+    s_seed = (s_seed * 1103515245U) + 12345U;
+    (void)HOST_DmaRun(TEST_BUDGET_MIN + ((s_seed >> 16U) % TEST_BUDGET_RANGE));
+}
+
+static void TEST_Callback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    uint32_t slot;
+
+    (void)param;
+    /* The handler already released the TCDs, the thread can not run before the callback returns. */
+    TEST_CHECK((handle->tcdUsed >= 0) && (handle->tcdUsed <= (int8_t)TEST_TCDS));
+    TEST_CHECK((s_done + tcds) <= s_submitted);
+    for (; tcds > 0U; tcds--)
+    {
+        slot = s_done % TEST_TCDS;
+        TEST_CHECK(s_dest[slot] == s_done);
+        s_dest[slot] = TEST_POISON;
+        s_done++;
+    }
+}
+
+static void TEST_Run(bool lockFree, uint32_t descriptors, test_result_t *result)
+{
+    edma_transfer_config_t config;
+    uint64_t startIrqs;
+    uint64_t startMasks;
+    uint64_t startMaskedNs;
+    uint64_t startNs;
+    uint64_t progressNs;
+    uint32_t lastDone;
+    uint32_t slot;
+    uint32_t i;
+
+    EDMA_AbortTransfer(&s_handle);
+    EDMA_InstallTCDMemory(&s_handle, s_tcdPool, TEST_TCDS);
+    EDMA_EnableLockFreeQueue(&s_handle, lockFree);
+    for (i = 0U; i < TEST_TCDS; i++)
+    {
+        s_dest[i] = TEST_POISON;
+    }
+    s_submitted = 0U;
+    s_done      = 0U;
+    s_ticks     = 0U;
+    s_deferred  = 0U;
+
+    startIrqs     = HOST_CoreGetIRQCount();
+    startMasks    = HOST_CoreGetMaskCount();
+    startMaskedNs = HOST_CoreGetMaskedTimeNs();
+    startNs       = HOST_CoreGetTimeNs();
+    progressNs    = startNs;
+    lastDone      = 0U;
+    HOST_CoreStartTick(TEST_TICK_US, TEST_Tick);
+    while (s_done < descriptors)
+    {
+        if ((s_submitted < descriptors) && ((s_submitted - s_done) < TEST_TCDS))
+        {
+            /* Counted before the submission, the descriptor can complete before EDMA_SubmitTransfer returns. */
+            i           = s_submitted++;
+            slot        = i % TEST_TCDS;
+            s_src[slot] = i;
+            EDMA_PrepareTransfer(&config, &s_src[slot], sizeof(s_src[0]), &s_dest[slot], sizeof(s_dest[0]),
+                                 sizeof(s_src[0]), sizeof(s_src[0]), kEDMA_MemoryToMemory);
+            /* A free slot means a free TCD, a leaked tcdUsed shows as a full queue. */
+            TEST_CHECK(kStatus_Success == EDMA_SubmitTransfer(&s_handle, &config));
+            if (i == 0U)
+            {
+                EDMA_StartTransfer(&s_handle);
+            }
+        }
+        else if (s_done != lastDone)
+        {
+            lastDone   = s_done;
+            progressNs = HOST_CoreGetTimeNs();
+        }
+        else if ((HOST_CoreGetTimeNs() - progressNs) > TEST_STALL_NS)
+        {
+            HOST_CoreStopTick();
+            (void)printf("%s queue stalled after %u of %u descriptors, %d TCDs in use\n",
+                         lockFree ? "Lock-free" : "IRQ masking", s_done, s_submitted, (int)s_handle.tcdUsed);
+            exit(EXIT_FAILURE);
+        }
+        else
+        {
+        }
+    }
+    HOST_CoreStopTick();
+
+    TEST_CHECK(descriptors == s_submitted);
+    TEST_CHECK(0 == s_handle.tcdUsed);
+    TEST_CHECK(s_handle.header == s_handle.tail);
+    result->ns       = HOST_CoreGetTimeNs() - startNs;
+    result->ticks    = s_ticks;
+    result->deferred = s_deferred;
+    result->irqs     = HOST_CoreGetIRQCount() - startIrqs;
+    result->masks    = HOST_CoreGetMaskCount() - startMasks;
+    result->maskedNs = HOST_CoreGetMaskedTimeNs() - startMaskedNs;
+}
+
+static void TEST_Print(const char *mode, uint32_t descriptors, const test_result_t *result)
+{
+    uint64_t mean = (result->masks != 0U) ? (result->maskedNs / result->masks) : 0U;
+
+    (void)printf("%-12s%u\t%u\t%u\t%u\t%u\t%.2f\t%u\n", mode, descriptors, (uint32_t)(result->ns / descriptors),
+                 (uint32_t)result->irqs, (uint32_t)result->ticks, (uint32_t)result->deferred,
+                 (double)result->masks / (double)descriptors, (uint32_t)mean);
+}
+
+int main(int argc, char **argv)
+{
+    edma_config_t edmaConfig;
+    test_result_t masking;
+    test_result_t lockFree;
+    uint64_t longestNs;
+    uint32_t descriptors = TEST_DESCRIPTORS;
+
+    if (argc > 1)
+    {
+        descriptors = (uint32_t)strtoul(argv[1], NULL, 0);
+        TEST_CHECK(descriptors != 0U);
+    }
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_EnableAlwaysOn(DMAMUX, TEST_CHANNEL, true);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+    EDMA_CreateHandle(&s_handle, DMA0, TEST_CHANNEL);
+    EDMA_SetCallback(&s_handle, TEST_Callback, NULL);
+
+    TEST_Run(false, descriptors, &masking);
+    /* Only the masking mode has masked sections, so the longest one since the start is its own. */
+    longestNs = HOST_CoreGetMaxMaskedNs();
+    TEST_Run(true, descriptors, &lockFree);
+
+    (void)printf("queue\t    TCDs\tns/TCD\tIRQs\tticks\tmasked ticks\tmasked sections/TCD\tmean masked ns\n");
+    TEST_Print("IRQ masking", descriptors, &masking);
+    TEST_Print("Lock-free", descriptors, &lockFree);
+    (void)printf("Longest masked section %u ns\n", (uint32_t)longestNs);
+
+    /* The lock-free submission never masks the interrupts, no tick can find them masked. */
+    TEST_CHECK(0U == lockFree.masks);
+    TEST_CHECK(0U == lockFree.deferred);
+    TEST_CHECK(0U != masking.masks);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * The FSL_EDMA_ENABLE_STATISTICS counters on the DMA0 model. Every TCD of the pool moves a different number of
+ * bytes, so the byte count tells which TCDs the interrupt handler took as completed: single transfers that restart
+ * the chain after it ran dry, transfers linked to the one in the registers and chains of the whole pool.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_CHANNEL 4U
+#define TEST_TCDS    4U
+#define TEST_ROUNDS  5U
+#define TEST_WORDS   (TEST_TCDS + 3U)
+#define TEST_BUDGET  100000U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static edma_handle_t s_handle;
+SDK_ALIGN(static edma_tcd_t s_tcdPool[TEST_TCDS], 32U);
+SDK_ALIGN(static uint32_t s_src[TEST_WORDS], 32U);
+SDK_ALIGN(static uint32_t s_dest[TEST_WORDS], 32U);
+
+static uint32_t s_submitted;
+static uint64_t s_bytes;
+static volatile uint32_t s_tcdsDone;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* The DWT is not modelled, the host clock stands for the cycle counter. */
+void MSDK_EnableCpuCycleCounter(void)
+{
+}
+
+uint32_t MSDK_GetCpuCycleCount(void)
+{
+    return (uint32_t)HOST_CoreGetTimeNs();
+}
+
+static void TEST_Callback(edma_handle_t *handle, void *param, bool transferDone, uint32_t tcds)
+{
+    (void)handle;
+    (void)param;
+    (void)transferDone;
+    s_tcdsDone += tcds;
+}
+
+/* Submission n moves 1 to TEST_WORDS words, never the same number as the TCD before or after it. */
+static void TEST_Submit(void)
+{
+    edma_transfer_config_t config;
+    uint32_t bytes = (1U + (s_submitted % TEST_WORDS)) * sizeof(uint32_t);
+
+    EDMA_PrepareTransfer(&config, s_src, sizeof(uint32_t), s_dest, sizeof(uint32_t), bytes, bytes,
+                         kEDMA_MemoryToMemory);
+    TEST_CHECK(kStatus_Success == EDMA_SubmitTransfer(&s_handle, &config));
+    s_submitted++;
+    s_bytes += bytes;
+    if (1U == s_submitted)
+    {
+        EDMA_StartTransfer(&s_handle);
+    }
+}
+
+static void TEST_Run(void)
+{
+    edma_statistics_t statistics;
+
+    while (HOST_DmaRun(TEST_BUDGET) != 0U)
+    {
+    }
+    EDMA_GetStatistics(&s_handle, &statistics);
+    TEST_CHECK(0 == s_handle.tcdUsed);
+    TEST_CHECK(s_submitted == s_tcdsDone);
+    TEST_CHECK(s_submitted == statistics.tcdsDone);
+    if (s_bytes != statistics.bytesMoved)
+    {
+        (void)printf("after %u TCDs: %llu bytes counted, %llu moved\n", s_submitted,
+                     (unsigned long long)statistics.bytesMoved, (unsigned long long)s_bytes);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(void)
+{
+    edma_config_t config;
+    edma_statistics_t statistics;
+    uint32_t round;
+    uint32_t i;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_EnableAlwaysOn(DMAMUX, TEST_CHANNEL, true);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&config);
+    EDMA_Init(DMA0, &config);
+    EDMA_CreateHandle(&s_handle, DMA0, TEST_CHANNEL);
+    EDMA_SetCallback(&s_handle, TEST_Callback, NULL);
+    EDMA_InstallTCDMemory(&s_handle, s_tcdPool, TEST_TCDS);
+    EDMA_ResetStatistics(&s_handle);
+
+    for (round = 0U; round < TEST_ROUNDS; round++)
+    {
+        /* One TCD at a time, every one installed on a dead chain. */
+        for (i = 0U; i < TEST_TCDS + 1U; i++)
+        {
+            TEST_Submit();
+            TEST_Run();
+        }
+        /* A TCD linked to the installed one, then one linked to it in the pool. */
+        TEST_Submit();
+        TEST_Submit();
+        TEST_Submit();
+        TEST_Run();
+        /* The whole pool. */
+        for (i = 0U; i < TEST_TCDS; i++)
+        {
+            TEST_Submit();
+        }
+        TEST_Run();
+    }
+
+    EDMA_GetStatistics(&s_handle, &statistics);
+    TEST_CHECK(TEST_TCDS == statistics.maxQueueDepth);
+    TEST_CHECK(statistics.isrCount == s_submitted);
+    (void)printf("eDMA statistics: %u TCDs, %llu bytes counted by the interrupt handler\n", s_submitted,
+                 (unsigned long long)statistics.bytesMoved);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * LPUART_TransferStartRingBufferEDMA on the DMA0 and LPUART1 models. The line delivers a counting sequence one
+ * character at a time, and the reader takes random amounts out at random times, sometimes lagging by more than the
+ * ring. At some of the wraps PRIMASK holds the wrap interrupt off for 2 to 15 more characters, so the next characters
+ * have already cleared DONE when it is taken. Every length and every read must match a reference that only knows
+ * how many characters arrived: the newest ring full of unread data, in order, the tail never moving backwards. The
+ * overrun callback must come exactly at the wrap interrupts that find more than a ring unread.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "fsl_lpuart_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_INSTANCE   1U
+#define TEST_CHANNEL    2U
+#define TEST_RING_SIZE  16U
+#define TEST_CHARACTERS 20000U
+#define TEST_BUDGET     100000U
+#define TEST_CLOCK_HZ   80000000U
+/* Longest hold-off of the wrap interrupt in characters, the lap must not be overwritten while it is pending. */
+#define TEST_MAX_HOLD   (TEST_RING_SIZE - 1U)
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static lpuart_edma_handle_t s_handle;
+static edma_handle_t s_rxEdmaHandle;
+/* The driver passes addresses as uint32_t, the ring is static to stay below 4 GB. */
+SDK_ALIGN(static uint8_t s_ring[TEST_RING_SIZE], 32U);
+static uint8_t s_data[TEST_RING_SIZE];
+
+/* Characters received and read out according to the reference. */
+static uint32_t s_received;
+static uint32_t s_tail;
+static uint32_t s_overruns;
+static uint32_t s_expectedOverruns;
+static uint32_t s_heldCharacters;
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+static void TEST_Callback(LPUART_Type *base, lpuart_edma_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+
+    if (kStatus_LPUART_RxRingBufferOverrun == status)
+    {
+        s_overruns++;
+    }
+    else
+    {
+        TEST_CHECK(kStatus_LPUART_IdleLineDetected == status);
+    }
+}
+
+/* The reference of the wrap interrupt: an overrun when more than a ring is unread. */
+static void TEST_Wrap(void)
+{
+    if ((s_received - s_tail) > TEST_RING_SIZE)
+    {
+        s_expectedOverruns++;
+    }
+    TEST_CHECK(s_overruns == s_expectedOverruns);
+}
+
+/* One character from the line into the ring. */
+static void TEST_Receive(void)
+{
+    TEST_CHECK(HOST_LpuartReceive(TEST_INSTANCE, (uint8_t)s_received));
+    while (HOST_DmaRun(TEST_BUDGET) != 0U)
+    {
+    }
+    s_received++;
+}
+
+/* The length and a read of up to length characters against the reference. */
+static void TEST_Read(uint32_t length)
+{
+    uint32_t unread = s_received - s_tail;
+    uint32_t count;
+    uint32_t i;
+
+    if (unread > TEST_RING_SIZE)
+    {
+        s_tail = s_received - TEST_RING_SIZE;
+        unread = TEST_RING_SIZE;
+    }
+    TEST_CHECK(unread == LPUART_TransferGetRxRingBufferLengthEDMA(LPUART1, &s_handle));
+
+    count = (length < unread) ? length : unread;
+    (void)memset(s_data, 0, sizeof(s_data));
+    TEST_CHECK(count == LPUART_TransferReadRingBufferEDMA(LPUART1, &s_handle, s_data, length));
+    for (i = 0U; i < count; i++)
+    {
+        TEST_CHECK(s_data[i] == (uint8_t)(s_tail + i));
+    }
+    s_tail += count;
+    TEST_CHECK((s_received - s_tail) == LPUART_TransferGetRxRingBufferLengthEDMA(LPUART1, &s_handle));
+}
+
+/* The reader takes a random amount one time in four, one reader in eight lags and drops old data. */
+static void TEST_MaybeRead(void)
+{
+    uint32_t random = TEST_Random();
+
+    if (((random & 3U) == 0U) && (((s_received / 256U) % 8U) != 7U))
+    {
+        TEST_Read(1U + ((random >> 2U) % TEST_RING_SIZE));
+    }
+    else
+    {
+        TEST_CHECK((((s_received - s_tail) > TEST_RING_SIZE) ? TEST_RING_SIZE : (s_received - s_tail)) ==
+                   LPUART_TransferGetRxRingBufferLengthEDMA(LPUART1, &s_handle));
+    }
+}
+
+int main(void)
+{
+    edma_config_t edmaConfig;
+    lpuart_config_t config;
+    uint32_t irqMask;
+    uint32_t hold;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    HOST_LpuartInit();
+
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_SetSource(DMAMUX, TEST_CHANNEL, (int32_t)kDmaRequestMuxLPUART1Rx);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+
+    LPUART_GetDefaultConfig(&config);
+    config.baudRate_Bps = 115200U;
+    config.enableRx     = true;
+    TEST_CHECK(kStatus_Success == LPUART_Init(LPUART1, &config, TEST_CLOCK_HZ));
+
+    EDMA_CreateHandle(&s_rxEdmaHandle, DMA0, TEST_CHANNEL);
+    LPUART_TransferCreateHandleEDMA(LPUART1, &s_handle, TEST_Callback, NULL, NULL, &s_rxEdmaHandle);
+    TEST_CHECK(kStatus_Success == LPUART_TransferStartRingBufferEDMA(LPUART1, &s_handle, s_ring, TEST_RING_SIZE));
+
+    while (s_received < TEST_CHARACTERS)
+    {
+        if (((s_received + 1U) % TEST_RING_SIZE) != 0U)
+        {
+            TEST_Receive();
+            TEST_MaybeRead();
+            continue;
+        }
+
+        /* The character completing the lap, its interrupt is taken right away or after a few more characters. */
+        hold    = ((TEST_Random() & 1U) == 0U) ? 0U : (2U + (TEST_Random() % (TEST_MAX_HOLD - 1U)));
+        irqMask = DisableGlobalIRQ();
+        TEST_Receive();
+        for (; hold > 0U; hold--)
+        {
+            TEST_MaybeRead();
+            TEST_Receive();
+            s_heldCharacters++;
+        }
+        TEST_MaybeRead();
+        TEST_CHECK(s_overruns == s_expectedOverruns);
+        EnableGlobalIRQ(irqMask);
+        TEST_Wrap();
+        TEST_MaybeRead();
+    }
+    TEST_Read(TEST_RING_SIZE);
+    TEST_CHECK(s_tail == s_received);
+    TEST_CHECK(0U != s_expectedOverruns);
+
+    LPUART_TransferStopRingBufferEDMA(LPUART1, &s_handle);
+    (void)printf("LPUART ring buffer: %u characters through a %u-byte ring, %u characters with the wrap interrupt "
+                 "held off, %u overruns reported at the right wraps, every read in order\n",
+                 s_received, TEST_RING_SIZE, s_heldCharacters, s_overruns);
+
+    return EXIT_SUCCESS;
+}
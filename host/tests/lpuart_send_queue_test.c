@@ -0,0 +1,210 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * LPUART_TransferEnableSendQueueEDMA on the DMA0 and LPUART1 models: buffers of different lengths are queued while
+ * the previous ones are on the line, some of them from the callback, with one pause that lets the queue run dry. Every buffer must be reported sent once, in
+ * queue order and only after its last byte went to the LPUART, the line must carry the buffers in order, and
+ * kStatus_LPUART_TxIdle must come once each time the queue runs dry, after the last byte left the transmitter.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fsl_dmamux.h"
+#include "fsl_edma.h"
+#include "fsl_lpuart_edma.h"
+#include "host_core.h"
+#include "host_dma.h"
+#include "host_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_INSTANCE   1U
+#define TEST_CHANNEL    3U
+#define TEST_TCDS       4U
+#define TEST_BUFFERS    48U
+#define TEST_MAX_LENGTH 23U
+#define TEST_BUDGET     100000U
+#define TEST_CLOCK_HZ   80000000U
+#define TEST_LINE_SIZE  (TEST_BUFFERS * TEST_MAX_LENGTH)
+#define TEST_MAX_STEPS  (4U * TEST_LINE_SIZE)
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static lpuart_edma_handle_t s_handle;
+static edma_handle_t s_txEdmaHandle;
+SDK_ALIGN(static edma_tcd_t s_tcdPool[TEST_TCDS], 32U);
+static uint8_t s_buffers[TEST_BUFFERS][TEST_MAX_LENGTH];
+static uint32_t s_lengths[TEST_BUFFERS];
+/* Line offset right after each buffer. */
+static uint32_t s_ends[TEST_BUFFERS];
+
+static uint8_t s_line[TEST_LINE_SIZE];
+static volatile uint32_t s_lineCount;
+static uint32_t s_queued;
+static volatile uint32_t s_sent;
+static volatile uint32_t s_idle;
+/* Buffers sent at the last kStatus_LPUART_TxIdle. */
+static volatile uint32_t s_idleSent;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void TEST_Sink(uint32_t instance, uint8_t data, void *userData)
+{
+    (void)instance;
+    (void)userData;
+    TEST_CHECK(s_lineCount < TEST_LINE_SIZE);
+    s_line[s_lineCount++] = data;
+}
+
+/* The producer pauses half way until the queue ran dry once. */
+static bool TEST_CanQueue(void)
+{
+    return (s_queued < TEST_BUFFERS) && ((s_queued != (TEST_BUFFERS / 2U)) || (0U != s_idle));
+}
+
+static status_t TEST_Queue(void)
+{
+    lpuart_transfer_t xfer;
+    status_t status;
+
+    xfer.data     = s_buffers[s_queued];
+    xfer.dataSize = s_lengths[s_queued];
+    status        = LPUART_SendEDMA(LPUART1, &s_handle, &xfer);
+    if (kStatus_Success == status)
+    {
+        s_queued++;
+    }
+
+    return status;
+}
+
+static void TEST_Callback(LPUART_Type *base, lpuart_edma_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+
+    if (kStatus_LPUART_TxBufferSent == status)
+    {
+        /* Reported once its last byte is in the LPUART, on the line or still in the transmitter. */
+        TEST_CHECK(s_sent < s_queued);
+        TEST_CHECK(s_lineCount + HOST_LpuartGetTxPending(TEST_INSTANCE) >= s_ends[s_sent]);
+        s_sent++;
+
+        /* Every third report queues the next buffer from the callback. */
+        if (((s_sent % 3U) == 0U) && TEST_CanQueue())
+        {
+            TEST_CHECK(kStatus_Success == TEST_Queue());
+        }
+    }
+    else if (kStatus_LPUART_TxIdle == status)
+    {
+        TEST_CHECK(s_sent == s_queued);
+        TEST_CHECK(s_idleSent != s_sent);
+        TEST_CHECK(0U == HOST_LpuartGetTxPending(TEST_INSTANCE));
+        s_idleSent = s_sent;
+        s_idle++;
+    }
+    else
+    {
+        TEST_CHECK(false);
+    }
+}
+
+int main(void)
+{
+    edma_config_t edmaConfig;
+    lpuart_config_t config;
+    uint32_t offset = 0U;
+    uint32_t steps  = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    HOST_CoreInit();
+    HOST_DmaInit();
+    HOST_LpuartInit();
+    HOST_LpuartSetSink(TEST_INSTANCE, TEST_Sink, NULL);
+
+    DMAMUX_Init(DMAMUX);
+    DMAMUX_SetSource(DMAMUX, TEST_CHANNEL, (int32_t)kDmaRequestMuxLPUART1Tx);
+    DMAMUX_EnableChannel(DMAMUX, TEST_CHANNEL);
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+
+    LPUART_GetDefaultConfig(&config);
+    config.baudRate_Bps = 115200U;
+    config.enableTx     = true;
+    TEST_CHECK(kStatus_Success == LPUART_Init(LPUART1, &config, TEST_CLOCK_HZ));
+
+    EDMA_CreateHandle(&s_txEdmaHandle, DMA0, TEST_CHANNEL);
+    LPUART_TransferCreateHandleEDMA(LPUART1, &s_handle, TEST_Callback, NULL, &s_txEdmaHandle, NULL);
+    LPUART_TransferEnableSendQueueEDMA(LPUART1, &s_handle, s_tcdPool, TEST_TCDS);
+
+    for (i = 0U; i < TEST_BUFFERS; i++)
+    {
+        s_lengths[i] = 1U + ((i * 7U) % TEST_MAX_LENGTH);
+        for (j = 0U; j < s_lengths[i]; j++)
+        {
+            s_buffers[i][j] = (uint8_t)((i << 3U) + j);
+        }
+        offset += s_lengths[i];
+        s_ends[i] = offset;
+    }
+
+    /* Fill the queue, a full queue refuses the next buffer. */
+    for (i = 0U; i < TEST_TCDS; i++)
+    {
+        TEST_CHECK(kStatus_Success == TEST_Queue());
+    }
+    TEST_CHECK(kStatus_LPUART_TxBusy == TEST_Queue());
+    TEST_CHECK(TEST_TCDS == LPUART_TransferGetSendQueueLengthEDMA(LPUART1, &s_handle));
+
+    /* One character time per step, the thread tops the queue up whenever there is room. */
+    while (s_idleSent != TEST_BUFFERS)
+    {
+        TEST_CHECK(++steps < TEST_MAX_STEPS);
+        while (HOST_DmaRun(TEST_BUDGET) != 0U)
+        {
+        }
+        if (TEST_CanQueue() && (((s_lineCount % 5U) == 0U) || (s_queued == s_sent)))
+        {
+            /* After the pause the queue is empty, the next buffer restarts it. */
+            (void)TEST_Queue();
+        }
+        (void)HOST_LpuartRun(TEST_INSTANCE, 1U);
+    }
+
+    TEST_CHECK(TEST_BUFFERS == s_queued);
+    TEST_CHECK(TEST_BUFFERS == s_sent);
+    TEST_CHECK(2U == s_idle);
+    TEST_CHECK(s_ends[TEST_BUFFERS - 1U] == s_lineCount);
+    for (i = 0U; i < TEST_BUFFERS; i++)
+    {
+        TEST_CHECK(0 == memcmp(&s_line[s_ends[i] - s_lengths[i]], s_buffers[i], s_lengths[i]));
+    }
+    TEST_CHECK(0U == LPUART_TransferGetSendQueueLengthEDMA(LPUART1, &s_handle));
+
+    (void)printf("LPUART send queue: %u buffers, %u bytes, %u idle reports, every buffer reported once and in order\n",
+                 TEST_BUFFERS, s_lineCount, s_idle);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,400 @@
+/*
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Fuzz and throughput of the in-place COBS/SLIP frame decoder of cmsis_lpuart_edma_transfer. Random frames, biased
+ * towards the delimiter and escape bytes, are encoded and written into the receive ring in random chunks, never
+ * past the tail the decoder releases, as the LPUART ring or the eDMA ring would. Every frame must come out exactly,
+ * in order, as spans of the ring. Then some frames are corrupted: every intact frame must still come out, so the
+ * decoder resynchronises at the next delimiter. On a small ring the frames longer than maxLength or than the ring
+ * must be dropped without stalling the producer.
+ *
+ * The benchmark decodes a ring full of frames in place and reports the encoded MB/s of the host.
+ *
+ * Usage: uart_frame_test [frames per mode], 20000 by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uart_frame.h"
+#include "host_core.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_FRAMES       20000U
+#define TEST_MAX_LENGTH   599U
+#define TEST_RING_SIZE    2048U
+#define TEST_SMALL_RING   256U
+#define TEST_SMALL_LENGTH 200U
+#define TEST_MAX_CHUNK    64U
+/* One frame in TEST_CORRUPT_RATE has one of its encoded bytes changed. */
+#define TEST_CORRUPT_RATE 20U
+/* Frames generated and not yet matched, at least one byte each in the ring. */
+#define TEST_WINDOW       TEST_RING_SIZE
+#define TEST_MAX_ENCODED  ((2U * TEST_MAX_LENGTH) + 2U)
+#define TEST_BENCH_RING   (64U * 1024U)
+#define TEST_BENCH_RUNS   20U
+
+#define TEST_CHECK(cond)                                                           \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(EXIT_FAILURE);                                                    \
+        }                                                                          \
+    } while (false)
+
+/* Frame sent by the producer. */
+typedef struct _test_frame
+{
+    uint32_t length;               /* Bytes of the payload. */
+    bool corrupted;                /* One encoded byte was changed. */
+    bool decodable;                /* Short enough for maxLength and for the ring. */
+    uint8_t data[TEST_MAX_LENGTH]; /* Payload. */
+} test_frame_t;
+
+/* Decoder setup of one run. */
+typedef struct _test_mode
+{
+    const char *name;           /* Name printed in the summary. */
+    uart_frame_format_t format; /* Frame delimiting. */
+    size_t ringSize;            /* Bytes of the receive ring. */
+    size_t maxLength;           /* Longest decoded frame. */
+    bool corrupt;               /* Corrupt one frame in TEST_CORRUPT_RATE. */
+} test_mode_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const test_mode_t s_modes[] = {
+    {"COBS", kUART_FrameCobs, TEST_RING_SIZE, TEST_MAX_LENGTH, false},
+    {"SLIP", kUART_FrameSlip, TEST_RING_SIZE, TEST_MAX_LENGTH, false},
+    {"COBS corrupted", kUART_FrameCobs, TEST_RING_SIZE, TEST_MAX_LENGTH, true},
+    {"SLIP corrupted", kUART_FrameSlip, TEST_RING_SIZE, TEST_MAX_LENGTH, true},
+    {"COBS small ring", kUART_FrameCobs, TEST_SMALL_RING, TEST_SMALL_LENGTH, false},
+    {"SLIP small ring", kUART_FrameSlip, TEST_SMALL_RING, TEST_SMALL_LENGTH, false},
+};
+
+static test_frame_t s_frames[TEST_WINDOW];
+static uint8_t s_ring[TEST_RING_SIZE];
+static uint8_t s_encoded[TEST_MAX_ENCODED];
+static uint8_t s_decoded[TEST_MAX_LENGTH];
+static uint8_t s_benchRing[TEST_BENCH_RING];
+static uint8_t s_benchStream[TEST_BENCH_RING];
+static uint32_t s_seed = 1U;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static uint32_t TEST_Random(void)
+{
+    s_seed = (s_seed * 1103515245U) + 12345U;
+
+    return s_seed >> 8U;
+}
+
+/* One byte in four is a delimiter, an escape byte or the longest COBS code. */
+static uint8_t TEST_RandomByte(void)
+{
+    static const uint8_t special[] = {0x00U, 0xC0U, 0xDBU, 0xDCU, 0xDDU, 0xFFU};
+
+    return ((TEST_Random() % 4U) == 0U) ? special[TEST_Random() % sizeof(special)] : (uint8_t)TEST_Random();
+}
+
+/* COBS with the 0x00 delimiter, returns the encoded length with the delimiter. */
+static uint32_t TEST_EncodeCobs(const uint8_t *data, uint32_t length, uint8_t *encoded)
+{
+    uint32_t code = 0U;
+    uint32_t out  = 1U;
+    uint32_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        if (data[i] == 0x00U)
+        {
+            encoded[code] = (uint8_t)(out - code);
+            code          = out++;
+            continue;
+        }
+        encoded[out++] = data[i];
+        if ((out - code) == 0xFFU)
+        {
+            encoded[code] = 0xFFU;
+            code          = out++;
+        }
+    }
+    encoded[code]  = (uint8_t)(out - code);
+    encoded[out++] = 0x00U;
+
+    return out;
+}
+
+/* SLIP, RFC 1055, returns the encoded length with the END byte. */
+static uint32_t TEST_EncodeSlip(const uint8_t *data, uint32_t length, uint8_t *encoded)
+{
+    uint32_t out = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        if (data[i] == 0xC0U)
+        {
+            encoded[out++] = 0xDBU;
+            encoded[out++] = 0xDCU;
+        }
+        else if (data[i] == 0xDBU)
+        {
+            encoded[out++] = 0xDBU;
+            encoded[out++] = 0xDDU;
+        }
+        else
+        {
+            encoded[out++] = data[i];
+        }
+    }
+    encoded[out++] = 0xC0U;
+
+    return out;
+}
+
+/* Payload and encoding of frame n, the first four bytes hold n so that no two frames are alike. */
+static uint32_t TEST_Generate(const test_mode_t *mode, uint32_t n)
+{
+    test_frame_t *frame = &s_frames[n % TEST_WINDOW];
+    uint32_t minLength  = mode->corrupt ? 4U : 1U;
+    uint32_t encoded;
+    uint32_t position;
+    uint8_t data;
+    uint32_t i;
+
+    frame->length = minLength + (TEST_Random() % (TEST_MAX_LENGTH + 1U - minLength));
+    for (i = 0U; i < frame->length; i++)
+    {
+        frame->data[i] = (i < 4U) ? (uint8_t)(n >> (8U * i)) : TEST_RandomByte();
+    }
+    encoded = (mode->format == kUART_FrameCobs) ? TEST_EncodeCobs(frame->data, frame->length, s_encoded) :
+                                                  TEST_EncodeSlip(frame->data, frame->length, s_encoded);
+
+    /* Without its delimiter the frame must leave a free byte in the ring. */
+    frame->decodable = (frame->length <= mode->maxLength) && ((encoded - 1U) <= (mode->ringSize - 2U));
+    frame->corrupted = mode->corrupt && ((TEST_Random() % TEST_CORRUPT_RATE) == 0U);
+    if (frame->corrupted)
+    {
+        /* Any byte but the delimiter, the next frame starts where it would. */
+        position = TEST_Random() % (encoded - 1U);
+        do
+        {
+            data = TEST_RandomByte();
+        } while (data == s_encoded[position]);
+        s_encoded[position] = data;
+    }
+
+    return encoded;
+}
+
+/*
+ * Matches a decoded frame with the next intact decodable frame. Anything decoded before it must come from a
+ * corrupted frame, its fragments decode to any content.
+ */
+static uint32_t TEST_Match(uint32_t next, uint32_t generated, const uint8_t *data, uint32_t length, uint32_t *garbage)
+{
+    bool corrupted = false;
+    test_frame_t *frame;
+    uint32_t n;
+
+    for (n = next; n < generated; n++)
+    {
+        frame = &s_frames[n % TEST_WINDOW];
+        if (frame->corrupted)
+        {
+            corrupted = true;
+        }
+        else if (frame->decodable)
+        {
+            break;
+        }
+        else
+        {
+        }
+    }
+
+    if ((n < generated) && (length == s_frames[n % TEST_WINDOW].length) &&
+        (0 == memcmp(data, s_frames[n % TEST_WINDOW].data, length)))
+    {
+        return n + 1U;
+    }
+    if (!corrupted)
+    {
+        (void)printf("decoded a frame of %u bytes, frame %u of %u bytes expected\n", length, n,
+                     (n < generated) ? s_frames[n % TEST_WINDOW].length : 0U);
+        exit(EXIT_FAILURE);
+    }
+    (*garbage)++;
+
+    return next;
+}
+
+static void TEST_Run(const test_mode_t *mode, uint32_t frames)
+{
+    uart_frame_decoder_t decoder;
+    uart_frame_t frame;
+    uint32_t generated = 0U;
+    uint32_t next      = 0U;
+    uint32_t dropped   = 0U;
+    uint32_t garbage   = 0U;
+    uint32_t wrapped   = 0U;
+    uint32_t decoded   = 0U;
+    uint32_t encoded   = 0U;
+    uint32_t sent      = 0U;
+    uint32_t length;
+    size_t size = mode->ringSize;
+    size_t head = TEST_Random() % size;
+    size_t tail = head;
+    size_t space;
+    size_t chunk;
+
+    UART_FrameDecoderInit(&decoder, s_ring, size, mode->format, mode->maxLength, tail);
+    while ((generated < frames) || (sent < encoded))
+    {
+        /* Producer: a chunk of the stream up to the byte before the tail. */
+        space = (tail + size - head - 1U) % size;
+        chunk = 1U + (TEST_Random() % TEST_MAX_CHUNK);
+        for (; (chunk > 0U) && (space > 0U); chunk--, space--)
+        {
+            if (sent == encoded)
+            {
+                if (generated == frames)
+                {
+                    break;
+                }
+                TEST_CHECK((generated - next) < TEST_WINDOW);
+                encoded = TEST_Generate(mode, generated);
+                sent    = 0U;
+                generated++;
+                if ((!s_frames[(generated - 1U) % TEST_WINDOW].decodable) &&
+                    (!s_frames[(generated - 1U) % TEST_WINDOW].corrupted))
+                {
+                    dropped++;
+                }
+            }
+            s_ring[head] = s_encoded[sent++];
+            head         = (head + 1U) % size;
+        }
+        /* Consumer: every frame ending in the received bytes, then the ring space is released. */
+        while (kStatus_Success == UART_FrameDecode(&decoder, head, &frame))
+        {
+            TEST_CHECK((frame.data[0] >= s_ring) && ((frame.data[0] + frame.length[0]) <= (s_ring + size)));
+            TEST_CHECK((frame.length[1] == 0U) ||
+                       (((frame.data[0] + frame.length[0]) == (s_ring + size)) && (frame.data[1] == s_ring)));
+            length = (uint32_t)(frame.length[0] + frame.length[1]);
+            TEST_CHECK((length != 0U) && (length <= mode->maxLength));
+            (void)memcpy(s_decoded, frame.data[0], frame.length[0]);
+            (void)memcpy(&s_decoded[frame.length[0]], frame.data[1], frame.length[1]);
+            wrapped += (frame.length[1] != 0U) ? 1U : 0U;
+            decoded++;
+            next = TEST_Match(next, generated, s_decoded, length, &garbage);
+        }
+        /* A full ring the decoder does not release stalls the producer for good. */
+        TEST_CHECK((((tail + size - head - 1U) % size) != 0U) || (UART_FrameDecoderGetTail(&decoder) != tail));
+        tail = UART_FrameDecoderGetTail(&decoder);
+    }
+
+    /* Whatever was not matched could not be decoded. */
+    for (; next < generated; next++)
+    {
+        TEST_CHECK(s_frames[next % TEST_WINDOW].corrupted || !s_frames[next % TEST_WINDOW].decodable);
+    }
+    TEST_CHECK(decoded == UART_FrameDecoderGetFrames(&decoder));
+    TEST_CHECK(0U != wrapped);
+    if (!mode->corrupt)
+    {
+        TEST_CHECK(0U == garbage);
+        TEST_CHECK(dropped == UART_FrameDecoderGetErrors(&decoder));
+    }
+
+    (void)printf("%-16s%u frames: %u decoded, %u across the wrap, %u dropped, %u from corrupted frames\n", mode->name,
+                 frames, decoded, wrapped, UART_FrameDecoderGetErrors(&decoder), garbage);
+}
+
+/* Encoded MB/s of the best run decoding a ring full of frames of random bytes. */
+static double TEST_Bench(uart_frame_format_t format)
+{
+    uart_frame_decoder_t decoder;
+    uart_frame_t frame;
+    uint8_t data[TEST_MAX_LENGTH];
+    uint32_t bytes  = 0U;
+    uint32_t frames = 0U;
+    uint32_t decoded;
+    uint32_t encoded;
+    uint32_t length;
+    uint64_t best = UINT64_MAX;
+    uint64_t start;
+    uint32_t run;
+    uint32_t i;
+
+    /* Whole frames only, the ring keeps its last byte free. */
+    for (;;)
+    {
+        length = 1U + (TEST_Random() % TEST_MAX_LENGTH);
+        for (i = 0U; i < length; i++)
+        {
+            data[i] = (uint8_t)TEST_Random();
+        }
+        encoded = (format == kUART_FrameCobs) ? TEST_EncodeCobs(data, length, s_encoded) :
+                                                TEST_EncodeSlip(data, length, s_encoded);
+        if ((bytes + encoded) > (TEST_BENCH_RING - 1U))
+        {
+            break;
+        }
+        (void)memcpy(&s_benchStream[bytes], s_encoded, encoded);
+        bytes += encoded;
+        frames++;
+    }
+
+    for (run = 0U; run < TEST_BENCH_RUNS; run++)
+    {
+        /* The decoding overwrites the stream. */
+        (void)memcpy(s_benchRing, s_benchStream, bytes);
+        decoded = 0U;
+        start   = HOST_CoreGetTimeNs();
+        UART_FrameDecoderInit(&decoder, s_benchRing, TEST_BENCH_RING, format, TEST_MAX_LENGTH, 0U);
+        while (kStatus_Success == UART_FrameDecode(&decoder, bytes, &frame))
+        {
+            decoded++;
+        }
+        start = HOST_CoreGetTimeNs() - start;
+        best  = (start < best) ? start : best;
+        TEST_CHECK(frames == decoded);
+    }
+
+    return ((double)bytes * 1000.0) / (double)best;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = TEST_FRAMES;
+    uint32_t i;
+
+    if (argc > 1)
+    {
+        frames = (uint32_t)strtoul(argv[1], NULL, 0);
+        TEST_CHECK(frames != 0U);
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_modes); i++)
+    {
+        TEST_Run(&s_modes[i], frames);
+    }
+
+    (void)printf("Ring of %u bytes decoded in place: COBS %.1f MB/s, SLIP %.1f MB/s of encoded bytes on the host\n",
+                 TEST_BENCH_RING, TEST_Bench(kUART_FrameCobs), TEST_Bench(kUART_FrameSlip));
+
+    return EXIT_SUCCESS;
+}